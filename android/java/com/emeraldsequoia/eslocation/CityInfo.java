@@ -43,12 +43,35 @@ public class CityInfo implements Parcelable {
         longitudeDegrees = geoNames.selectedCityLongitudeDegrees();
         population = geoNames.selectedCityPopulation();
 
+        int slotMask = 0;
+        for (int i = 0; i < 24; i++) {
+            if (geoNames.selectedCityValidForSlotAtOffsetHour(i)) {
+                slotMask |= (1 << i);
+            }
+        }
+        setSlotsFromMask(slotMask);
+    }
+
+    // From one row of GeoNames.getSearchResults; slotMask has bit i set iff the city is valid for the slot at offset hour i.
+    CityInfo(String name, String regionName, String countryCode, String tzName,
+             float latitudeDegrees, float longitudeDegrees, long population, int slotMask) {
+        this.name = name;
+        this.regionName = regionName;
+        this.countryCode = countryCode;
+        this.tzName = tzName;
+        this.latitudeDegrees = latitudeDegrees;
+        this.longitudeDegrees = longitudeDegrees;
+        this.population = population;
+        setSlotsFromMask(slotMask);
+    }
+
+    private void setSlotsFromMask(int slotMask) {
         primarySlot = -1;
         secondarySlot = -1;
         // Work backwards, so that dual-slot cities show up on the right,
         // so their dot is on the left.
         for (int i = 23; i >= 0; i--) {
-            if (geoNames.selectedCityValidForSlotAtOffsetHour(i)) {
+            if ((slotMask & (1 << i)) != 0) {
                 if (primarySlot == -1) {
                     primarySlot = i;
                 } else if (secondarySlot == -1) {
@@ -7,6 +7,8 @@
 
 package com.emeraldsequoia.eslocation;
 
+import java.nio.charset.StandardCharsets;
+
 import android.util.Log;
 
 // Wrapper for the C++ ESGeoNames module.
@@ -62,6 +64,38 @@ public class GeoNames {
     public String   topCityNameAtIndex(int index) {       // after search
         return topCityNameAtIndex(mSerialNumber, index);
     }
+    public CityInfo[] getSearchResults(int first, int count) {  // after search; CityInfos for matches first to first + count - 1 (or the last match), in one native call
+        int numRows = Math.min(count, numMatches() - first);
+        if (first < 0 || numRows <= 0) {
+            return new CityInfo[0];
+        }
+        int[] slotMasks = new int[numRows];
+        float[] latitudesDegrees = new float[numRows];
+        float[] longitudesDegrees = new float[numRows];
+        long[] populations = new long[numRows];
+        byte[] text = getSearchResults(mSerialNumber, first, numRows, slotMasks, latitudesDegrees, longitudesDegrees, populations);
+        if (text == null) {
+            Log.e(TAG, "getSearchResults returned no rows for " + numRows + " matches");
+            return new CityInfo[0];
+        }
+        // Four null-terminated UTF-8 strings per row: name, region name, country code, tz name
+        CityInfo[] cities = new CityInfo[numRows];
+        int pos = 0;
+        for (int i = 0; i < numRows; i++) {
+            String[] strings = new String[4];
+            for (int s = 0; s < 4; s++) {
+                int end = pos;
+                while (text[end] != 0) {
+                    end++;
+                }
+                strings[s] = new String(text, pos, end - pos, StandardCharsets.UTF_8);
+                pos = end + 1;
+            }
+            cities[i] = new CityInfo(strings[0], strings[1], strings[2], strings[3],
+                                     latitudesDegrees[i], longitudesDegrees[i], populations[i], slotMasks[i]);
+        }
+        return cities;
+    }
 
     // Select method (must call a search method first)
     public void     selectNthTopCity(int index) {         // after search; then after calling this you can use *selected* methods above
@@ -117,6 +151,8 @@ public class GeoNames {
     private native int      numMatches(int serialNumber);                                // after search; number of matching city entries
     private native int      numMatchesAtLevel(int serialNumber, int level);                // after qualified search; number of matching city entries with confidence level
     private native String   topCityNameAtIndex(int serialNumber, int index);       // after search
+    private native byte[]   getSearchResults(int serialNumber, int first, int count,
+                                             int[] slotMasks, float[] latitudesDegrees, float[] longitudesDegrees, long[] populations);  // after search; fills count rows, returns their strings
 
     // Select method (must call a search method first)
     private native void     selectNthTopCity(int serialNumber, int index);         // after search; then after calling this you can use *selected* methods above
@@ -277,18 +277,15 @@ public class LocationSelectActivity extends Activity {
                         mMatchesTruncated = false;
                     }
                     if (cityWasChosenFromList) {
-                        mGeoNames.selectNthTopCity(0);                
-                        CityInfo cityInfo = new CityInfo(mGeoNames);
+                        CityInfo cityInfo = mGeoNames.getSearchResults(0, 1)[0];
                     
                         Intent returnIntent = new Intent();
                         returnIntent.putExtra(CITY_INFO, cityInfo);
                         setResult(RESULT_OK, returnIntent);
                         finish();
                     }
-                    mMatchingCities = new CityInfo[numMatches];
-                    for (int i = 0; i < numMatches; i++) {
-                        mGeoNames.selectNthTopCity(i);
-                        mMatchingCities[i] = new CityInfo(mGeoNames);
+                    mMatchingCities = mGeoNames.getSearchResults(0, numMatches);
+                    for (int i = 0; i < mMatchingCities.length; i++) {
                         Log.d(TAG, "... " + 
                               mMatchingCities[i].name + ", " + 
                               mMatchingCities[i].regionName + ", " + 
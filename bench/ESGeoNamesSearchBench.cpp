@@ -0,0 +1,285 @@
+//
+//  ESGeoNamesSearchBench.cpp
+//
+//  Copyright Emerald Sequoia LLC 2011. All rights reserved.
+//
+
+// Search ambiguity analysis and regression benchmark for ESGeoNames name search, replacing
+// scripts/checkTooManyMatches.pl.  Each query goes through the real search path (searchForCityNameFragment, or
+// searchForCityNameFragmentForNominalTZSlot with -slot) rather than a reimplementation of the matching, with the
+// queries spread over threads, each with its own ESGeoNames object on the shared data.
+//
+// By default the queries are the display names of every city (or every Nth with -every), each intended to find the
+// city it came from; -corpus reads them from a file instead, one per line, optionally followed by a tab and the raw
+// index of the intended city.  For each query we note the number of matches, the rank of the intended city in the
+// results, and the time taken, and report
+//
+//   every query with more than -threshold matches (default 30, as the script), by rank, in the script's format
+//   totals which should only change when the data or the matching does (suitable for diffing between runs)
+//   per-query latency percentiles and throughput
+//
+// Build it like a host app, with the esutil and estime sources and src/*.cpp, and run it with the loc-*.dat files
+// in the app support directory.
+//
+//   ESGeoNamesSearchBench [-threads N] [-every N] [-corpus file] [-threshold N] [-slot offsetHours] [-quiet]
+
+#include "ESPlatform.h"
+#include "ESGeoNames.hpp"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#define ES_BENCH_NO_SLOT 99
+
+static double
+monotonicSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+struct ESSearchQuery {
+    std::string             query;
+    int                     intendedCityIndex;  // -1 if not known
+    int                     numMatches;
+    int                     rank;               // of the intended city in the results, or -1 if not there
+    double                  seconds;
+};
+
+struct ESSearchWork {
+    std::vector<ESSearchQuery> *queries;
+    int                     slotOffsetHours;
+    int                     nextQuery;
+    pthread_mutex_t         lock;
+};
+
+struct ESSearchThreadArgs {
+    ESSearchWork            *work;
+    ESGeoNames              *geoNames;
+    pthread_t               thread;
+};
+
+static void *
+searchThreadMain(void *arg) {
+    ESSearchThreadArgs *args = (ESSearchThreadArgs *)arg;
+    ESSearchWork *work = args->work;
+    ESGeoNames *geoNames = args->geoNames;
+    int numQueries = (int)work->queries->size();
+    while (true) {
+        pthread_mutex_lock(&work->lock);
+        int q = work->nextQuery++;
+        pthread_mutex_unlock(&work->lock);
+        if (q >= numQueries) {
+            break;
+        }
+        ESSearchQuery &query = (*work->queries)[q];
+        double start = monotonicSeconds();
+        if (work->slotOffsetHours == ES_BENCH_NO_SLOT) {
+            geoNames->searchForCityNameFragment(query.query.c_str(), false/*proximity*/);
+        } else {
+            geoNames->searchForCityNameFragmentForNominalTZSlot(query.query.c_str(), work->slotOffsetHours);
+        }
+        query.seconds = monotonicSeconds() - start;
+        query.numMatches = geoNames->numMatches();
+        query.rank = -1;
+        if (query.intendedCityIndex >= 0) {
+            for (int n = 0; n < query.numMatches; n++) {
+                geoNames->selectNthTopCity(n);
+                if (geoNames->selectedCityIndex() == query.intendedCityIndex) {
+                    query.rank = n;
+                    break;
+                }
+            }
+        }
+    }
+    return NULL;
+}
+
+static bool
+readCorpus(const char                 *filename,
+           std::vector<ESSearchQuery> *queries) {
+    FILE *fp = fopen(filename, "r");
+    if (!fp) {
+        return false;
+    }
+    char line[1024];
+    while (fgets(line, sizeof(line), fp)) {
+        char *newline = strchr(line, '\n');
+        if (newline) {
+            *newline = '\0';
+        }
+        if (!*line) {
+            continue;
+        }
+        ESSearchQuery query;
+        query.intendedCityIndex = -1;
+        char *tab = strchr(line, '\t');
+        if (tab) {
+            *tab = '\0';
+            char *end;
+            long indx = strtol(tab + 1, &end, 10);
+            if (end != tab + 1 && *end == '\0' && indx >= 0) {
+                query.intendedCityIndex = (int)indx;
+            }
+        }
+        query.query = line;
+        queries->push_back(query);
+    }
+    fclose(fp);
+    return true;
+}
+
+static bool
+rankIsGreater(const ESSearchQuery *query1,
+              const ESSearchQuery *query2) {
+    return query1->rank > query2->rank;
+}
+
+int
+main(int  argc,
+     char **argv) {
+    int numThreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    int every = 1;
+    const char *corpusFile = NULL;
+    int threshold = 30;
+    int slotOffsetHours = ES_BENCH_NO_SLOT;
+    bool quiet = false;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-threads") == 0 && i + 1 < argc) {
+            numThreads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-every") == 0 && i + 1 < argc) {
+            every = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-corpus") == 0 && i + 1 < argc) {
+            corpusFile = argv[++i];
+        } else if (strcmp(argv[i], "-threshold") == 0 && i + 1 < argc) {
+            threshold = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-slot") == 0 && i + 1 < argc) {
+            slotOffsetHours = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-quiet") == 0) {
+            quiet = true;
+        } else {
+            fprintf(stderr, "Usage: %s [-threads N] [-every N] [-corpus file] [-threshold N] [-slot offsetHours] [-quiet]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (numThreads < 1) {
+        numThreads = 1;
+    }
+    if (every < 1) {
+        every = 1;
+    }
+
+    // The shared data is created, and the arrays the search uses are loaded, here in the main thread
+    ESGeoNames geoNames;
+    geoNames.searchForCityNameFragment("", false);
+    int numCities = geoNames.numMatches();
+
+    std::vector<ESSearchQuery> queries;
+    if (corpusFile) {
+        if (!readCorpus(corpusFile, &queries)) {
+            fprintf(stderr, "Couldn't read %s\n", corpusFile);
+            return 1;
+        }
+    } else {
+        for (int i = 0; i < numCities; i += every) {
+            geoNames.selectCityWithIndex(i);
+            ESSearchQuery query;
+            query.query = geoNames.selectedCityName();
+            query.intendedCityIndex = i;
+            queries.push_back(query);
+        }
+    }
+
+    ESSearchWork work;
+    work.queries = &queries;
+    work.slotOffsetHours = slotOffsetHours;
+    work.nextQuery = 0;
+    pthread_mutex_init(&work.lock, NULL);
+    std::vector<ESSearchThreadArgs> threads(numThreads);
+    for (int t = 0; t < numThreads; t++) {
+        threads[t].work = &work;
+        threads[t].geoNames = new ESGeoNames;  // Each has its own search results; constructed here in the main thread
+    }
+    double start = monotonicSeconds();
+    for (int t = 0; t < numThreads; t++) {
+        pthread_create(&threads[t].thread, NULL, searchThreadMain, &threads[t]);
+    }
+    for (int t = 0; t < numThreads; t++) {
+        pthread_join(threads[t].thread, NULL);
+    }
+    double totalSeconds = monotonicSeconds() - start;
+    for (int t = 0; t < numThreads; t++) {
+        delete threads[t].geoNames;
+    }
+    pthread_mutex_destroy(&work.lock);
+
+    // Queries with too many matches, worst rank first, as checkTooManyMatches.pl reported them
+    std::vector<const ESSearchQuery *> overflows;
+    long long totalMatches = 0;
+    long long totalRank = 0;
+    int maxMatches = 0;
+    int rankCounts[5] = { 0, 0, 0, 0, 0 };  // rank 0, 1-9, 10-99, 100+, not found
+    int numWithIntended = 0;
+    std::vector<double> latencies;
+    for (size_t q = 0; q < queries.size(); q++) {
+        const ESSearchQuery &query = queries[q];
+        totalMatches += query.numMatches;
+        maxMatches = std::max(maxMatches, query.numMatches);
+        latencies.push_back(query.seconds);
+        if (query.numMatches > threshold) {
+            overflows.push_back(&query);
+        }
+        if (query.intendedCityIndex < 0) {
+            continue;
+        }
+        numWithIntended++;
+        if (query.rank < 0) {
+            rankCounts[4]++;
+        } else {
+            totalRank += query.rank;
+            rankCounts[query.rank == 0 ? 0 : query.rank < 10 ? 1 : query.rank < 100 ? 2 : 3]++;
+        }
+    }
+    if (!quiet) {
+        std::stable_sort(overflows.begin(), overflows.end(), rankIsGreater);
+        unsigned long maxPopSoFar = 0;
+        for (size_t i = 0; i < overflows.size(); i++) {
+            const ESSearchQuery *query = overflows[i];
+            unsigned long population = 0;
+            if (query->intendedCityIndex >= 0) {
+                geoNames.selectCityWithIndex(query->intendedCityIndex);
+                population = geoNames.selectedCityPopulation();
+            }
+            maxPopSoFar = std::max(maxPopSoFar, population);
+            printf("Rank in results: %3d, matches: %5d, population: %8lu, max pop to this point: %8lu, %s(%d)\n",
+                   query->rank, query->numMatches, population, maxPopSoFar, query->query.c_str(), query->intendedCityIndex);
+        }
+    }
+
+    printf("%d queries over %d cities%s: %lld matches (max %d), %d with more than %d\n",
+           (int)queries.size(), numCities, slotOffsetHours == ES_BENCH_NO_SLOT ? "" : " in slot",
+           totalMatches, maxMatches, (int)overflows.size(), threshold);
+    if (numWithIntended) {
+        printf("intended city at rank 0: %d, 1-9: %d, 10-99: %d, 100+: %d, not found: %d; sum of ranks %lld\n",
+               rankCounts[0], rankCounts[1], rankCounts[2], rankCounts[3], rankCounts[4], totalRank);
+    }
+    if (!latencies.empty()) {
+        std::sort(latencies.begin(), latencies.end());
+        size_t n = latencies.size();
+        printf("%d threads, %.2f s: p50 %.1f us, p99 %.1f us, max %.1f us per query, %.0f queries/s\n",
+               numThreads, totalSeconds,
+               latencies[n / 2] * 1e6,
+               latencies[(size_t)(n * 0.99 < n - 1 ? n * 0.99 : n - 1)] * 1e6,
+               latencies[n - 1] * 1e6,
+               n / totalSeconds);
+    }
+    return 0;
+}
@@ -0,0 +1,212 @@
+//
+//  ESLocationBench.cpp
+//
+//  Copyright Emerald Sequoia LLC 2011. All rights reserved.
+//
+
+// End-to-end latency benchmark for the location pipeline:  drives synthetic (or traced) fixes through
+// ESDeviceLocationManager_replay.cpp into ESLocation::newDeviceLocationAvailable, with N named device
+// locations each having M observers, and reports latency percentiles and throughput for
+//
+//   fix -> last observer callback   from the platform fix until the last ESLocationObserver::newLocationAvailable
+//   fix -> return                   the whole of newDeviceLocationAvailable, including per-observer filtering and prefs bookkeeping
+//   prefs flush                     ESLocation::flushPrefs, once per simulated flush period
+//   country                         the ESGeoNames work ESLocationTimeHelper does for a fix which needs a country check:
+//                                   the country raster, and the closest city only for fixes near a border (done here
+//                                   synchronously; the helper's hop to its thread and back depends on the app's run loop)
+//
+// Build it like a host app, with the esutil and estime sources, src/*.cpp, and ESDeviceLocationManager_replay.cpp
+// in place of the platform backend, and run it with the loc-*.dat files in the app support directory.
+//
+//   ESLocationBench [-locations N] [-observers M] [-fixes K] [-trace file] [-speed metersPerSecond] [-noGeo]
+
+#include "ESPlatform.h"
+#include "ESDeviceLocationManager.hpp"
+#include "ESGeoNames.hpp"
+#include "ESLocation.hpp"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#define ES_BENCH_FLUSH_PERIOD_FIXES 5  // One prefs flush per this many fixes, as the write-behind timer would at one fix a second
+
+static double
+monotonicSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static double lastCallbackTime;
+static int numCallbacks;
+
+// Observers span the range of real clients, from navigation-grade to ESLocationTimeHelper's 1000 km / 1 hour
+class ESBenchObserver : public ESLocationObserver {
+  public:
+                            ESBenchObserver(double         accuracyDesiredInMeters,
+                                            ESTimeInterval updateInterval)
+    :   ESLocationObserver(accuracyDesiredInMeters, updateInterval)
+    {
+    }
+    /*virtual*/ void        newLocationAvailable(ESLocation *location) {
+        numCallbacks++;
+        lastCallbackTime = monotonicSeconds();
+    }
+};
+
+static void
+report(const char          *name,
+       std::vector<double> &samples,
+       double              totalSeconds) {
+    if (samples.empty()) {
+        printf("%-30s no samples\n", name);
+        return;
+    }
+    std::sort(samples.begin(), samples.end());
+    size_t n = samples.size();
+    printf("%-30s n %7d  p50 %9.2f us  p99 %9.2f us  max %9.2f us  %10.0f/s\n",
+           name, (int)n,
+           samples[n / 2] * 1e6,
+           samples[(size_t)(n * 0.99 < n - 1 ? n * 0.99 : n - 1)] * 1e6,
+           samples[n - 1] * 1e6,
+           n / totalSeconds);
+}
+
+int
+main(int  argc,
+     char **argv) {
+    int numLocations = 4;
+    int numObserversPerLocation = 8;
+    int numFixes = 10000;
+    const char *traceFile = NULL;
+    double speedMetersPerSecond = 30;
+    bool doGeo = true;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-locations") == 0 && i + 1 < argc) {
+            numLocations = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-observers") == 0 && i + 1 < argc) {
+            numObserversPerLocation = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-fixes") == 0 && i + 1 < argc) {
+            numFixes = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-trace") == 0 && i + 1 < argc) {
+            traceFile = argv[++i];
+        } else if (strcmp(argv[i], "-speed") == 0 && i + 1 < argc) {
+            speedMetersPerSecond = atof(argv[++i]);
+        } else if (strcmp(argv[i], "-noGeo") == 0) {
+            doGeo = false;
+        } else {
+            fprintf(stderr, "Usage: %s [-locations N] [-observers M] [-fixes K] [-trace file] [-speed metersPerSecond] [-noGeo]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (traceFile) {
+        if (!ESDeviceLocationManager::setReplayTraceFile(traceFile)) {
+            fprintf(stderr, "No fixes in %s\n", traceFile);
+            return 1;
+        }
+    } else {
+        ESDeviceLocationManager::setReplaySynthetic(37.3861, -122.0839, speedMetersPerSecond, 45/*degrees*/, 1/*second*/, numFixes);
+    }
+    ESDeviceLocationManager::setReplaySpeedFactor(0);  // We deliver the fixes
+
+    static const double observerAccuracies[] = { 5, 100, 1000, 1000000 };
+    static const ESTimeInterval observerIntervals[] = { 1, 10, 60, 3600 };
+    std::vector<ESLocation *> locations;
+    std::vector<ESBenchObserver *> observers;
+    for (int i = 0; i < numLocations; i++) {
+        char prefsName[32];
+        snprintf(prefsName, sizeof(prefsName), "ESLocationBench-%d", i);
+        ESLocation *location = new ESLocation(prefsName);
+        location->setToDevice();
+        locations.push_back(location);
+        for (int j = 0; j < numObserversPerLocation; j++) {
+            ESBenchObserver *observer = new ESBenchObserver(observerAccuracies[j % 4], observerIntervals[(j / 4) % 4]);
+            location->addObserver(observer);
+            observers.push_back(observer);
+        }
+    }
+
+    ESGeoNames *geoNames = doGeo ? new ESGeoNames : NULL;
+    float stableRadiusKm = 0;
+    double stableLatitude = 0;
+    double stableLongitude = 0;
+    bool haveCity = false;
+    int numRasterMisses = 0;
+
+    std::vector<double> callbackLatencies;
+    std::vector<double> fixLatencies;
+    std::vector<double> flushLatencies;
+    std::vector<double> geoLatencies;
+    double fixSeconds = 0;
+    double flushSeconds = 0;
+    double geoSeconds = 0;
+    int numDelivered = 0;
+    while (ESDeviceLocationManager::numReplayFixesRemaining() > 0) {
+        numCallbacks = 0;
+        double start = monotonicSeconds();
+        ESDeviceLocationManager::replayNextFix();
+        double end = monotonicSeconds();
+        fixLatencies.push_back(end - start);
+        fixSeconds += end - start;
+        if (numCallbacks) {
+            callbackLatencies.push_back(lastCallbackTime - start);
+        }
+        numDelivered++;
+
+        if (numDelivered % ES_BENCH_FLUSH_PERIOD_FIXES == 0) {
+            start = monotonicSeconds();
+            ESLocation::flushPrefs();
+            end = monotonicSeconds();
+            flushLatencies.push_back(end - start);
+            flushSeconds += end - start;
+        }
+
+        if (geoNames) {
+            double latitude = ESDeviceLocationManager::lastLatitudeDegrees();
+            double longitude = ESDeviceLocationManager::lastLongitudeDegrees();
+            start = monotonicSeconds();
+            std::string cc = geoNames->rasterCountryCodeForLatitudeDegrees(latitude, longitude);
+            if (cc.empty()) {  // Near a border:  fall back to the closest city, as ESLocationTimeHelper does
+                if (!haveCity ||
+                    ESLocation::kmBetweenLatLong(latitude * M_PI / 180, longitude * M_PI / 180,
+                                                 stableLatitude * M_PI / 180, stableLongitude * M_PI / 180) >= stableRadiusKm) {
+                    geoNames->findClosestCityToLatitudeDegrees(latitude, longitude, &stableRadiusKm);
+                    stableLatitude = latitude;
+                    stableLongitude = longitude;
+                    haveCity = true;
+                }
+                cc = geoNames->selectedCityCountryCode();
+                numRasterMisses++;
+            }
+            end = monotonicSeconds();
+            geoLatencies.push_back(end - start);
+            geoSeconds += end - start;
+        }
+    }
+
+    printf("%d locations x %d observers, %d fixes\n", numLocations, numObserversPerLocation, numDelivered);
+    report("fix -> last observer callback", callbackLatencies, fixSeconds);
+    report("fix -> return", fixLatencies, fixSeconds);
+    report("prefs flush", flushLatencies, flushSeconds);
+    if (geoNames) {
+        report("country", geoLatencies, geoSeconds);
+        printf("%-30s %d of %d fixes near a border\n", "country raster misses", numRasterMisses, numDelivered);
+    }
+
+    delete geoNames;
+    for (size_t i = 0; i < locations.size(); i++) {
+        delete locations[i];
+    }
+    for (size_t i = 0; i < observers.size(); i++) {
+        delete observers[i];
+    }
+    return 0;
+}
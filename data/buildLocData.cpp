@@ -0,0 +1,2103 @@
+//
+//  buildLocData.cpp
+//
+//  Copyright Emerald Sequoia LLC 2011. All rights reserved.
+//
+
+// Builds the loc-*.dat files from the GeoNames sources in one step, replacing munchGeoNames.pl, compressNames.pl
+// and makeRasters.pl (run in that order), whose output it matches byte for byte for the same input:
+//
+//   from cities1000.txt, addCities.txt, timezoneCorrections.txt, countryInfo.txt, admin1Codes.txt and admin2Codes.txt:
+//     loc-names.dat loc-index.dat loc-data.dat loc-tz.dat loc-tzNames.dat loc-tzNames.sum loc-region.dat
+//     loc-cc.dat loc-ccCodes.dat loc-a1.dat loc-a2.dat loc-a1Codes.dat loc-regiondesc.dat   (as munchGeoNames.pl)
+//   and from those:
+//     loc-names-fsst.dat loc-index-fsst.dat                                                 (as compressNames.pl)
+//     loc-tzRaster.dat loc-ccRaster.dat                                                     (as makeRasters.pl)
+//   and from those and airportCodes.txt:
+//     loc-airports.dat
+//
+// The Perl scripts remain the reference for the formats; see the comments at the top of each.  The sqlite database
+// built by makeDB.csh (and patched by fixDB.csh) was only ever for checking the data by hand with checkDB.csh; none
+// of the loc-*.dat files come from it, so it isn't built here.  The loc-tzOffsets-*.dat files come from the apps.
+//
+// Parsing the city files, counting symbols for the name compression, and computing the raster rows are spread
+// across threads; everything whose result depends on order (index assignment) is done in one pass afterwards.
+//
+//   c++ -O2 -o buildLocData buildLocData.cpp -lpthread
+//   cd data; ./buildLocData [-j threads] [-derivedOnly] [-input file] [-minPopulation N] [-o directory] [-overlay corrections]
+//                           [-hashHeader file]
+//
+// -derivedOnly skips the GeoNames sources and rebuilds just the compressed names, the rasters and the airport
+// table from the loc-*.dat files already present (in the output directory).
+//
+// The other options build the larger or smaller datasets ESGeoNames::setDataset selects:  -input names the GeoNames
+// file to use in place of cities1000.txt (e.g., cities500.txt or allCountries.txt, from which only the populated
+// places, feature class P, are taken), -minPopulation drops its cities below that population, and -o writes the
+// loc-*.dat files to a directory (e.g., allCountries) rather than here.  addCities.txt is always added unfiltered.
+// When there are too many regions (or countries or admin codes) for a short, loc-region.dat and loc-regiondesc.dat
+// are written as 32-bit ints, and loc-regionIndexBytes.dat (a single 32-bit 4) tells ESGeoNames so; otherwise the
+// output is unchanged.
+//
+// -overlay file makes just loc-overlay.dat, the corrections ESGeoNames applies to a dataset as it loads it, from a
+// text file of them (see makeOverlay for the form) and the loc-*.dat files already present.  It's a few KB for a
+// few corrections, where a rebuild changes every loc-*.dat file.  It includes the raster cells the corrections change,
+// found by making the rasters again, so it takes as long as -derivedOnly.
+//
+// -hashHeader file writes just the C++ header of perfect-hash tables ESGeoNames looks up country codes, country names,
+// admin1 codes and zone names in (src/ESGeoNamesHashTables.hpp), from the loc-*.dat files already present.  Rerun it
+// whenever the shipped files change; ESGeoNames scans instead for files the header doesn't match.
+
+#include <errno.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+static int numThreads = 1;
+static std::string inputFile = "cities1000.txt";
+static unsigned int minPopulation = 0;
+static std::string outputDirectory;  // Empty for the current directory
+
+static void
+fatal(const char *fmt,
+      ...) {
+    va_list args;
+    va_start(args, fmt);
+    vfprintf(stderr, fmt, args);
+    va_end(args);
+    exit(1);
+}
+
+static double
+currentSeconds() {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+static bool
+readFile(const std::string &filename,
+         std::string       *contents) {
+    FILE *fp = fopen(filename.c_str(), "rb");
+    if (!fp) {
+        return false;
+    }
+    contents->clear();
+    char buf[65536];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), fp)) > 0) {
+        contents->append(buf, n);
+    }
+    fclose(fp);
+    return true;
+}
+
+static std::string
+readRequiredFile(const std::string &filename) {
+    std::string contents;
+    if (!readFile(filename, &contents)) {
+        fatal("Couldn't read %s: %s\n", filename.c_str(), strerror(errno));
+    }
+    return contents;
+}
+
+// Where the named loc-*.dat file is written (and read back from by the later stages)
+static std::string
+outputPath(const std::string &filename) {
+    return outputDirectory.empty() ? filename : outputDirectory + "/" + filename;
+}
+
+static std::string
+readOutputFile(const std::string &filename) {
+    return readRequiredFile(outputPath(filename));
+}
+
+static void
+writeFile(const std::string &filename,
+          const void        *bytes,
+          size_t            numBytes) {
+    std::string path = outputPath(filename);
+    unlink(path.c_str());
+    FILE *fp = fopen(path.c_str(), "wb");
+    if (!fp || fwrite(bytes, 1, numBytes, fp) != numBytes || fclose(fp) != 0) {
+        fatal("Couldn't write %s: %s\n", path.c_str(), strerror(errno));
+    }
+}
+
+template<class ElementType> static void
+writeArray(const std::string              &filename,
+           const std::vector<ElementType> &array) {
+    writeFile(filename, array.empty() ? NULL : &array[0], array.size() * sizeof(ElementType));
+}
+
+// Splits a line at tabs (or another separator) like Perl's split, which drops trailing empty fields
+static void
+splitLine(const char               *line,
+          size_t                   length,
+          char                     separator,
+          std::vector<std::string> *fields) {
+    fields->clear();
+    const char *end = line + length;
+    const char *start = line;
+    for (const char *p = line; p <= end; p++) {
+        if (p == end || *p == separator) {
+            fields->push_back(std::string(start, p - start));
+            start = p + 1;
+        }
+    }
+    while (!fields->empty() && fields->back().empty()) {
+        fields->pop_back();
+    }
+}
+
+// Calls fn(line, length) for each line of contents, without the newline
+template<class Function> static void
+forEachLine(const char *contents,
+            size_t     length,
+            Function   &fn) {
+    const char *end = contents + length;
+    const char *line = contents;
+    while (line < end) {
+        const char *newline = (const char *)memchr(line, '\n', end - line);
+        const char *lineEnd = newline ? newline : end;
+        fn(line, lineEnd - line);
+        line = lineEnd + 1;
+    }
+}
+
+// Runs work(threadIndex, context) on numThreads threads, and returns when they've all finished
+struct ESBuildThreadArgs {
+    void                    (*work)(int, void *);
+    void                    *context;
+    int                     threadIndex;
+};
+
+static void *
+buildThreadMain(void *arg) {
+    ESBuildThreadArgs *args = (ESBuildThreadArgs *)arg;
+    (*args->work)(args->threadIndex, args->context);
+    return NULL;
+}
+
+static void
+runInThreads(void (*work)(int threadIndex, void *context),
+             void *context) {
+    std::vector<pthread_t> threads(numThreads);
+    std::vector<ESBuildThreadArgs> args(numThreads);
+    for (int i = 0; i < numThreads; i++) {
+        args[i].work = work;
+        args[i].context = context;
+        args[i].threadIndex = i;
+        if (pthread_create(&threads[i], NULL, buildThreadMain, &args[i]) != 0) {
+            fatal("Couldn't create thread: %s\n", strerror(errno));
+        }
+    }
+    for (int i = 0; i < numThreads; i++) {
+        pthread_join(threads[i], NULL);
+    }
+}
+
+// The CRC computed by the POSIX cksum command, which munchGeoNames.pl used for loc-tzNames.sum
+static unsigned int
+posixChecksum(const std::string &bytes) {
+    static unsigned int table[256];
+    if (!table[1]) {
+        for (unsigned int i = 0; i < 256; i++) {
+            unsigned int crc = i << 24;
+            for (int bit = 0; bit < 8; bit++) {
+                crc = (crc & 0x80000000) ? (crc << 1) ^ 0x04c11db7 : crc << 1;
+            }
+            table[i] = crc;
+        }
+    }
+    unsigned int crc = 0;
+    for (size_t i = 0; i < bytes.length(); i++) {
+        crc = (crc << 8) ^ table[(crc >> 24) ^ (unsigned char)bytes[i]];
+    }
+    for (size_t length = bytes.length(); length; length >>= 8) {
+        crc = (crc << 8) ^ table[(crc >> 24) ^ (length & 0xff)];
+    }
+    return ~crc;
+}
+
+// A set of keys, each given the next index the first time it's seen, remembered in that order
+class ESIndexAssigner {
+  public:
+    int                     indexFor(const std::string &key) {
+        std::map<std::string, int>::iterator iter = _indices.find(key);
+        if (iter != _indices.end()) {
+            return iter->second;
+        }
+        int indx = (int)_keys.size();
+        _indices[key] = indx;
+        _keys.push_back(key);
+        return indx;
+    }
+    int                     find(const std::string &key) const {
+        std::map<std::string, int>::const_iterator iter = _indices.find(key);
+        return iter == _indices.end() ? -1 : iter->second;
+    }
+    const std::vector<std::string> &keys() const { return _keys; }
+    int                     count() const { return (int)_keys.size(); }
+
+  private:
+    std::map<std::string, int> _indices;
+    std::vector<std::string> _keys;  // in index order
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Stage 1:  GeoNames sources => base files (munchGeoNames.pl)
+
+// Map from ascii name to an English name we also want to search for, as in munchGeoNames.pl
+static const char *altNames[][2] = {
+    { "Muenchen", "Munich" },
+    { "Mumbai", "Bombay" },
+    { "Beijing", "Peking" },
+    { "Bengaluru", "Bangalore" },
+    { "Chennai", "Madras" },
+    { "Chongqing", "Chungking" },
+    { "Guangzhou", "Canton" },
+    { "Nanjing", "Nanking" },
+    { "Roma", "Rome" },
+    { "Faisalabad", "Lyallpur" },
+    { "Bucuresti", "Bucharest" },
+    { "Ha Noi", "Hanoi" },
+    { "Praha", "Prague" },
+    { "Kinshasa", "Leopoldville" },
+    { "Lubumbashi", "Elizabethville" },
+    { "Kisangani", "Stanleyville" },
+    { "Tianjin", "Tientsin" },
+    { "Xian", "Sian" },
+    { "Dalian", "Darien" },
+    { "Al Jizah", "Giza" },
+    { "Jakarta", "Djakarta" },
+    { "Al Basrah", "Basra" },
+    { "Almaty", "Alma Ata" },
+    { "Tombouctou", "Timbuktu" },
+    // map a few the other way
+    { "Cairo", "Al Q\xc4\x81hirah" },
+    { "Khartoum", "Al Khartum" },
+    { "Bangkok", "Krung Thep" },
+    { "Florence", "Firenze" },
+    { "Vienna", "Wien" },
+    { "Calcutta", "Kolkata" },
+    // plus a few special cases:
+    { "Hong Kong", "Victoria" },
+    { "Los Angeles", "LA" },
+    { "Emerald Lake Hills", "Emerald Hills" },
+    { "Thanh pho Ho Chi Minh", "Saigon" },
+    { "Saint Petersburg", "Leningrad" },
+    { "Volgograd", "Stalingrad" },
+};
+
+// Corrections to the population for given cities based on asciiname
+static const struct { const char *asciiName; unsigned int population; } populationCorrectors[] = {
+    { "Juan Dolio", 1000 },
+};
+
+// The columns of a cities1000.txt line that we use
+struct ESRawCity {
+    std::string             name;
+    std::string             asciiName;
+    std::string             countryCode;
+    std::string             admin1Code;
+    std::string             admin2Code;
+    std::string             timezoneID;
+    std::string             population;
+    double                  latitude;
+    double                  longitude;
+};
+
+struct ESParseChunk {
+    const char              *start;
+    size_t                  length;
+    bool                    filter;  // Keep only populated places of at least minPopulation
+    std::vector<ESRawCity>  cities;
+    std::string             error;
+};
+
+struct ESCityLineParser {
+    ESParseChunk            *chunk;
+    std::vector<std::string> fields;
+    void operator()(const char *line, size_t length) {
+        if (!chunk->error.empty()) {
+            return;
+        }
+        if (memchr(line, '+', length)) {
+            chunk->error = "Delimiter '+' appears in data line:\n" + std::string(line, length);
+            return;
+        }
+        splitLine(line, length, '\t', &fields);
+        fields.resize(19);  // geonameid name asciiname alternatenames latitude longitude featureClass featureCode
+                            // countryCode cc2 admin1Code admin2Code admin3Code admin4Code population elevation gtopo30 timezoneID modDate
+        if (chunk->filter &&
+            (fields[6] != "P" || strtoul(fields[14].c_str(), NULL, 10) < minPopulation)) {
+            return;
+        }
+        chunk->cities.push_back(ESRawCity());
+        ESRawCity &city = chunk->cities.back();
+        city.name = fields[1];
+        city.asciiName = fields[2];
+        city.latitude = strtod(fields[4].c_str(), NULL);
+        city.longitude = strtod(fields[5].c_str(), NULL);
+        city.countryCode = fields[8];
+        city.admin1Code = fields[10];
+        city.admin2Code = fields[11];
+        city.population = fields[14];
+        city.timezoneID = fields[17];
+    }
+};
+
+static void
+parseChunkInThread(int  threadIndex,
+                   void *context) {
+    ESParseChunk *chunk = (ESParseChunk *)context + threadIndex;
+    ESCityLineParser parser;
+    parser.chunk = chunk;
+    forEachLine(chunk->start, chunk->length, parser);
+}
+
+// Reads a GeoNames city file, with each thread parsing a share of the lines, and appends its cities in file order
+static void
+readRawFile(const std::string      &filename,
+            bool                   filter,
+            std::vector<ESRawCity> *cities) {
+    std::string contents = readRequiredFile(filename);
+    std::vector<ESParseChunk> chunks(numThreads);
+    size_t chunkStart = 0;
+    for (int i = 0; i < numThreads; i++) {
+        size_t chunkEnd = i == numThreads - 1 ? contents.length() : contents.length() * (i + 1) / numThreads;
+        if (chunkEnd < chunkStart) {
+            chunkEnd = chunkStart;
+        }
+        // Move the split to just past a newline
+        while (chunkEnd < contents.length() && chunkEnd > 0 && contents[chunkEnd - 1] != '\n') {
+            chunkEnd++;
+        }
+        chunks[i].start = contents.data() + chunkStart;
+        chunks[i].length = chunkEnd - chunkStart;
+        chunks[i].filter = filter;
+        chunkStart = chunkEnd;
+    }
+    runInThreads(parseChunkInThread, &chunks[0]);
+    for (int i = 0; i < numThreads; i++) {
+        if (!chunks[i].error.empty()) {
+            fatal("%s\n", chunks[i].error.c_str());
+        }
+        cities->insert(cities->end(), chunks[i].cities.begin(), chunks[i].cities.end());
+    }
+}
+
+struct ESTZCorrection {
+    std::string             timezoneID;
+    bool                    used;
+};
+
+// Keyed by "asciiname+countryCode+admin1Code+admin2Code"; order kept for the warnings
+struct ESTZCorrections {
+    std::map<std::string, ESTZCorrection> corrections;
+    std::vector<std::string> keys;
+    std::vector<std::string> fields;
+    void operator()(const char *line, size_t length) {
+        splitLine(line, length, ',', &fields);
+        fields.resize(5);
+        std::string key = fields[0] + "+" + fields[1] + "+" + fields[2] + "+" + fields[3];
+        if (corrections.find(key) == corrections.end()) {
+            keys.push_back(key);
+        }
+        corrections[key].timezoneID = fields[4];
+        corrections[key].used = false;
+    }
+};
+
+// Translation of codes to names from a GeoNames code file, as writeNamesFile in munchGeoNames.pl
+struct ESTranslator {
+    int                     nameColumn;
+    std::map<std::string, std::pair<bool, std::string> > translations;  // code => (defined, name)
+    std::vector<std::string> fields;
+    void operator()(const char *line, size_t length) {
+        if (length > 0 && line[0] == '#') {
+            return;
+        }
+        splitLine(line, length, '\t', &fields);
+        std::string code = fields.empty() ? "" : fields[0];
+        if ((int)fields.size() > nameColumn) {
+            translations[code] = std::make_pair(true, fields[nameColumn]);
+        } else {
+            translations[code] = std::make_pair(false, std::string());
+        }
+    }
+};
+
+static void
+writeNamesFile(const std::vector<std::string> &keys,
+               const std::string              &filename,
+               const char                     *translateFile = NULL,
+               int                            nameColumn = 0) {
+    ESTranslator translator;
+    if (translateFile) {
+        translator.nameColumn = nameColumn;
+        std::string contents = readRequiredFile(translateFile);
+        forEachLine(contents.data(), contents.length(), translator);
+    }
+    std::string output;
+    for (size_t i = 0; i < keys.size(); i++) {
+        std::string name = keys[i];
+        if (translateFile) {
+            std::map<std::string, std::pair<bool, std::string> >::const_iterator iter = translator.translations.find(name);
+            if (iter != translator.translations.end() && iter->second.first) {
+                name = iter->second.second;
+            } else if (name.length() >= 4 && name[0] != '.' && name[1] != '.' && name[2] == '.' &&
+                       (name[3] == '.' || (name.length() >= 6 && name[4] != '.' && name[5] == '.'))) {
+                name = "";  // No translation for an admin code
+            } else if (name.length() >= 3 && name[0] != '.' && name[1] != '.' && name[2] == '.') {
+                name = name.substr(3);
+            } else {
+                fatal("Unexpected key name for translation '%s'\n", name.c_str());
+            }
+        }
+        output += name;
+        output += '\0';
+    }
+    writeFile(filename, output.data(), output.length());
+}
+
+static void
+writeTwoCharNames(const std::vector<std::string> &keys,
+                  const std::string              &filename) {
+    std::string output;
+    for (size_t i = 0; i < keys.size(); i++) {
+        if (keys[i].length() != 2) {
+            fatal("Country code '%s' with length != 2\n", keys[i].c_str());
+        }
+        output += keys[i];  // No null, no space.  Will be read as short.
+    }
+    writeFile(filename, output.data(), output.length());
+}
+
+static std::string
+insertCommas(unsigned long long number) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%llu", number);
+    std::string digits = buf;
+    for (int i = (int)digits.length() - 3; i > 0; i -= 3) {
+        digits.insert(i, ",");
+    }
+    return digits;
+}
+
+static void
+buildBaseFiles() {
+    ESTZCorrections tzCorrections;
+    std::string contents = readRequiredFile("timezoneCorrections.txt");
+    forEachLine(contents.data(), contents.length(), tzCorrections);
+
+    std::vector<ESRawCity> cities;
+    readRawFile(inputFile, true/*filter*/, &cities);
+    readRawFile("addCities.txt", false/*filter*/, &cities);
+
+    std::map<std::string, std::string> altNameMap;
+    for (size_t i = 0; i < sizeof(altNames) / sizeof(altNames[0]); i++) {
+        altNameMap[altNames[i][0]] = altNames[i][1];
+    }
+
+    std::string names;
+    std::vector<unsigned int> nameIndices;
+    std::vector<unsigned char> cityData;  // Packed population (32 bits), latitude (float), longitude (float)
+    std::vector<unsigned short> tzIndices;
+    ESIndexAssigner tzNames;
+    std::map<std::string, int> ccAdmin1Counts;  // displayCity+CC+A1 => count of cities with that designation (when count > 1, we need admin2)
+    unsigned long long totalPopulation = 0;
+    for (size_t i = 0; i < cities.size(); i++) {
+        ESRawCity &city = cities[i];
+        std::string tzCorrectionKey = city.asciiName + "+" + city.countryCode + "+" + city.admin1Code + "+" + city.admin2Code;
+        std::map<std::string, ESTZCorrection>::iterator correction = tzCorrections.corrections.find(tzCorrectionKey);
+        if (correction != tzCorrections.corrections.end()) {
+            if (correction->second.used) {
+                fatal("Specification for corrected tz city not unique: %s\n", tzCorrectionKey.c_str());
+            }
+            if (correction->second.timezoneID == city.timezoneID) {
+                fprintf(stderr, "TZ correction for city apparently no longer required: %s is already %s\n",
+                        tzCorrectionKey.c_str(), city.timezoneID.c_str());
+            } else {
+                city.timezoneID = correction->second.timezoneID;
+            }
+            correction->second.used = true;
+        }
+
+        std::string archiveName = city.name == city.asciiName ? city.name : city.asciiName + "+" + city.name;  // The search string, with the display name last
+        std::map<std::string, std::string>::const_iterator altName = altNameMap.find(city.asciiName);
+        if (altName != altNameMap.end()) {
+            archiveName = altName->second + "+" + archiveName;
+        }
+        nameIndices.push_back((unsigned int)names.length());
+        names += archiveName;
+        names += '\0';
+
+        ccAdmin1Counts[city.name + "+" + city.countryCode + "+" + city.admin1Code]++;
+
+        unsigned int population = (unsigned int)strtoul(city.population.c_str(), NULL, 10);
+        bool corrected = false;
+        for (size_t j = 0; j < sizeof(populationCorrectors) / sizeof(populationCorrectors[0]); j++) {
+            if (city.asciiName == populationCorrectors[j].asciiName) {
+                population = populationCorrectors[j].population;
+                corrected = true;
+            }
+        }
+        if (!corrected && population < 3) {
+            population = 3;  // So log2 doesn't go negative
+        }
+        float latitude = (float)city.latitude;
+        float longitude = (float)city.longitude;
+        size_t offset = cityData.size();
+        cityData.resize(offset + 12);
+        memcpy(&cityData[offset], &population, 4);
+        memcpy(&cityData[offset + 4], &latitude, 4);
+        memcpy(&cityData[offset + 8], &longitude, 4);
+        totalPopulation += population;
+
+        tzIndices.push_back((unsigned short)tzNames.indexFor(city.timezoneID));
+    }
+    for (size_t i = 0; i < tzCorrections.keys.size(); i++) {
+        if (!tzCorrections.corrections[tzCorrections.keys[i]].used) {
+            fprintf(stderr, "TZ correction is for city not in our db: %s\n", tzCorrections.keys[i].c_str());
+        }
+    }
+
+    writeFile("loc-names.dat", names.data(), names.length());
+    writeArray("loc-data.dat", cityData);
+    writeArray("loc-index.dat", nameIndices);
+    writeArray("loc-tz.dat", tzIndices);
+    writeNamesFile(tzNames.keys(), "loc-tzNames.dat");
+    unsigned int tzNamesChecksum = posixChecksum(readOutputFile("loc-tzNames.dat"));
+    writeFile("loc-tzNames.sum", &tzNamesChecksum, sizeof(tzNamesChecksum));
+
+    // Now that we know which City+CC+A1 designations are unique, output region codes
+    ESIndexAssigner regions;
+    ESIndexAssigner countries;
+    ESIndexAssigner a1s;
+    ESIndexAssigner a2s;
+    std::vector<int> regionIndices;
+    for (size_t i = 0; i < cities.size(); i++) {
+        const ESRawCity &city = cities[i];
+        countries.indexFor(city.countryCode);
+        std::string a1Code = city.countryCode + "." + city.admin1Code;
+        a1s.indexFor(a1Code);
+        std::string uniqueRegion;
+        if (ccAdmin1Counts[city.name + "+" + city.countryCode + "+" + city.admin1Code] == 1) {
+            uniqueRegion = city.countryCode + "+" + city.admin1Code;
+        } else {
+            uniqueRegion = city.countryCode + "+" + city.admin1Code + "+" + city.admin2Code;
+            a2s.indexFor(a1Code + "." + city.admin2Code);
+        }
+        regionIndices.push_back(regions.indexFor(uniqueRegion));
+    }
+
+    writeNamesFile(countries.keys(), "loc-cc.dat", "countryInfo.txt", 4);
+    writeTwoCharNames(countries.keys(), "loc-ccCodes.dat");
+    writeNamesFile(a1s.keys(), "loc-a1.dat", "admin1Codes.txt", 1);
+    writeNamesFile(a2s.keys(), "loc-a2.dat", "admin2Codes.txt", 1);
+    writeNamesFile(a1s.keys(), "loc-a1Codes.dat");
+
+    std::vector<int> regionDescs;
+    for (int i = 0; i < regions.count(); i++) {
+        const std::string &region = regions.keys()[i];
+        size_t plus1 = region.find('+');
+        size_t plus2 = region.find('+', plus1 + 1);
+        std::string cc = region.substr(0, plus1);
+        std::string a1 = region.substr(plus1 + 1, plus2 == std::string::npos ? std::string::npos : plus2 - plus1 - 1);
+        std::string a2 = plus2 == std::string::npos ? "" : region.substr(plus2 + 1);
+        int ccIndex = countries.find(cc);
+        int a1Index = a1s.find(cc + "." + a1);
+        int a2Index = -1;
+        if (ccIndex < 0 || a1Index < 0) {
+            fatal("Can't find CC or A1 index for '%s'\n", region.c_str());
+        }
+        if (!a2.empty()) {
+            a2Index = a2s.find(cc + "." + a1 + "." + a2);
+            if (a2Index < 0) {
+                fatal("Can't find A2 index '%s.%s.%s' in '%s'\n", cc.c_str(), a1.c_str(), a2.c_str(), region.c_str());
+            }
+        }
+        regionDescs.push_back(ccIndex);
+        regionDescs.push_back(a1Index);
+        regionDescs.push_back(a2Index);
+    }
+    // ESGeoNames reads the shorts as signed (a2Index -1 is "none"), so only go wide when something won't fit
+    std::string wideMarkerPath = outputPath("loc-regionIndexBytes.dat");
+    unlink(wideMarkerPath.c_str());
+    if (std::max(std::max(regions.count(), countries.count()), std::max(a1s.count(), a2s.count())) > 32767) {
+        writeArray("loc-region.dat", regionIndices);
+        writeArray("loc-regiondesc.dat", regionDescs);
+        unsigned int regionIndexBytes = 4;
+        writeFile("loc-regionIndexBytes.dat", &regionIndexBytes, sizeof(regionIndexBytes));
+    } else {
+        writeArray("loc-region.dat", std::vector<unsigned short>(regionIndices.begin(), regionIndices.end()));
+        writeArray("loc-regiondesc.dat", std::vector<unsigned short>(regionDescs.begin(), regionDescs.end()));
+    }
+
+    printf("%s bytes of names in %s cities, %d countries, %d admin1s, %d admin2s, %d unique regions, total population %s\n",
+           insertCommas(names.length()).c_str(), insertCommas(cities.size()).c_str(),
+           countries.count(), a1s.count(), a2s.count(), regions.count(), insertCommas(totalPopulation).c_str());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Stage 2a:  loc-names.dat => loc-names-fsst.dat (compressNames.pl)
+
+#define ES_FSST_MAX_SYMBOL_LENGTH 8
+#define ES_FSST_NUM_SYMBOL_CODES 254  // Codes 1-254; 0 is end-of-name, 255 is the literal escape
+#define ES_FSST_NUM_ROUNDS 5
+#define ES_FSST_MAX_NAME_LENGTH 240   // Must leave room for the decoder's 8-byte overrun in ES_GEONAMES_NAME_BUFFER_SIZE
+
+// Names have no nulls, so a symbol of up to 8 bytes is identified by its bytes zero-padded into 64 bits
+typedef unsigned long long ESSymbolKey;
+
+static ESSymbolKey
+symbolKey(const char *bytes,
+          int        length) {
+    ESSymbolKey key = 0;
+    memcpy(&key, bytes, length);
+    return key;
+}
+
+static int
+symbolLength(ESSymbolKey key) {
+    const char *bytes = (const char *)&key;
+    int length = 0;
+    while (length < ES_FSST_MAX_SYMBOL_LENGTH && bytes[length]) {
+        length++;
+    }
+    return length;
+}
+
+typedef std::map<ESSymbolKey, int> ESSymbolMap;
+
+// Greedy longest-match parse of one name into symbols (bytes not starting a multibyte symbol are returned as themselves)
+static void
+parseName(const std::string        &name,
+          const ESSymbolMap        &symbols,
+          std::vector<ESSymbolKey> *parsed) {
+    parsed->clear();
+    int length = (int)name.length();
+    int pos = 0;
+    while (pos < length) {
+        int matchLength = 1;
+        for (int l = length - pos < ES_FSST_MAX_SYMBOL_LENGTH ? length - pos : ES_FSST_MAX_SYMBOL_LENGTH; l > 1; l--) {
+            if (symbols.find(symbolKey(name.data() + pos, l)) != symbols.end()) {
+                matchLength = l;
+                break;
+            }
+        }
+        parsed->push_back(symbolKey(name.data() + pos, matchLength));
+        pos += matchLength;
+    }
+}
+
+struct ESSymbolCountContext {
+    const std::vector<std::string> *names;
+    const ESSymbolMap       *symbols;
+    std::vector<std::map<ESSymbolKey, long long> > counts;  // one per thread
+};
+
+static void
+countSymbolsInThread(int  threadIndex,
+                     void *context) {
+    ESSymbolCountContext *ctx = (ESSymbolCountContext *)context;
+    std::map<ESSymbolKey, long long> &count = ctx->counts[threadIndex];
+    size_t numNames = ctx->names->size();
+    std::vector<ESSymbolKey> parsed;
+    for (size_t n = numNames * threadIndex / numThreads; n < numNames * (threadIndex + 1) / numThreads; n++) {
+        parseName((*ctx->names)[n], *ctx->symbols, &parsed);
+        for (size_t i = 0; i < parsed.size(); i++) {
+            count[parsed[i]]++;
+            if (i + 1 < parsed.size()) {
+                int length1 = symbolLength(parsed[i]);
+                int length2 = symbolLength(parsed[i + 1]);
+                if (length1 + length2 <= ES_FSST_MAX_SYMBOL_LENGTH) {
+                    count[parsed[i] | (parsed[i + 1] << (8 * length1))]++;  // The two concatenated
+                }
+            }
+        }
+    }
+}
+
+struct ESSymbolCandidate {
+    ESSymbolKey             key;
+    long long               gain;
+    bool operator<(const ESSymbolCandidate &other) const {  // Most gain first, then by bytes, as compressNames.pl
+        if (gain != other.gain) {
+            return gain > other.gain;
+        }
+        return memcmpSymbols(key, other.key) < 0;
+    }
+    static int              memcmpSymbols(ESSymbolKey key1,
+                                          ESSymbolKey key2) {
+        int length1 = symbolLength(key1);
+        int length2 = symbolLength(key2);
+        int cmp = memcmp(&key1, &key2, length1 < length2 ? length1 : length2);
+        return cmp ? cmp : length1 - length2;
+    }
+};
+
+static void
+compressNames() {
+    std::string allNames = readOutputFile("loc-names.dat");
+    std::string indexBytes = readOutputFile("loc-index.dat");
+    std::vector<unsigned int> nameIndices(indexBytes.length() / 4);
+    if (!nameIndices.empty()) {
+        memcpy(&nameIndices[0], indexBytes.data(), nameIndices.size() * 4);
+    }
+
+    // Distinct names (there's one per index, but be safe if any are shared)
+    std::map<unsigned int, std::string> namesByOffset;
+    for (size_t i = 0; i < nameIndices.size(); i++) {
+        unsigned int offset = nameIndices[i];
+        size_t end = offset < allNames.length() ? allNames.find('\0', offset) : std::string::npos;
+        if (end == std::string::npos) {
+            fatal("Unterminated name at offset %u\n", offset);
+        }
+        if (end - offset >= ES_FSST_MAX_NAME_LENGTH) {
+            fatal("Name at offset %u is too long for the decode buffer in ESGeoNames\n", offset);
+        }
+        namesByOffset[offset] = allNames.substr(offset, end - offset);
+    }
+    std::vector<std::string> names;
+    for (std::map<unsigned int, std::string>::const_iterator iter = namesByOffset.begin(); iter != namesByOffset.end(); iter++) {
+        names.push_back(iter->second);
+    }
+
+    ESSymbolMap symbols;  // symbol => code
+    for (int round = 0; round < ES_FSST_NUM_ROUNDS; round++) {
+        ESSymbolCountContext context;
+        context.names = &names;
+        context.symbols = &symbols;
+        context.counts.resize(numThreads);
+        runInThreads(countSymbolsInThread, &context);
+        std::map<ESSymbolKey, long long> &count = context.counts[0];
+        for (int t = 1; t < numThreads; t++) {
+            for (std::map<ESSymbolKey, long long>::const_iterator iter = context.counts[t].begin(); iter != context.counts[t].end(); iter++) {
+                count[iter->first] += iter->second;
+            }
+        }
+        std::vector<ESSymbolCandidate> candidates;
+        for (std::map<ESSymbolKey, long long>::const_iterator iter = count.begin(); iter != count.end(); iter++) {
+            ESSymbolCandidate candidate;
+            candidate.key = iter->first;
+            candidate.gain = iter->second * symbolLength(iter->first);
+            candidates.push_back(candidate);
+        }
+        std::sort(candidates.begin(), candidates.end());
+        if (candidates.size() > ES_FSST_NUM_SYMBOL_CODES) {
+            candidates.resize(ES_FSST_NUM_SYMBOL_CODES);
+        }
+        symbols.clear();
+        for (size_t i = 0; i < candidates.size(); i++) {
+            symbols[candidates[i].key] = (int)i + 1;
+        }
+    }
+
+    // Encode
+    std::map<unsigned int, unsigned int> encodedOffsetByNameOffset;
+    std::string encoded;
+    std::vector<ESSymbolKey> parsed;
+    for (std::map<unsigned int, std::string>::const_iterator iter = namesByOffset.begin(); iter != namesByOffset.end(); iter++) {
+        encodedOffsetByNameOffset[iter->first] = (unsigned int)encoded.length();
+        parseName(iter->second, symbols, &parsed);
+        for (size_t i = 0; i < parsed.size(); i++) {
+            ESSymbolMap::const_iterator code = symbols.find(parsed[i]);
+            if (code != symbols.end()) {
+                encoded += (char)code->second;
+            } else {
+                if (symbolLength(parsed[i]) != 1) {
+                    fatal("Unknown multibyte symbol\n");
+                }
+                encoded += (char)255;
+                encoded += (char)parsed[i];
+            }
+        }
+        encoded += '\0';
+    }
+
+    // Symbol table, indexed by code
+    std::string output(256 * (ES_FSST_MAX_SYMBOL_LENGTH + 1), '\0');
+    for (ESSymbolMap::const_iterator iter = symbols.begin(); iter != symbols.end(); iter++) {
+        memcpy(&output[iter->second * ES_FSST_MAX_SYMBOL_LENGTH], &iter->first, ES_FSST_MAX_SYMBOL_LENGTH);
+        output[256 * ES_FSST_MAX_SYMBOL_LENGTH + iter->second] = (char)symbolLength(iter->first);
+    }
+    output += encoded;
+    writeFile("loc-names-fsst.dat", output.data(), output.length());
+
+    std::vector<unsigned int> encodedIndices;
+    for (size_t i = 0; i < nameIndices.size(); i++) {
+        encodedIndices.push_back(encodedOffsetByNameOffset[nameIndices[i]]);
+    }
+    writeArray("loc-index-fsst.dat", encodedIndices);
+
+    printf("Compressed %d bytes of names to %d (+ %d symbol table)\n",
+           (int)allNames.length(), (int)encoded.length(), 256 * (ES_FSST_MAX_SYMBOL_LENGTH + 1));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Stage 2b:  base files => loc-tzRaster.dat and loc-ccRaster.dat (makeRasters.pl)
+//
+// The arithmetic follows makeRasters.pl operation for operation, in double, so the results are the same.
+
+#define ES_RASTER_CELLS_PER_DEGREE 2
+#define ES_RASTER_BLOCK_SIZE 4
+#define ES_RASTER_TZ_BORDER 0x7fff
+#define ES_RASTER_CC_BORDER 0xff
+#define ES_RASTER_SLACK_KM 0.1       // Covers the float arithmetic in ESGeoNames
+#define ES_RASTER_EARTH_RADIUS 6371  // km, as in ESLocation::kmBetweenLatLong
+
+static const double rasterPi = 4 * atan2(1.0, 1.0);
+static const double kmPerDegree = ES_RASTER_EARTH_RADIUS * rasterPi / 180;
+
+struct ESRasterCity {
+    double                  longitude;
+    double                  latitude;
+    int                     tz;
+    int                     cc;
+    bool operator<(const ESRasterCity &other) const { return longitude < other.longitude; }
+};
+
+struct ESNearCity {
+    double                  distance;
+    int                     tz;
+    int                     cc;
+};
+
+static std::vector<ESRasterCity> rasterBands[180];  // Cities by 1-degree latitude band, each band sorted by longitude
+
+static double
+haversineKm(double lat1,
+            double long1,
+            double lat2,
+            double long2) {
+    lat1 = lat1 * rasterPi / 180;
+    long1 = long1 * rasterPi / 180;
+    lat2 = lat2 * rasterPi / 180;
+    long2 = long2 * rasterPi / 180;
+    double sinDLatOver2 = sin((lat2 - lat1) / 2);
+    double sinDLongOver2 = sin((long2 - long1) / 2);
+    double a = sinDLatOver2 * sinDLatOver2 + sinDLongOver2 * sinDLongOver2 * cos(lat1) * cos(lat2);
+    return 2 * ES_RASTER_EARTH_RADIUS * atan2(sqrt(a), sqrt(1 - a));
+}
+
+// First index in the (sorted) band with longitude >= longitude
+static int
+lowerBound(const std::vector<ESRasterCity> &band,
+           double                          longitude) {
+    int lo = 0;
+    int hi = (int)band.size();
+    while (lo < hi) {
+        int mid = (lo + hi) >> 1;
+        if (band[mid].longitude < longitude) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+// Distances to, and zones and countries of, every city within radius km of (latitude, longitude)
+static void
+citiesWithin(double                  latitude,
+             double                  longitude,
+             double                  radius,
+             std::vector<ESNearCity> *found) {
+    found->clear();
+    double radiusDegrees = radius / kmPerDegree;
+    int firstBand = (int)floor(latitude - radiusDegrees + 90);
+    int lastBand = (int)floor(latitude + radiusDegrees + 90);
+    if (firstBand < 0) {
+        firstBand = 0;
+    }
+    if (lastBand > 179) {
+        lastBand = 179;
+    }
+    double sinHalfAngle = sin(radius / ES_RASTER_EARTH_RADIUS / 2);
+    for (int b = firstBand; b <= lastBand; b++) {
+        const std::vector<ESRasterCity> &band = rasterBands[b];
+        if (band.empty()) {
+            continue;
+        }
+        // In the haversine, a >= cos(lat1) cos(lat2) sin^2(dLong/2), so only longitudes with that below
+        // sin^2(radius/2) can be close enough.  Use the smallest cosine in the band.
+        int bandSouth = abs(b - 90);
+        int bandNorth = abs(b - 89);
+        double minCos = cos((bandSouth > bandNorth ? bandSouth : bandNorth) * rasterPi / 180);
+        double ratio = sinHalfAngle * sinHalfAngle / (cos(latitude * rasterPi / 180) * minCos + 1e-12);
+        int ranges[3][2];
+        int numRanges = 0;
+        if (ratio >= 1) {
+            ranges[numRanges][0] = 0;
+            ranges[numRanges++][1] = (int)band.size();
+        } else {
+            double dLong = 2 * atan2(sqrt(ratio), sqrt(1 - ratio)) * 180 / rasterPi + 1e-6;
+            if (dLong >= 180) {
+                ranges[numRanges][0] = 0;
+                ranges[numRanges++][1] = (int)band.size();
+            } else {
+                double west = longitude - dLong;
+                double east = longitude + dLong;
+                if (west < -180) {
+                    ranges[numRanges][0] = lowerBound(band, west + 360);
+                    ranges[numRanges++][1] = (int)band.size();
+                    west = -180;
+                }
+                if (east > 180) {
+                    ranges[numRanges][0] = 0;
+                    ranges[numRanges++][1] = lowerBound(band, east - 360 + 1e-9);
+                    east = 180;
+                }
+                ranges[numRanges][0] = lowerBound(band, west);
+                ranges[numRanges++][1] = lowerBound(band, east + 1e-9);
+            }
+        }
+        for (int r = 0; r < numRanges; r++) {
+            for (int i = ranges[r][0]; i < ranges[r][1]; i++) {
+                const ESRasterCity &city = band[i];
+                double distance = haversineKm(latitude, longitude, city.latitude, city.longitude);
+                if (distance <= radius) {
+                    ESNearCity near = { distance, city.tz, city.cc };
+                    found->push_back(near);
+                }
+            }
+        }
+    }
+}
+
+#define ES_RASTER_NUM_ROWS (180 * ES_RASTER_CELLS_PER_DEGREE)
+#define ES_RASTER_NUM_COLUMNS (360 * ES_RASTER_CELLS_PER_DEGREE)
+
+struct ESRasterContext {
+    std::vector<int>        tzCells;  // [row * ES_RASTER_NUM_COLUMNS + column]
+    std::vector<int>        ccCells;
+    int                     nextRow;
+    pthread_mutex_t         lock;
+};
+
+// Each thread takes the next row not yet done.  The cells don't depend on the order they're done in:  the starting
+// radius for a cell only affects how many times the search doubles, not which cities are found within the final one.
+static void
+rasterRowsInThread(int  /*threadIndex*/,
+                   void *context) {
+    ESRasterContext *ctx = (ESRasterContext *)context;
+    double cellDegrees = 1.0 / ES_RASTER_CELLS_PER_DEGREE;
+    double lastClosest = 100;
+    std::vector<ESNearCity> near;
+    while (true) {
+        pthread_mutex_lock(&ctx->lock);
+        int row = ctx->nextRow++;
+        pthread_mutex_unlock(&ctx->lock);
+        if (row >= ES_RASTER_NUM_ROWS) {
+            break;
+        }
+        double south = -90 + row * cellDegrees;
+        double centerLatitude = south + cellDegrees / 2;
+        // The corners are the farthest points from the center (the north and south corners differ away from the equator)
+        double cellRadius = haversineKm(centerLatitude, 0, south, cellDegrees / 2);
+        double northRadius = haversineKm(centerLatitude, 0, south + cellDegrees, cellDegrees / 2);
+        if (northRadius > cellRadius) {
+            cellRadius = northRadius;
+        }
+        for (int column = 0; column < ES_RASTER_NUM_COLUMNS; column++) {
+            double centerLongitude = -180 + column * cellDegrees + cellDegrees / 2;
+            // Neighboring cells have similar closest distances, so start from the last one
+            double radius = lastClosest + 2 * cellRadius;
+            while (citiesWithin(centerLatitude, centerLongitude, radius, &near), near.empty()) {
+                radius *= 2;
+            }
+            double closest = 1E20;
+            for (size_t i = 0; i < near.size(); i++) {
+                if (near[i].distance < closest) {
+                    closest = near[i].distance;
+                }
+            }
+            lastClosest = closest;
+            double maxCandidateDistance = closest + 2 * cellRadius + ES_RASTER_SLACK_KM;
+            if (maxCandidateDistance > radius) {
+                citiesWithin(centerLatitude, centerLongitude, maxCandidateDistance, &near);
+            }
+            int tz = -1;
+            int cc = -1;
+            for (size_t i = 0; i < near.size(); i++) {
+                if (near[i].distance > maxCandidateDistance) {
+                    continue;
+                }
+                if (tz < 0) {
+                    tz = near[i].tz;
+                } else if (tz != near[i].tz) {
+                    tz = ES_RASTER_TZ_BORDER;
+                }
+                if (cc < 0) {
+                    cc = near[i].cc;
+                } else if (cc != near[i].cc) {
+                    cc = ES_RASTER_CC_BORDER;
+                }
+            }
+            ctx->tzCells[row * ES_RASTER_NUM_COLUMNS + column] = tz;
+            ctx->ccCells[row * ES_RASTER_NUM_COLUMNS + column] = cc;
+        }
+    }
+}
+
+static void
+makeBlocks(const std::vector<int>      &cells,
+           std::vector<unsigned short> *blockEntries,
+           std::vector<unsigned short> *details) {
+    int numBlockRows = ES_RASTER_NUM_ROWS / ES_RASTER_BLOCK_SIZE;
+    int numBlockColumns = ES_RASTER_NUM_COLUMNS / ES_RASTER_BLOCK_SIZE;
+    const int cellsPerBlock = ES_RASTER_BLOCK_SIZE * ES_RASTER_BLOCK_SIZE;
+    for (int blockRow = 0; blockRow < numBlockRows; blockRow++) {
+        for (int blockColumn = 0; blockColumn < numBlockColumns; blockColumn++) {
+            unsigned short values[cellsPerBlock];
+            bool uniform = true;
+            for (int r = 0; r < ES_RASTER_BLOCK_SIZE; r++) {
+                for (int c = 0; c < ES_RASTER_BLOCK_SIZE; c++) {
+                    unsigned short value = cells[(blockRow * ES_RASTER_BLOCK_SIZE + r) * ES_RASTER_NUM_COLUMNS + blockColumn * ES_RASTER_BLOCK_SIZE + c];
+                    values[r * ES_RASTER_BLOCK_SIZE + c] = value;
+                    uniform = uniform && value == values[0];
+                }
+            }
+            if (uniform) {
+                blockEntries->push_back(values[0]);
+            } else {
+                if (details->size() / cellsPerBlock >= 0x8000) {
+                    fatal("Too many detail blocks for the raster\n");
+                }
+                blockEntries->push_back((unsigned short)(0x8000 | (details->size() / cellsPerBlock)));
+                details->insert(details->end(), values, values + cellsPerBlock);
+            }
+        }
+    }
+}
+
+// Every city in loc-data.dat, in index order, with its zone from loc-tz.dat and its country from loc-region.dat and
+// loc-regiondesc.dat
+static void
+readRasterCities(std::vector<ESRasterCity> *cities,
+                 unsigned int              *tzNamesChecksum,
+                 std::string               *ccCodeBytes) {
+    std::string cityDataBytes = readOutputFile("loc-data.dat");
+    std::string tzBytes = readOutputFile("loc-tz.dat");
+    std::string checksumBytes = readOutputFile("loc-tzNames.sum");
+    std::string regionBytes = readOutputFile("loc-region.dat");
+    std::string regionDescBytes = readOutputFile("loc-regiondesc.dat");
+    *ccCodeBytes = readOutputFile("loc-ccCodes.dat");
+    std::string regionIndexBytesBytes;
+    int regionIndexBytes = 2;
+    if (readFile(outputPath("loc-regionIndexBytes.dat"), &regionIndexBytesBytes)) {
+        unsigned int value = 0;
+        if (regionIndexBytesBytes.length() == sizeof(value)) {
+            memcpy(&value, regionIndexBytesBytes.data(), sizeof(value));
+        }
+        if (value != 4) {
+            fatal("loc-regionIndexBytes.dat doesn't hold 4\n");
+        }
+        regionIndexBytes = 4;
+    }
+    const unsigned short *tzIndices = (const unsigned short *)tzBytes.data();
+    int numCities = (int)(tzBytes.length() / 2);
+    int numCountries = (int)(ccCodeBytes->length() / 2);
+    if (checksumBytes.length() != sizeof(*tzNamesChecksum)) {
+        fatal("loc-tzNames.sum is %d bytes\n", (int)checksumBytes.length());
+    }
+    memcpy(tzNamesChecksum, checksumBytes.data(), sizeof(*tzNamesChecksum));
+    if ((int)(cityDataBytes.length() / 12) != numCities) {
+        fatal("loc-data.dat has %d cities but loc-tz.dat has %d\n", (int)(cityDataBytes.length() / 12), numCities);
+    }
+    if ((int)(regionBytes.length() / regionIndexBytes) != numCities) {
+        fatal("loc-region.dat has %d cities but loc-tz.dat has %d\n", (int)(regionBytes.length() / regionIndexBytes), numCities);
+    }
+    if (numCountries >= ES_RASTER_CC_BORDER) {
+        fatal("Too many countries for the raster\n");
+    }
+
+    cities->clear();
+    for (int i = 0; i < numCities; i++) {
+        float latitude;
+        float longitude;
+        memcpy(&latitude, cityDataBytes.data() + 12 * i + 4, 4);
+        memcpy(&longitude, cityDataBytes.data() + 12 * i + 8, 4);
+        if (tzIndices[i] >= ES_RASTER_TZ_BORDER) {
+            fatal("Too many time zones for the raster\n");
+        }
+        int ccIndex;
+        if (regionIndexBytes == 4) {
+            ccIndex = ((const int *)regionDescBytes.data())[3 * ((const int *)regionBytes.data())[i]];
+        } else {
+            ccIndex = ((const unsigned short *)regionDescBytes.data())[3 * ((const unsigned short *)regionBytes.data())[i]];
+        }
+        ESRasterCity city = { longitude, latitude, tzIndices[i], ccIndex };
+        cities->push_back(city);
+    }
+}
+
+// The zone and country of every cell, [row * ES_RASTER_NUM_COLUMNS + column], for the given cities.  The cells
+// depend only on the set of cities, not their order.
+static void
+computeRasterCells(const std::vector<ESRasterCity> &cities,
+                   std::vector<int>                *tzCells,
+                   std::vector<int>                *ccCells) {
+    for (int b = 0; b < 180; b++) {
+        rasterBands[b].clear();
+    }
+    for (size_t i = 0; i < cities.size(); i++) {
+        int band = (int)floor(cities[i].latitude + 90.0);
+        band = band > 179 ? 179 : band < 0 ? 0 : band;
+        rasterBands[band].push_back(cities[i]);
+    }
+    for (int b = 0; b < 180; b++) {
+        std::stable_sort(rasterBands[b].begin(), rasterBands[b].end());
+    }
+
+    ESRasterContext context;
+    context.tzCells.resize(ES_RASTER_NUM_ROWS * ES_RASTER_NUM_COLUMNS);
+    context.ccCells.resize(ES_RASTER_NUM_ROWS * ES_RASTER_NUM_COLUMNS);
+    context.nextRow = 0;
+    pthread_mutex_init(&context.lock, NULL);
+    runInThreads(rasterRowsInThread, &context);
+    pthread_mutex_destroy(&context.lock);
+    tzCells->swap(context.tzCells);
+    ccCells->swap(context.ccCells);
+}
+
+static void
+makeRasters() {
+    std::vector<ESRasterCity> cities;
+    unsigned int tzNamesChecksum;
+    std::string ccCodeBytes;
+    readRasterCities(&cities, &tzNamesChecksum, &ccCodeBytes);
+    int numCountries = (int)(ccCodeBytes.length() / 2);
+    std::vector<int> tzCells;
+    std::vector<int> ccCells;
+    computeRasterCells(cities, &tzCells, &ccCells);
+    int numTZBorderCells = (int)std::count(tzCells.begin(), tzCells.end(), ES_RASTER_TZ_BORDER);
+    int numCCBorderCells = (int)std::count(ccCells.begin(), ccCells.end(), ES_RASTER_CC_BORDER);
+
+    std::vector<unsigned short> tzRaster;
+    tzRaster.push_back(ES_RASTER_CELLS_PER_DEGREE);
+    tzRaster.push_back(ES_RASTER_BLOCK_SIZE);
+    tzRaster.push_back(tzNamesChecksum & 0xffff);
+    tzRaster.push_back(tzNamesChecksum >> 16);
+    std::vector<unsigned short> blockEntries;
+    std::vector<unsigned short> details;
+    makeBlocks(tzCells, &blockEntries, &details);
+    tzRaster.insert(tzRaster.end(), blockEntries.begin(), blockEntries.end());
+    tzRaster.insert(tzRaster.end(), details.begin(), details.end());
+    writeArray("loc-tzRaster.dat", tzRaster);
+
+    std::vector<unsigned short> rowStarts;
+    std::vector<unsigned short> runStarts;
+    std::vector<unsigned char> runValues;
+    for (int row = 0; row < ES_RASTER_NUM_ROWS; row++) {
+        rowStarts.push_back((unsigned short)runStarts.size());
+        for (int column = 0; column < ES_RASTER_NUM_COLUMNS; column++) {
+            int value = ccCells[row * ES_RASTER_NUM_COLUMNS + column];
+            if (column == 0 || value != runValues.back()) {
+                runStarts.push_back((unsigned short)column);
+                runValues.push_back((unsigned char)value);
+            }
+        }
+    }
+    if (runStarts.size() >= 0x10000) {
+        fatal("Too many runs for the country raster\n");
+    }
+    rowStarts.push_back((unsigned short)runStarts.size());
+    std::vector<unsigned short> ccRaster;
+    ccRaster.push_back(ES_RASTER_CELLS_PER_DEGREE);
+    ccRaster.push_back((unsigned short)numCountries);
+    ccRaster.push_back((unsigned short)(runStarts.size() & 0xffff));
+    ccRaster.push_back((unsigned short)(runStarts.size() >> 16));
+    std::string output((const char *)&ccRaster[0], ccRaster.size() * 2);
+    output += ccCodeBytes;
+    output.append((const char *)&rowStarts[0], rowStarts.size() * 2);
+    output.append((const char *)&runStarts[0], runStarts.size() * 2);
+    output.append((const char *)&runValues[0], runValues.size());
+    writeFile("loc-ccRaster.dat", output.data(), output.length());
+
+    printf("%d cells, %d time zone border cells, %d country border cells\n",
+           ES_RASTER_NUM_ROWS * ES_RASTER_NUM_COLUMNS, numTZBorderCells, numCCBorderCells);
+    printf("loc-tzRaster.dat: %d blocks (%d with detail), %d bytes\n",
+           (int)blockEntries.size(), (int)(details.size() / (ES_RASTER_BLOCK_SIZE * ES_RASTER_BLOCK_SIZE)), (int)(tzRaster.size() * 2));
+    printf("loc-ccRaster.dat: %d runs, %d bytes\n", (int)runStarts.size(), (int)output.length());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Corrections => loc-overlay.dat, for the loc-*.dat files already built (see ESGeoNamesOverlayHeader in ESGeoNames.cpp)
+
+#define ES_OVERLAY_MAGIC 0x564f5345  // "ESOV"
+#define ES_OVERLAY_VERSION 2
+
+#define ES_OVERLAY_NAME       0x01
+#define ES_OVERLAY_POPULATION 0x02
+#define ES_OVERLAY_LOCATION   0x04
+#define ES_OVERLAY_TZ         0x08
+#define ES_OVERLAY_REGION     0x10
+#define ES_OVERLAY_SUPPRESS   0x20
+
+struct ESOverlayHeader {
+    unsigned int            magic;
+    unsigned int            version;
+    unsigned int            tzNamesChecksum;
+    int                     baseNumCities;
+    int                     baseNumRegionDescs;
+    int                     numRegionDescs;
+    int                     numCities;
+    int                     rasterCellsPerDegree;
+    int                     numTZRasterCells;
+    int                     numCCRasterCells;
+    int                     namesBytes;
+};
+
+struct ESOverlayCity {
+    int                     cityIndex;  // -1 to add a city
+    unsigned int            fields;
+    int                     nameOffset;
+    unsigned int            population;
+    float                   latitude;
+    float                   longitude;
+    int                     tzIndex;
+    int                     regionIndex;
+};
+
+struct ESOverlayRasterCell {
+    int                     cell;       // row * ES_RASTER_NUM_COLUMNS + column
+    int                     value;      // The cell's zone or country with the corrections applied, or the border value
+};
+
+// Splits a string of null-terminated names, as loc-tzNames.dat
+static std::vector<std::string>
+splitNames(const std::string &contents) {
+    std::vector<std::string> names;
+    size_t start = 0;
+    while (start < contents.length()) {
+        size_t end = contents.find('\0', start);
+        if (end == std::string::npos) {
+            end = contents.length();
+        }
+        names.push_back(contents.substr(start, end - start));
+        start = end + 1;
+    }
+    return names;
+}
+
+// What makeOverlay and makeAirports need of the dataset, to find cities, zones and regions by name
+struct ESBuiltFiles {
+    int                     numCities;
+    int                     regionIndexBytes;
+    std::string             regionBytes;
+    std::vector<int>        regionDescs;     // ccIndex, a1Index, a2Index for each region
+    std::vector<std::string> tzNames;
+    std::vector<std::string> ccCodes;
+    std::vector<std::string> a1Codes;        // "CC.A1"
+    std::vector<std::string> displayNames;
+    std::map<std::string, int> cityForKey;   // "displayName+CC+A1" => index, or -1 if more than one city has it
+
+    int                     regionIndexForCity(int cityIndex) const {
+        return regionIndexBytes == 4 ? ((const int *)regionBytes.data())[cityIndex]
+                                     : ((const unsigned short *)regionBytes.data())[cityIndex];
+    }
+};
+
+static void
+readBuiltFiles(ESBuiltFiles *base) {
+    std::string tzBytes = readOutputFile("loc-tz.dat");
+    base->numCities = (int)(tzBytes.length() / 2);
+    std::string indexBytesBytes;
+    base->regionIndexBytes = readFile(outputPath("loc-regionIndexBytes.dat"), &indexBytesBytes) ? 4 : 2;
+    base->regionBytes = readOutputFile("loc-region.dat");
+    std::string regionDescBytes = readOutputFile("loc-regiondesc.dat");
+    size_t numDescValues = regionDescBytes.length() / base->regionIndexBytes;
+    for (size_t i = 0; i < numDescValues; i++) {
+        base->regionDescs.push_back(base->regionIndexBytes == 4 ? ((const int *)regionDescBytes.data())[i]
+                                                                : ((const short *)regionDescBytes.data())[i]);
+    }
+    base->tzNames = splitNames(readOutputFile("loc-tzNames.dat"));
+    std::string ccCodeBytes = readOutputFile("loc-ccCodes.dat");
+    for (size_t i = 0; i + 1 < ccCodeBytes.length(); i += 2) {
+        base->ccCodes.push_back(ccCodeBytes.substr(i, 2));
+    }
+    base->a1Codes = splitNames(readOutputFile("loc-a1Codes.dat"));
+    std::string names = readOutputFile("loc-names.dat");
+    std::string indexBytes = readOutputFile("loc-index.dat");
+    const unsigned int *nameIndices = (const unsigned int *)indexBytes.data();
+    if ((int)(indexBytes.length() / 4) != base->numCities || (int)(base->regionBytes.length() / base->regionIndexBytes) != base->numCities) {
+        fatal("The loc-*.dat files don't agree on the number of cities\n");
+    }
+    for (int i = 0; i < base->numCities; i++) {
+        std::string name = names.c_str() + nameIndices[i];
+        size_t plus = name.rfind('+');
+        std::string displayName = plus == std::string::npos ? name : name.substr(plus + 1);
+        base->displayNames.push_back(displayName);
+        int a1Index = base->regionDescs[3 * base->regionIndexForCity(i) + 1];
+        std::string key = displayName + "+" + base->a1Codes[a1Index].substr(0, 2) + "+" + base->a1Codes[a1Index].substr(3);
+        std::map<std::string, int>::iterator iter = base->cityForKey.find(key);
+        if (iter == base->cityForKey.end()) {
+            base->cityForKey[key] = i;
+        } else {
+            iter->second = -1;
+        }
+    }
+}
+
+static int
+overlayCityIndex(const ESBuiltFiles &base,
+                 const std::string   &city) {
+    char *end;
+    long indx = strtol(city.c_str(), &end, 10);
+    if (!city.empty() && *end == '\0') {
+        if (indx < 0 || indx >= base.numCities) {
+            fatal("No city with index %ld\n", indx);
+        }
+        return (int)indx;
+    }
+    std::map<std::string, int>::const_iterator iter = base.cityForKey.find(city);
+    if (iter == base.cityForKey.end()) {
+        fatal("No city '%s'\n", city.c_str());
+    }
+    if (iter->second < 0) {
+        fatal("More than one city is '%s'; use its index\n", city.c_str());
+    }
+    return iter->second;
+}
+
+static int
+overlayTZIndex(const ESBuiltFiles &base,
+               const std::string   &tzName) {
+    std::vector<std::string>::const_iterator iter = std::find(base.tzNames.begin(), base.tzNames.end(), tzName);
+    if (iter == base.tzNames.end()) {
+        fatal("Time zone '%s' isn't in loc-tzNames.dat; a new zone needs a rebuild\n", tzName.c_str());
+    }
+    return (int)(iter - base.tzNames.begin());
+}
+
+// The region for the given country and admin1 codes (with no admin2), adding one to the overlay if the dataset has none
+static int
+overlayRegionIndex(const ESBuiltFiles &base,
+                   const std::string   &cc,
+                   const std::string   &a1,
+                   std::vector<int>    *addedRegionDescs) {
+    std::vector<std::string>::const_iterator ccIter = std::find(base.ccCodes.begin(), base.ccCodes.end(), cc);
+    std::vector<std::string>::const_iterator a1Iter = std::find(base.a1Codes.begin(), base.a1Codes.end(), cc + "." + a1);
+    if (ccIter == base.ccCodes.end() || a1Iter == base.a1Codes.end()) {
+        fatal("No region '%s.%s' in the loc-*.dat files\n", cc.c_str(), a1.c_str());
+    }
+    int desc[3] = { (int)(ccIter - base.ccCodes.begin()), (int)(a1Iter - base.a1Codes.begin()), -1 };
+    int numBaseRegions = (int)(base.regionDescs.size() / 3);
+    for (int r = 0; r < numBaseRegions; r++) {
+        if (std::equal(desc, desc + 3, &base.regionDescs[3 * r])) {
+            return r;
+        }
+    }
+    for (size_t r = 0; r < addedRegionDescs->size() / 3; r++) {
+        if (std::equal(desc, desc + 3, &(*addedRegionDescs)[3 * r])) {
+            return numBaseRegions + (int)r;
+        }
+    }
+    addedRegionDescs->insert(addedRegionDescs->end(), desc, desc + 3);
+    return numBaseRegions + (int)(addedRegionDescs->size() / 3) - 1;
+}
+
+static unsigned int
+overlayPopulation(const std::string &population) {
+    unsigned int value = (unsigned int)strtoul(population.c_str(), NULL, 10);
+    return value < 3 ? 3 : value;  // As the base files, so log2 doesn't go negative
+}
+
+// The raster cells whose zone or country the corrections change, so ESGeoNames can go on using the rasters with the
+// overlay:  the rasters are made again from the cities as corrected, and compared with those from the cities as built
+static void
+overlayRasterCells(const ESBuiltFiles                &base,
+                   const std::vector<ESOverlayCity>  &overlayCities,
+                   const std::vector<int>            &addedRegionDescs,
+                   std::vector<ESOverlayRasterCell>  *tzCellsReturn,
+                   std::vector<ESOverlayRasterCell>  *ccCellsReturn) {
+    std::vector<ESRasterCity> cities;
+    unsigned int tzNamesChecksum;
+    std::string ccCodeBytes;
+    readRasterCities(&cities, &tzNamesChecksum, &ccCodeBytes);
+    std::vector<int> baseTZCells;
+    std::vector<int> baseCCCells;
+    computeRasterCells(cities, &baseTZCells, &baseCCCells);
+
+    int numBaseRegions = (int)(base.regionDescs.size() / 3);
+    std::vector<bool> suppressed(cities.size());
+    for (size_t i = 0; i < overlayCities.size(); i++) {
+        const ESOverlayCity &overlayCity = overlayCities[i];
+        if (overlayCity.cityIndex < 0) {
+            cities.push_back(ESRasterCity());
+            suppressed.push_back(false);
+        }
+        ESRasterCity &city = overlayCity.cityIndex < 0 ? cities.back() : cities[overlayCity.cityIndex];
+        if (overlayCity.fields & ES_OVERLAY_LOCATION) {
+            city.latitude = overlayCity.latitude;
+            city.longitude = overlayCity.longitude;
+        }
+        if (overlayCity.fields & ES_OVERLAY_TZ) {
+            city.tz = overlayCity.tzIndex;
+        }
+        if (overlayCity.fields & ES_OVERLAY_REGION) {
+            int r = overlayCity.regionIndex;
+            city.cc = r < numBaseRegions ? base.regionDescs[3 * r] : addedRegionDescs[3 * (r - numBaseRegions)];
+        }
+        if (overlayCity.fields & ES_OVERLAY_SUPPRESS) {
+            suppressed[overlayCity.cityIndex] = true;
+        }
+    }
+    std::vector<ESRasterCity> correctedCities;
+    for (size_t i = 0; i < cities.size(); i++) {
+        if (!suppressed[i]) {
+            correctedCities.push_back(cities[i]);
+        }
+    }
+    std::vector<int> tzCells;
+    std::vector<int> ccCells;
+    computeRasterCells(correctedCities, &tzCells, &ccCells);
+    for (int cell = 0; cell < ES_RASTER_NUM_ROWS * ES_RASTER_NUM_COLUMNS; cell++) {
+        if (tzCells[cell] != baseTZCells[cell]) {
+            ESOverlayRasterCell rasterCell = { cell, tzCells[cell] };
+            tzCellsReturn->push_back(rasterCell);
+        }
+        if (ccCells[cell] != baseCCCells[cell]) {
+            ESOverlayRasterCell rasterCell = { cell, ccCells[cell] };
+            ccCellsReturn->push_back(rasterCell);
+        }
+    }
+}
+
+// The corrections file has one correction per line, its fields separated by tabs ('#' starts a comment line):
+//   suppress    city
+//   population  city  population
+//   location    city  latitude  longitude
+//   tz          city  tzName
+//   name        city  name
+//   region      city  CC  A1
+//   add         name  latitude  longitude  population  tzName  CC  A1
+// where city is an index, or "displayName+CC+A1" if that's unique, and a name is in the form of loc-names.dat
+// ("searchName+displayName", or just one name if they're the same).  Lines for the same city are combined.
+static void
+makeOverlay(const char *correctionsFile) {
+    ESBuiltFiles base;
+    readBuiltFiles(&base);
+    std::string contents = readRequiredFile(correctionsFile);
+    std::vector<ESOverlayCity> cities;
+    std::map<int, size_t> recordForCity;
+    std::string names;
+    std::vector<int> addedRegionDescs;
+    std::vector<std::string> fields;
+    const char *end = contents.data() + contents.length();
+    for (const char *line = contents.data(); line < end; ) {
+        const char *newline = (const char *)memchr(line, '\n', end - line);
+        const char *lineEnd = newline ? newline : end;
+        splitLine(line, lineEnd - line, '\t', &fields);
+        line = lineEnd + 1;
+        if (fields.empty() || fields[0].empty() || fields[0][0] == '#') {
+            continue;
+        }
+        const std::string &kind = fields[0];
+        size_t numFields = kind == "suppress" ? 2 : kind == "add" ? 8 : kind == "location" || kind == "region" ? 4 : 3;
+        if (fields.size() != numFields) {
+            fatal("Expected %d fields in '%s' line\n", (int)numFields, kind.c_str());
+        }
+        ESOverlayCity *city;
+        if (kind == "add") {
+            cities.push_back(ESOverlayCity());
+            city = &cities.back();
+            memset(city, 0, sizeof(*city));
+            city->cityIndex = -1;
+            city->fields = ES_OVERLAY_NAME | ES_OVERLAY_POPULATION | ES_OVERLAY_LOCATION | ES_OVERLAY_TZ | ES_OVERLAY_REGION;
+            city->nameOffset = (int)names.length();
+            names += fields[1];
+            names += '\0';
+            city->latitude = (float)strtod(fields[2].c_str(), NULL);
+            city->longitude = (float)strtod(fields[3].c_str(), NULL);
+            city->population = overlayPopulation(fields[4]);
+            city->tzIndex = overlayTZIndex(base, fields[5]);
+            city->regionIndex = overlayRegionIndex(base, fields[6], fields[7], &addedRegionDescs);
+            continue;
+        }
+        int cityIndex = overlayCityIndex(base, fields[1]);
+        std::map<int, size_t>::iterator record = recordForCity.find(cityIndex);
+        if (record == recordForCity.end()) {
+            record = recordForCity.insert(std::make_pair(cityIndex, cities.size())).first;
+            cities.push_back(ESOverlayCity());
+            memset(&cities.back(), 0, sizeof(ESOverlayCity));
+            cities.back().cityIndex = cityIndex;
+        }
+        city = &cities[record->second];
+        if (kind == "suppress") {
+            city->fields |= ES_OVERLAY_SUPPRESS;
+        } else if (kind == "population") {
+            city->fields |= ES_OVERLAY_POPULATION;
+            city->population = overlayPopulation(fields[2]);
+        } else if (kind == "location") {
+            city->fields |= ES_OVERLAY_LOCATION;
+            city->latitude = (float)strtod(fields[2].c_str(), NULL);
+            city->longitude = (float)strtod(fields[3].c_str(), NULL);
+        } else if (kind == "tz") {
+            city->fields |= ES_OVERLAY_TZ;
+            city->tzIndex = overlayTZIndex(base, fields[2]);
+        } else if (kind == "name") {
+            city->fields |= ES_OVERLAY_NAME;
+            city->nameOffset = (int)names.length();
+            names += fields[2];
+            names += '\0';
+        } else if (kind == "region") {
+            city->fields |= ES_OVERLAY_REGION;
+            city->regionIndex = overlayRegionIndex(base, fields[2], fields[3], &addedRegionDescs);
+        } else {
+            fatal("Unknown correction '%s'\n", kind.c_str());
+        }
+    }
+
+    ESOverlayHeader header;
+    std::string checksumBytes = readOutputFile("loc-tzNames.sum");
+    if (checksumBytes.length() != sizeof(header.tzNamesChecksum)) {
+        fatal("loc-tzNames.sum is %d bytes\n", (int)checksumBytes.length());
+    }
+    header.magic = ES_OVERLAY_MAGIC;
+    header.version = ES_OVERLAY_VERSION;
+    memcpy(&header.tzNamesChecksum, checksumBytes.data(), sizeof(header.tzNamesChecksum));
+    header.baseNumCities = base.numCities;
+    header.baseNumRegionDescs = (int)(base.regionDescs.size() / 3);
+    header.numRegionDescs = (int)(addedRegionDescs.size() / 3);
+    header.numCities = (int)cities.size();
+    std::vector<ESOverlayRasterCell> tzCells;
+    std::vector<ESOverlayRasterCell> ccCells;
+    overlayRasterCells(base, cities, addedRegionDescs, &tzCells, &ccCells);
+    header.rasterCellsPerDegree = ES_RASTER_CELLS_PER_DEGREE;
+    header.numTZRasterCells = (int)tzCells.size();
+    header.numCCRasterCells = (int)ccCells.size();
+    header.namesBytes = (int)names.length();
+    std::string output((const char *)&header, sizeof(header));
+    if (!addedRegionDescs.empty()) {
+        output.append((const char *)&addedRegionDescs[0], addedRegionDescs.size() * sizeof(int));
+    }
+    if (!cities.empty()) {
+        output.append((const char *)&cities[0], cities.size() * sizeof(ESOverlayCity));
+    }
+    if (!tzCells.empty()) {
+        output.append((const char *)&tzCells[0], tzCells.size() * sizeof(ESOverlayRasterCell));
+    }
+    if (!ccCells.empty()) {
+        output.append((const char *)&ccCells[0], ccCells.size() * sizeof(ESOverlayRasterCell));
+    }
+    output += names;
+    writeFile("loc-overlay.dat", output.data(), output.length());
+    printf("loc-overlay.dat: %d corrections, %d regions added, %d time zone and %d country raster cells changed, %d bytes\n",
+           header.numCities, header.numRegionDescs, header.numTZRasterCells, header.numCCRasterCells, (int)output.length());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// airportCodes.txt => loc-airports.dat, for the loc-*.dat files already built (see ESGeoNamesData::readAirports)
+//
+// The file is a perfect-hash table from IATA code to the city the airport serves:
+//   unsigned int numCities       of loc-data.dat, so a table left over from another build is ignored
+//   unsigned int hashBits        the table has 1 << hashBits entries
+//   unsigned int hashSeed
+//   then for each entry, unsigned int code (the letters packed low byte first, 0 if empty) and int cityIndex
+// A code is found at slot airportHash(code), and nowhere else.
+
+#define ES_AIRPORT_CITY_KM 100      // An airport's city, by name, must be this close to it
+#define ES_AIRPORT_NEARBY_KM 50     // If there's no city of that name, the most populous city this close
+#define ES_AIRPORT_MAX_SEEDS 100000  // Before trying a bigger table
+
+// As ESGeoNamesData::airportSlot
+static unsigned int
+airportHash(unsigned int code,
+            unsigned int seed,
+            unsigned int hashBits) {
+    return ((code ^ seed) * 0x9e3779b1u) >> (32 - hashBits);
+}
+
+static unsigned int
+airportCode(const std::string &code) {
+    if (code.length() != 3) {
+        return 0;
+    }
+    unsigned int packed = 0;
+    for (int i = 0; i < 3; i++) {
+        if (code[i] < 'A' || code[i] > 'Z') {
+            return 0;
+        }
+        packed |= (unsigned int)code[i] << (8 * i);
+    }
+    return packed;
+}
+
+static bool
+sameName(const std::string &name1,
+         const std::string &name2) {
+    return name1.length() == name2.length() && strncasecmp(name1.c_str(), name2.c_str(), name1.length()) == 0;
+}
+
+// The city an airport serves:  the most populous city nearby with the name of its city, or failing that, the most
+// populous city nearby, or failing that, the closest city in its country
+static int
+airportCityIndex(const ESBuiltFiles &base,
+                 const std::string  &cityBytes,
+                 const std::string  &cityName,
+                 const std::string  &cc,
+                 double             latitude,
+                 double             longitude) {
+    int namedCity = -1;
+    unsigned int namedPopulation = 0;
+    int nearbyCity = -1;
+    unsigned int nearbyPopulation = 0;
+    int closestCity = -1;
+    double closestKm = 0;
+    for (int i = 0; i < base.numCities; i++) {
+        int ccIndex = base.regionDescs[3 * base.regionIndexForCity(i)];
+        if (ccIndex < 0 || ccIndex >= (int)base.ccCodes.size() || base.ccCodes[ccIndex] != cc) {
+            continue;
+        }
+        unsigned int population;
+        float cityLatitude;
+        float cityLongitude;
+        memcpy(&population, cityBytes.data() + 12 * i, 4);
+        memcpy(&cityLatitude, cityBytes.data() + 12 * i + 4, 4);
+        memcpy(&cityLongitude, cityBytes.data() + 12 * i + 8, 4);
+        double km = haversineKm(latitude, longitude, cityLatitude, cityLongitude);
+        if (closestCity < 0 || km < closestKm) {
+            closestCity = i;
+            closestKm = km;
+        }
+        if (km < ES_AIRPORT_CITY_KM && population > namedPopulation && sameName(base.displayNames[i], cityName)) {
+            namedCity = i;
+            namedPopulation = population;
+        }
+        if (km < ES_AIRPORT_NEARBY_KM && population > nearbyPopulation) {
+            nearbyCity = i;
+            nearbyPopulation = population;
+        }
+    }
+    return namedCity >= 0 ? namedCity : nearbyCity >= 0 ? nearbyCity : closestCity;
+}
+
+// The entry for each slot (-1 if empty) if no two codes hash to the same one with this seed
+static bool
+airportSlots(const std::vector<unsigned int> &codes,
+             unsigned int                    seed,
+             unsigned int                    hashBits,
+             std::vector<int>                *slots) {
+    slots->assign(1u << hashBits, -1);
+    for (size_t i = 0; i < codes.size(); i++) {
+        int &slot = (*slots)[airportHash(codes[i], seed, hashBits)];
+        if (slot >= 0) {
+            return false;
+        }
+        slot = (int)i;
+    }
+    return true;
+}
+
+// airportCodes.txt has one airport per line, "CODE Name<tab>City[, State]<tab>CC<tab>latitude<tab>longitude<tab>tzName",
+// with runs of tabs in places, and a '#' comment line at the top
+static void
+makeAirports() {
+    std::string contents;
+    if (!readFile("airportCodes.txt", &contents)) {
+        printf("No airportCodes.txt; loc-airports.dat not built\n");
+        return;
+    }
+    ESBuiltFiles base;
+    readBuiltFiles(&base);
+    std::string cityBytes = readOutputFile("loc-data.dat");
+    if ((int)(cityBytes.length() / 12) != base.numCities) {
+        fatal("loc-data.dat has %d cities but loc-tz.dat has %d\n", (int)(cityBytes.length() / 12), base.numCities);
+    }
+    std::vector<unsigned int> codes;
+    std::vector<int> cityIndices;
+    std::vector<std::string> rawFields;
+    std::vector<std::string> fields;
+    const char *end = contents.data() + contents.length();
+    for (const char *line = contents.data(); line < end; ) {
+        const char *newline = (const char *)memchr(line, '\n', end - line);
+        const char *lineEnd = newline ? newline : end;
+        splitLine(line, lineEnd - line, '\t', &rawFields);
+        line = lineEnd + 1;
+        if (rawFields.empty() || rawFields[0].empty() || rawFields[0][0] == '#') {
+            continue;
+        }
+        fields.clear();
+        for (size_t i = 0; i < rawFields.size(); i++) {
+            if (!rawFields[i].empty()) {
+                fields.push_back(rawFields[i]);
+            }
+        }
+        unsigned int code = airportCode(fields[0].substr(0, fields[0].find(' ')));
+        if (fields.size() < 5 || !code) {
+            fatal("Bad airportCodes.txt line: %s\n", rawFields[0].c_str());
+        }
+        if (std::find(codes.begin(), codes.end(), code) != codes.end()) {
+            fatal("Airport code %.3s is in airportCodes.txt more than once\n", fields[0].c_str());
+        }
+        std::string cityName = fields[1].substr(0, fields[1].find(','));
+        int cityIndex = airportCityIndex(base, cityBytes, cityName, fields[2],
+                                         strtod(fields[3].c_str(), NULL), strtod(fields[4].c_str(), NULL));
+        if (cityIndex < 0) {
+            fprintf(stderr, "No city in %s for airport %.3s\n", fields[2].c_str(), fields[0].c_str());
+            continue;
+        }
+        if (!sameName(base.displayNames[cityIndex], cityName)) {
+            printf("Airport %.3s serves %s, not %s\n", fields[0].c_str(), base.displayNames[cityIndex].c_str(), cityName.c_str());
+        }
+        codes.push_back(code);
+        cityIndices.push_back(cityIndex);
+    }
+
+    // Find a seed for which no two codes share a slot, at a load of no more than a half, then a quarter, ...
+    unsigned int hashBits = 1;
+    while ((1u << hashBits) < 2 * codes.size()) {
+        hashBits++;
+    }
+    unsigned int seed = 0;
+    std::vector<int> slots;
+    while (!airportSlots(codes, seed, hashBits, &slots)) {
+        if (++seed == ES_AIRPORT_MAX_SEEDS) {
+            seed = 0;
+            if (++hashBits >= 24) {
+                fatal("Couldn't find a perfect hash for the airport codes\n");
+            }
+        }
+    }
+
+    std::vector<unsigned int> output;
+    output.push_back((unsigned int)base.numCities);
+    output.push_back(hashBits);
+    output.push_back(seed);
+    for (size_t s = 0; s < slots.size(); s++) {
+        output.push_back(slots[s] < 0 ? 0 : codes[slots[s]]);
+        output.push_back(slots[s] < 0 ? 0 : (unsigned int)cityIndices[slots[s]]);
+    }
+    writeArray("loc-airports.dat", output);
+    printf("loc-airports.dat: %d airports in %d slots (seed %u), %d bytes\n",
+           (int)codes.size(), (int)slots.size(), seed, (int)(output.size() * sizeof(unsigned int)));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// loc-*.dat files => ESGeoNamesHashTables.hpp, minimal perfect-hash tables compiled into ESGeoNames
+//
+// Each table maps a key (a country code, an alias or name of a country, an admin1 code "CC.A1", or an Olson zone
+// name) to its index in the loc-*.dat file it came from.  A key's hash picks a bucket, the bucket's displacement
+// picks the key's slot, and each of the n keys has a slot of its own out of n, so a lookup is one probe and one
+// compare.  The keys are hashed ASCII-case-folded, so the tables serve case-insensitive lookups as well.
+
+#define ES_HASH_KEYS_PER_BUCKET 2
+#define ES_HASH_MAX_DISPLACEMENT 0xffff  // Displacements are unsigned shorts
+
+// Country spellings, besides the names in loc-cc.dat, that address books use
+static const struct {
+    const char              *alias;
+    const char              *code;
+} countryAliases[] = {
+    { "USA",                      "US" },
+    { "U.S.A.",                   "US" },
+    { "U.S.",                     "US" },
+    { "United States of America", "US" },
+    { "UK",                       "GB" },
+    { "U.K.",                     "GB" },
+    { "Great Britain",            "GB" },
+};
+
+// As esGeoNamesHashKey in ESGeoNames.cpp:  FNV-1a over the key with ASCII letters upper-cased
+static unsigned int
+hashKey(const std::string &key) {
+    unsigned int hash = 2166136261u;
+    for (size_t i = 0; i < key.length(); i++) {
+        unsigned char c = (unsigned char)key[i];
+        if (c >= 'a' && c <= 'z') {
+            c -= 'a' - 'A';
+        }
+        hash = (hash ^ c) * 16777619u;
+    }
+    return hash;
+}
+
+// As esGeoNamesHashMix in ESGeoNames.cpp (murmur3's finalizer)
+static unsigned int
+hashMix(unsigned int hash) {
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6bu;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35u;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+static std::string
+upperCased(const std::string &key) {
+    std::string upper = key;
+    for (size_t i = 0; i < upper.length(); i++) {
+        if (upper[i] >= 'a' && upper[i] <= 'z') {
+            upper[i] -= 'a' - 'A';
+        }
+    }
+    return upper;
+}
+
+struct ESHashTable {
+    std::vector<std::string> keys;          // In slot order
+    std::vector<int>        indices;        // Likewise
+    std::vector<unsigned int> displacements;  // One per bucket
+};
+
+// Places the keys (unique when case-folded) by hash and displacement, the buckets with the most keys first
+static void
+makeHashTable(const std::vector<std::string> &keys,
+              const std::vector<int>         &indices,
+              const char                     *what,
+              ESHashTable                    *table) {
+    size_t numKeys = keys.size();
+    size_t numBuckets = numKeys / ES_HASH_KEYS_PER_BUCKET + 1;
+    std::vector<std::vector<size_t> > buckets(numBuckets);
+    std::map<std::string, size_t> seen;
+    for (size_t k = 0; k < numKeys; k++) {
+        if (!seen.insert(std::make_pair(upperCased(keys[k]), k)).second) {
+            fatal("%s '%s' is in the table twice\n", what, keys[k].c_str());
+        }
+        buckets[hashMix(hashKey(keys[k])) % numBuckets].push_back(k);
+    }
+    std::vector<std::pair<size_t, size_t> > sizes;  // (numKeys - size, bucket), so a sort puts the biggest first, then in bucket order
+    for (size_t b = 0; b < numBuckets; b++) {
+        sizes.push_back(std::make_pair(numKeys - buckets[b].size(), b));
+    }
+    std::sort(sizes.begin(), sizes.end());
+    table->keys.assign(numKeys, std::string());
+    table->indices.assign(numKeys, -1);
+    table->displacements.assign(numBuckets, 0);
+    std::vector<bool> taken(numKeys, false);
+    std::vector<size_t> slots;
+    for (size_t i = 0; i < numBuckets; i++) {
+        const std::vector<size_t> &bucket = buckets[sizes[i].second];
+        if (bucket.empty()) {
+            break;
+        }
+        unsigned int displacement;
+        for (displacement = 1; displacement <= ES_HASH_MAX_DISPLACEMENT; displacement++) {
+            slots.clear();
+            for (size_t j = 0; j < bucket.size(); j++) {
+                size_t slot = hashMix(hashKey(keys[bucket[j]]) ^ displacement) % numKeys;
+                if (taken[slot] || std::find(slots.begin(), slots.end(), slot) != slots.end()) {
+                    break;
+                }
+                slots.push_back(slot);
+            }
+            if (slots.size() == bucket.size()) {
+                break;
+            }
+        }
+        if (displacement > ES_HASH_MAX_DISPLACEMENT) {
+            fatal("Couldn't place the %s keys; try fewer keys per bucket\n", what);
+        }
+        table->displacements[sizes[i].second] = displacement;
+        for (size_t j = 0; j < bucket.size(); j++) {
+            taken[slots[j]] = true;
+            table->keys[slots[j]] = keys[bucket[j]];
+            table->indices[slots[j]] = indices[bucket[j]];
+        }
+    }
+}
+
+// A C string literal for key, with any byte that isn't printable ASCII (e.g., of UTF-8) as an octal escape
+static std::string
+cStringLiteral(const std::string &key) {
+    std::string literal = "\"";
+    for (size_t i = 0; i < key.length(); i++) {
+        unsigned char c = (unsigned char)key[i];
+        if (c == '"' || c == '\\') {
+            literal += '\\';
+            literal += (char)c;
+        } else if (c < ' ' || c > '~') {
+            char escape[8];
+            snprintf(escape, sizeof(escape), "\\%03o", c);
+            literal += escape;
+        } else {
+            literal += (char)c;
+        }
+    }
+    return literal + "\"";
+}
+
+static void
+writeHashTable(FILE                           *fp,
+               const char                     *name,
+               const char                     *what,
+               const std::vector<std::string> &keys,
+               const std::vector<int>         &indices) {
+    ESHashTable table;
+    makeHashTable(keys, indices, what, &table);
+    fprintf(fp, "\n// %s:  %d\n", what, (int)keys.size());
+    fprintf(fp, "static const unsigned short esGeoNames%sDisplacements[%d] = {", name, (int)table.displacements.size());
+    for (size_t b = 0; b < table.displacements.size(); b++) {
+        fprintf(fp, "%s%u,", b % 16 ? " " : "\n    ", table.displacements[b]);
+    }
+    fprintf(fp, "\n};\n");
+    fprintf(fp, "static const ESGeoNamesHashEntry esGeoNames%sEntries[%d] = {\n", name, (int)(keys.empty() ? 1 : keys.size()));
+    for (size_t k = 0; k < table.keys.size(); k++) {
+        fprintf(fp, "    { %s, %d },\n", cStringLiteral(table.keys[k]).c_str(), table.indices[k]);
+    }
+    if (keys.empty()) {
+        fprintf(fp, "    { \"\", -1 },\n");
+    }
+    fprintf(fp, "};\n");
+    fprintf(fp, "static const ESGeoNamesHashTable esGeoNames%sHash = { %d, %d, esGeoNames%sDisplacements, esGeoNames%sEntries };\n",
+            name, (int)keys.size(), (int)table.displacements.size(), name, name);
+}
+
+// The aliases come last in the alias table; everything else in each table is in file order
+static void
+makeHashHeader(const char *headerFile) {
+    ESBuiltFiles base;
+    readBuiltFiles(&base);
+    std::vector<std::string> ccNames = splitNames(readOutputFile("loc-cc.dat"));
+    std::string checksumBytes = readOutputFile("loc-tzNames.sum");
+    unsigned int tzNamesChecksum;
+    if (checksumBytes.length() != sizeof(tzNamesChecksum)) {
+        fatal("loc-tzNames.sum is %d bytes\n", (int)checksumBytes.length());
+    }
+    memcpy(&tzNamesChecksum, checksumBytes.data(), sizeof(tzNamesChecksum));
+
+    std::vector<int> ccIndices;
+    for (size_t i = 0; i < base.ccCodes.size(); i++) {
+        ccIndices.push_back((int)i);
+    }
+    std::vector<std::string> aliases;
+    std::vector<int> aliasIndices;
+    std::map<std::string, bool> aliasSeen;
+    for (size_t i = 0; i < ccNames.size() && i < base.ccCodes.size(); i++) {
+        if (!ccNames[i].empty() && aliasSeen.insert(std::make_pair(upperCased(ccNames[i]), true)).second) {
+            aliases.push_back(ccNames[i]);
+            aliasIndices.push_back((int)i);
+        }
+    }
+    for (size_t i = 0; i < sizeof(countryAliases) / sizeof(countryAliases[0]); i++) {
+        std::vector<std::string>::const_iterator iter = std::find(base.ccCodes.begin(), base.ccCodes.end(), std::string(countryAliases[i].code));
+        if (iter != base.ccCodes.end() && aliasSeen.insert(std::make_pair(upperCased(countryAliases[i].alias), true)).second) {
+            aliases.push_back(countryAliases[i].alias);
+            aliasIndices.push_back((int)(iter - base.ccCodes.begin()));
+        }
+    }
+    std::vector<int> a1Indices;
+    for (size_t i = 0; i < base.a1Codes.size(); i++) {
+        a1Indices.push_back((int)i);
+    }
+    std::vector<int> tzIndices;
+    for (size_t i = 0; i < base.tzNames.size(); i++) {
+        tzIndices.push_back((int)i);
+    }
+
+    FILE *fp = fopen(headerFile, "w");
+    if (!fp) {
+        fatal("Couldn't write %s: %s\n", headerFile, strerror(errno));
+    }
+    fprintf(fp, "//\n"
+                "//  ESGeoNamesHashTables.hpp\n"
+                "//\n"
+                "//  Generated by data/buildLocData -hashHeader from the loc-*.dat files; don't edit.\n"
+                "//  Copyright Emerald Sequoia LLC 2011. All rights reserved.\n"
+                "//\n"
+                "\n"
+                "// Minimal perfect-hash tables from key to index in the loc-*.dat files whose loc-tzNames.dat has the checksum\n"
+                "// below (see makeHashHeader in data/buildLocData.cpp).  ESGeoNamesData checks each table against the files it\n"
+                "// loads, and falls back to a linear scan for any that don't match.  Include only in ESGeoNames.cpp.\n"
+                "\n"
+                "#ifndef _ESGEONAMESHASHTABLES_HPP_\n"
+                "#define _ESGEONAMESHASHTABLES_HPP_\n"
+                "\n"
+                "#define ES_GEONAMES_HASHED_TZ_NAMES_CHECKSUM %uU\n"
+                "#define ES_GEONAMES_HASHED_NUM_TZ_NAMES %d\n"
+                "#define ES_GEONAMES_HASHED_NUM_CC_CODES %d\n"
+                "#define ES_GEONAMES_HASHED_NUM_A1_CODES %d\n"
+                "\n"
+                "struct ESGeoNamesHashEntry {\n"
+                "    const char              *key;\n"
+                "    int                     index;\n"
+                "};\n"
+                "\n"
+                "struct ESGeoNamesHashTable {\n"
+                "    int                     numEntries;\n"
+                "    int                     numBuckets;\n"
+                "    const unsigned short    *displacements;  // One per bucket\n"
+                "    const ESGeoNamesHashEntry *entries;       // In slot order\n"
+                "};\n",
+            tzNamesChecksum, (int)base.tzNames.size(), (int)base.ccCodes.size(), (int)base.a1Codes.size());
+    writeHashTable(fp, "CCCode", "Country codes (loc-ccCodes.dat)", base.ccCodes, ccIndices);
+    writeHashTable(fp, "CCAlias", "Country names (loc-cc.dat) and aliases, to the index of the country's code", aliases, aliasIndices);
+    writeHashTable(fp, "A1Code", "Admin1 codes (loc-a1Codes.dat)", base.a1Codes, a1Indices);
+    writeHashTable(fp, "TZName", "Olson zone names (loc-tzNames.dat)", base.tzNames, tzIndices);
+    fprintf(fp, "\n#endif  // _ESGEONAMESHASHTABLES_HPP_\n");
+    if (fclose(fp) != 0) {
+        fatal("Couldn't write %s: %s\n", headerFile, strerror(errno));
+    }
+    printf("%s: %d country codes, %d country names and aliases, %d admin1 codes, %d zones\n", headerFile,
+           (int)base.ccCodes.size(), (int)aliases.size(), (int)base.a1Codes.size(), (int)base.tzNames.size());
+}
+
+int
+main(int  argc,
+     char **argv) {
+    numThreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    bool derivedOnly = false;
+    const char *correctionsFile = NULL;
+    const char *hashHeaderFile = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+            numThreads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-derivedOnly") == 0) {
+            derivedOnly = true;
+        } else if (strcmp(argv[i], "-input") == 0 && i + 1 < argc) {
+            inputFile = argv[++i];
+        } else if (strcmp(argv[i], "-minPopulation") == 0 && i + 1 < argc) {
+            minPopulation = (unsigned int)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            outputDirectory = argv[++i];
+        } else if (strcmp(argv[i], "-overlay") == 0 && i + 1 < argc) {
+            correctionsFile = argv[++i];
+        } else if (strcmp(argv[i], "-hashHeader") == 0 && i + 1 < argc) {
+            hashHeaderFile = argv[++i];
+        } else {
+            fprintf(stderr, "Usage: %s [-j threads] [-derivedOnly] [-input file] [-minPopulation N] [-o directory] [-overlay corrections] [-hashHeader file]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (numThreads < 1) {
+        numThreads = 1;
+    }
+
+    if (correctionsFile) {
+        makeOverlay(correctionsFile);
+        return 0;
+    }
+    if (hashHeaderFile) {
+        makeHashHeader(hashHeaderFile);
+        return 0;
+    }
+    double start = currentSeconds();
+    if (!derivedOnly) {
+        buildBaseFiles();
+        printf("Base files in %.2f seconds\n", currentSeconds() - start);
+    }
+    double stageStart = currentSeconds();
+    compressNames();
+    printf("Compressed names in %.2f seconds\n", currentSeconds() - stageStart);
+    stageStart = currentSeconds();
+    makeRasters();
+    printf("Rasters in %.2f seconds\n", currentSeconds() - stageStart);
+    makeAirports();
+    printf("Done in %.2f seconds with %d threads\n", currentSeconds() - start, numThreads);
+    return 0;
+}
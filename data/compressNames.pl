@@ -0,0 +1,139 @@
+#!/usr/bin/perl -w
+
+# Reads loc-names.dat and loc-index.dat (as written by munchGeoNames.pl) and writes a compressed
+# copy of the names for use at runtime:
+#
+#   loc-names-fsst.dat:  256 8-byte symbols, then 256 symbol lengths, then the encoded names
+#   loc-index-fsst.dat:  one 32-bit offset per city into the encoded names (relative to the end of the symbol table)
+#
+# Each encoded name is a sequence of one-byte codes:  0 ends the name, 255 is followed by a single literal
+# byte, and any other code stands for its symbol (1-8 bytes).  The symbol table is built FSST-style:  starting
+# from an empty table, encode the names with the current table, count how often each symbol and each pair of
+# adjacent symbols occurs, and keep the 254 candidates that save the most bytes.  A handful of rounds is enough.
+#
+# Run in the data directory after munchGeoNames.pl.
+
+use strict;
+
+my $locationDir = ".";
+
+my $maxSymbolLength = 8;
+my $numSymbolCodes = 254;  # Codes 1-254; 0 is end-of-name, 255 is the literal escape
+my $numRounds = 5;
+my $maxNameLength = 240;   # Must leave room for the decoder's 8-byte overrun in ES_GEONAMES_NAME_BUFFER_SIZE
+
+sub readFile {
+    my $file = shift;
+    open F, "$locationDir/$file"
+      or die "Couldn't read $locationDir/$file: $!\n";
+    binmode F;
+    local $/;
+    my $contents = <F>;
+    close F;
+    return $contents;
+}
+
+my $allNames = readFile "loc-names.dat";
+my @nameIndices = unpack "L*", readFile "loc-index.dat";
+
+# Distinct names (there's one per index, but be safe if any are shared)
+my %namesByOffset;
+foreach my $offset (@nameIndices) {
+    my $end = index $allNames, "\0", $offset;
+    $end >= 0
+      or die "Unterminated name at offset $offset\n";
+    $namesByOffset{$offset} = substr $allNames, $offset, $end - $offset;
+    $end - $offset < $maxNameLength
+      or die "Name at offset $offset is too long for the decode buffer in ESGeoNames\n";
+}
+my @names = values %namesByOffset;
+
+# Greedy longest-match encoding of one string into a list of symbols (literal bytes are returned as themselves)
+sub parse {
+    my ($string, $symbols) = @_;
+    my @parsed;
+    my $len = length $string;
+    my $pos = 0;
+    while ($pos < $len) {
+        my $matchLength = 1;
+        for (my $l = ($len - $pos < $maxSymbolLength ? $len - $pos : $maxSymbolLength); $l > 1; $l--) {
+            if (defined $symbols->{substr $string, $pos, $l}) {
+                $matchLength = $l;
+                last;
+            }
+        }
+        push @parsed, substr $string, $pos, $matchLength;
+        $pos += $matchLength;
+    }
+    return @parsed;
+}
+
+my %symbols;  # symbol string => code
+for (my $round = 0; $round < $numRounds; $round++) {
+    my %count;
+    foreach my $name (@names) {
+        my @parsed = parse $name, \%symbols;
+        for (my $i = 0; $i < @parsed; $i++) {
+            $count{$parsed[$i]}++;
+            if ($i + 1 < @parsed && length($parsed[$i]) + length($parsed[$i+1]) <= $maxSymbolLength) {
+                $count{$parsed[$i] . $parsed[$i+1]}++;
+            }
+        }
+    }
+    # Gain for a symbol is the bytes it saves where it's used:  a single byte saves nothing over a
+    # literal code (but costs an escape if it isn't in the table), so weight singles by 1 like FSST does.
+    my @candidates = sort {
+        $count{$b} * length($b) <=> $count{$a} * length($a) or $a cmp $b
+    } keys %count;
+    splice @candidates, $numSymbolCodes if @candidates > $numSymbolCodes;
+    %symbols = ();
+    my $code = 1;
+    foreach my $symbol (@candidates) {
+        $symbols{$symbol} = $code++;
+    }
+}
+
+# Encode
+my %encodedOffsetByNameOffset;
+my $encoded = "";
+foreach my $offset (sort { $a <=> $b } keys %namesByOffset) {
+    $encodedOffsetByNameOffset{$offset} = length $encoded;
+    foreach my $symbol (parse $namesByOffset{$offset}, \%symbols) {
+        if (defined $symbols{$symbol}) {
+            $encoded .= chr $symbols{$symbol};
+        } else {
+            length($symbol) == 1
+              or die "Unknown multibyte symbol '$symbol'\n";
+            $encoded .= chr(255) . $symbol;
+        }
+    }
+    $encoded .= chr 0;
+}
+
+# Symbol table, indexed by code
+my @symbolBytes = ("\0" x $maxSymbolLength) x 256;
+my @symbolLengths = (0) x 256;
+foreach my $symbol (keys %symbols) {
+    my $code = $symbols{$symbol};
+    $symbolBytes[$code] = $symbol . ("\0" x ($maxSymbolLength - length $symbol));
+    $symbolLengths[$code] = length $symbol;
+}
+
+unlink "$locationDir/loc-names-fsst.dat";
+open NAMES, ">$locationDir/loc-names-fsst.dat"
+  or die "Couldn't open $locationDir/loc-names-fsst.dat for writing: $!\n";
+binmode NAMES;
+print NAMES join "", @symbolBytes;
+print NAMES pack "C*", @symbolLengths;
+print NAMES $encoded;
+close NAMES;
+
+unlink "$locationDir/loc-index-fsst.dat";
+open INDEX, ">$locationDir/loc-index-fsst.dat"
+  or die "Couldn't open $locationDir/loc-index-fsst.dat for writing: $!\n";
+binmode INDEX;
+print INDEX pack "L*", map { $encodedOffsetByNameOffset{$_} } @nameIndices;
+close INDEX;
+
+printf "Compressed %d bytes of names to %d (+ %d symbol table)\n",
+  length $allNames, length $encoded, 256 * ($maxSymbolLength + 1);
@@ -38,7 +38,8 @@ sub checkFile {
 
 opendir DIR, $inputDir
   or die "Couldn't read directory $inputDir: $!\n";
-my @entries = grep /\.dat$|\.sum$/, readdir DIR;
+# loc-names.dat and loc-index.dat are only inputs to compressNames.pl; the app reads the -fsst versions
+my @entries = grep { /\.dat$|\.sum$/ && !/^loc-(names|index)\.dat$/ } readdir DIR;
 closedir DIR;
 
 foreach my $entry (@entries) {
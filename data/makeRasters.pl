@@ -0,0 +1,279 @@
+#!/usr/bin/perl -w
+
+# Reads loc-data.dat, loc-tz.dat, loc-tzNames.sum, loc-region.dat, loc-regiondesc.dat and loc-ccCodes.dat (as written
+# by munchGeoNames.pl) and writes two rasters over the globe, giving for each cell the time zone (loc-tzRaster.dat)
+# and the country (loc-ccRaster.dat) of the closest city to every point in the cell, so that ESGeoNames can find
+# them for a coordinate without a closest-city search.
+#
+# A cell gets a value only if it's certain:  if the closest city to the cell center is d0 away, and every point in
+# the cell is within r of the center, then the closest city to any point in the cell is within d0 + 2r of the center;
+# if all of those cities share a zone (country), so does the whole cell.  Otherwise the cell is marked as a border
+# cell and ESGeoNames falls back to the closest city there.
+#
+# loc-tzRaster.dat is all 16-bit values (native byte order like the other loc-*.dat files):
+#
+#   cellsPerDegree, blockSize, tzNames checksum (low 16 bits), tzNames checksum (high 16 bits)
+#   one entry per block of blockSize x blockSize cells, blocks in rows from the south pole, west to east from -180:
+#     if the high bit is clear, the value of every cell in the block
+#     otherwise (entry & 0x7fff) is the number of the block's detail record
+#   detail records of blockSize * blockSize cell values, in rows from the south, west to east
+#
+# A cell value is a time zone index (into loc-tzNames.dat), or 0x7fff for a border cell.
+#
+# Countries come in much longer runs than zones, so loc-ccRaster.dat is run-length encoded by row instead (about a
+# third of the size of blocks), so that it's small enough to load by itself:
+#
+#   cellsPerDegree, numCountries, numRuns (low 16 bits), numRuns (high 16 bits)
+#   numCountries two-character country codes, as in loc-ccCodes.dat
+#   for each row from the south pole, plus one, the number of its first run
+#   for each run, its first column (west to east from -180)
+#   for each run, one byte:  its country (an index into the codes above), or 0xff for border cells
+#
+# Run in the data directory after munchGeoNames.pl.
+
+use strict;
+use POSIX qw(floor);
+
+my $locationDir = ".";
+
+my $cellsPerDegree = 2;
+my $blockSize = 4;
+my $tzBorderValue = 0x7fff;
+my $ccBorderValue = 0xff;
+my $slackKm = 0.1;          # Covers the float arithmetic in ESGeoNames
+my $earthRadius = 6371;     # km, as in ESLocation::kmBetweenLatLong
+my $pi = 4 * atan2(1, 1);
+my $kmPerDegree = $earthRadius * $pi / 180;
+
+sub readFile {
+    my $file = shift;
+    open F, "$locationDir/$file"
+      or die "Couldn't read $locationDir/$file: $!\n";
+    binmode F;
+    local $/;
+    my $contents = <F>;
+    close F;
+    return $contents;
+}
+
+my @cityData = unpack "(Lff)*", readFile "loc-data.dat";
+my @tzIndices = unpack "S*", readFile "loc-tz.dat";
+my ($tzNamesChecksum) = unpack "L", readFile "loc-tzNames.sum";
+my @regionIndices = unpack "S*", readFile "loc-region.dat";
+my @regionDescs = unpack "S*", readFile "loc-regiondesc.dat";  # ccIndex, a1Index, a2Index for each region
+my @ccCodes = unpack "S*", readFile "loc-ccCodes.dat";
+my $numCities = @tzIndices;
+@cityData == 3 * $numCities
+  or die "loc-data.dat has " . (@cityData / 3) . " cities but loc-tz.dat has $numCities\n";
+@regionIndices == $numCities
+  or die "loc-region.dat has " . scalar(@regionIndices) . " cities but loc-tz.dat has $numCities\n";
+grep { $_ >= $tzBorderValue } @tzIndices
+  and die "Too many time zones for the raster\n";
+@ccCodes < $ccBorderValue
+  or die "Too many countries for the raster\n";
+
+# Cities by 1-degree latitude band, each band sorted by longitude
+my @bands;  # [band] => [[longitude, latitude, tz, cc], ...]
+for (my $i = 0; $i < $numCities; $i++) {
+    my $latitude = $cityData[3 * $i + 1];
+    my $longitude = $cityData[3 * $i + 2];
+    my $band = floor($latitude + 90);
+    $band = 179 if $band > 179;
+    $band = 0 if $band < 0;
+    push @{$bands[$band]}, [$longitude, $latitude, $tzIndices[$i], $regionDescs[3 * $regionIndices[$i]]];
+}
+foreach my $band (@bands) {
+    $band = [sort { $a->[0] <=> $b->[0] } @$band] if $band;
+}
+
+sub haversineKm {
+    my ($lat1, $long1, $lat2, $long2) = map { $_ * $pi / 180 } @_;
+    my $sinDLatOver2 = sin(($lat2 - $lat1) / 2);
+    my $sinDLongOver2 = sin(($long2 - $long1) / 2);
+    my $a = $sinDLatOver2 * $sinDLatOver2 + $sinDLongOver2 * $sinDLongOver2 * cos($lat1) * cos($lat2);
+    return 2 * $earthRadius * atan2(sqrt($a), sqrt(1 - $a));
+}
+
+# First index in the (sorted) band with longitude >= $longitude
+sub lowerBound {
+    my ($band, $longitude) = @_;
+    my ($lo, $hi) = (0, scalar @$band);
+    while ($lo < $hi) {
+        my $mid = ($lo + $hi) >> 1;
+        if ($band->[$mid][0] < $longitude) {
+            $lo = $mid + 1;
+        } else {
+            $hi = $mid;
+        }
+    }
+    return $lo;
+}
+
+# Distances to, and zones and countries of, every city within $radius km of ($latitude, $longitude)
+sub citiesWithin {
+    my ($latitude, $longitude, $radius) = @_;
+    my @found;
+    my $radiusDegrees = $radius / $kmPerDegree;
+    my $firstBand = floor($latitude - $radiusDegrees + 90);
+    my $lastBand = floor($latitude + $radiusDegrees + 90);
+    $firstBand = 0 if $firstBand < 0;
+    $lastBand = 179 if $lastBand > 179;
+    my $sinHalfAngle = sin($radius / $earthRadius / 2);
+    for (my $b = $firstBand; $b <= $lastBand; $b++) {
+        my $band = $bands[$b];
+        next unless $band;
+        # In the haversine, a >= cos(lat1) cos(lat2) sin^2(dLong/2), so only longitudes with that below
+        # sin^2(radius/2) can be close enough.  Use the smallest cosine in the band.
+        my $bandSouth = $b - 90;
+        my $bandNorth = $b - 89;
+        my $minCos = cos((abs($bandSouth) > abs($bandNorth) ? abs($bandSouth) : abs($bandNorth)) * $pi / 180);
+        my $ratio = $sinHalfAngle * $sinHalfAngle / (cos($latitude * $pi / 180) * $minCos + 1e-12);
+        my @ranges;
+        if ($ratio >= 1) {
+            @ranges = ([0, scalar @$band]);
+        } else {
+            my $dLong = 2 * atan2(sqrt($ratio), sqrt(1 - $ratio)) * 180 / $pi + 1e-6;
+            if ($dLong >= 180) {
+                @ranges = ([0, scalar @$band]);
+            } else {
+                my $west = $longitude - $dLong;
+                my $east = $longitude + $dLong;
+                if ($west < -180) {
+                    push @ranges, [lowerBound($band, $west + 360), scalar @$band];
+                    $west = -180;
+                }
+                if ($east > 180) {
+                    push @ranges, [0, lowerBound($band, $east - 360 + 1e-9)];
+                    $east = 180;
+                }
+                push @ranges, [lowerBound($band, $west), lowerBound($band, $east + 1e-9)];
+            }
+        }
+        foreach my $range (@ranges) {
+            for (my $i = $range->[0]; $i < $range->[1]; $i++) {
+                my $city = $band->[$i];
+                my $distance = haversineKm($latitude, $longitude, $city->[1], $city->[0]);
+                push @found, [$distance, $city->[2], $city->[3]] if $distance <= $radius;
+            }
+        }
+    }
+    return @found;
+}
+
+my $numRows = 180 * $cellsPerDegree;
+my $numColumns = 360 * $cellsPerDegree;
+my $cellDegrees = 1 / $cellsPerDegree;
+my @tzCells;  # [row * $numColumns + column]
+my @ccCells;
+my $numTZBorderCells = 0;
+my $numCCBorderCells = 0;
+my $lastClosest = 100;
+for (my $row = 0; $row < $numRows; $row++) {
+    my $south = -90 + $row * $cellDegrees;
+    my $centerLatitude = $south + $cellDegrees / 2;
+    # The corners are the farthest points from the center (the north and south corners differ away from the equator)
+    my $cellRadius = haversineKm($centerLatitude, 0, $south, $cellDegrees / 2);
+    my $northRadius = haversineKm($centerLatitude, 0, $south + $cellDegrees, $cellDegrees / 2);
+    $cellRadius = $northRadius if $northRadius > $cellRadius;
+    for (my $column = 0; $column < $numColumns; $column++) {
+        my $centerLongitude = -180 + $column * $cellDegrees + $cellDegrees / 2;
+        # Neighboring cells have similar closest distances, so start from the last one
+        my $radius = $lastClosest + 2 * $cellRadius;
+        my @near;
+        while (!(@near = citiesWithin($centerLatitude, $centerLongitude, $radius))) {
+            $radius *= 2;
+        }
+        my $closest = 1E20;
+        foreach my $city (@near) {
+            $closest = $city->[0] if $city->[0] < $closest;
+        }
+        $lastClosest = $closest;
+        my $maxCandidateDistance = $closest + 2 * $cellRadius + $slackKm;
+        if ($maxCandidateDistance > $radius) {
+            @near = citiesWithin($centerLatitude, $centerLongitude, $maxCandidateDistance);
+        }
+        my ($tz, $cc);
+        foreach my $city (@near) {
+            next if $city->[0] > $maxCandidateDistance;
+            $tz = $city->[1] if !defined $tz;
+            $tz = $tzBorderValue if $tz != $city->[1];
+            $cc = $city->[2] if !defined $cc;
+            $cc = $ccBorderValue if $cc != $city->[2];
+        }
+        $numTZBorderCells++ if $tz == $tzBorderValue;
+        $numCCBorderCells++ if $cc == $ccBorderValue;
+        $tzCells[$row * $numColumns + $column] = $tz;
+        $ccCells[$row * $numColumns + $column] = $cc;
+    }
+}
+
+# Returns references to the block entries and the detail values for the given cells
+sub makeBlocks {
+    my $cells = shift;
+    my $numBlockRows = $numRows / $blockSize;
+    my $numBlockColumns = $numColumns / $blockSize;
+    my @blockEntries;
+    my @details;
+    for (my $blockRow = 0; $blockRow < $numBlockRows; $blockRow++) {
+        for (my $blockColumn = 0; $blockColumn < $numBlockColumns; $blockColumn++) {
+            my @values;
+            for (my $r = 0; $r < $blockSize; $r++) {
+                for (my $c = 0; $c < $blockSize; $c++) {
+                    push @values, $cells->[($blockRow * $blockSize + $r) * $numColumns + $blockColumn * $blockSize + $c];
+                }
+            }
+            if (grep { $_ != $values[0] } @values) {
+                @details / ($blockSize * $blockSize) < 0x8000
+                  or die "Too many detail blocks for the raster\n";
+                push @blockEntries, 0x8000 | (@details / ($blockSize * $blockSize));
+                push @details, @values;
+            } else {
+                push @blockEntries, $values[0];
+            }
+        }
+    }
+    return (\@blockEntries, \@details);
+}
+
+unlink "$locationDir/loc-tzRaster.dat";
+open RASTER, ">$locationDir/loc-tzRaster.dat"
+  or die "Couldn't open $locationDir/loc-tzRaster.dat for writing: $!\n";
+binmode RASTER;
+my ($blockEntries, $details) = makeBlocks(\@tzCells);
+print RASTER pack "S*", $cellsPerDegree, $blockSize, $tzNamesChecksum & 0xffff, $tzNamesChecksum >> 16;
+print RASTER pack "S*", @$blockEntries;
+print RASTER pack "S*", @$details;
+close RASTER;
+
+my @rowStarts;
+my @runStarts;
+my @runValues;
+for (my $row = 0; $row < $numRows; $row++) {
+    push @rowStarts, scalar @runStarts;
+    for (my $column = 0; $column < $numColumns; $column++) {
+        my $value = $ccCells[$row * $numColumns + $column];
+        if ($column == 0 || $value != $runValues[-1]) {
+            push @runStarts, $column;
+            push @runValues, $value;
+        }
+    }
+}
+push @rowStarts, scalar @runStarts;
+@runStarts < 0x10000
+  or die "Too many runs for the country raster\n";
+
+unlink "$locationDir/loc-ccRaster.dat";
+open RASTER, ">$locationDir/loc-ccRaster.dat"
+  or die "Couldn't open $locationDir/loc-ccRaster.dat for writing: $!\n";
+binmode RASTER;
+print RASTER pack "S*", $cellsPerDegree, scalar @ccCodes, scalar(@runStarts) & 0xffff, scalar(@runStarts) >> 16;
+print RASTER pack "S*", @ccCodes;
+print RASTER pack "S*", @rowStarts;
+print RASTER pack "S*", @runStarts;
+print RASTER pack "C*", @runValues;
+close RASTER;
+
+printf "%d cells, %d time zone border cells, %d country border cells\n", $numRows * $numColumns, $numTZBorderCells, $numCCBorderCells;
+printf "loc-tzRaster.dat: %d blocks (%d with detail), %d bytes\n",
+  scalar @$blockEntries, @$details / ($blockSize * $blockSize), -s "$locationDir/loc-tzRaster.dat";
+printf "loc-ccRaster.dat: %d runs, %d bytes\n", scalar @runStarts, -s "$locationDir/loc-ccRaster.dat";
@@ -1,5 +1,7 @@
 #!/usr/bin/perl -w
 
+# Superseded by bench/ESGeoNamesSearchBench.cpp, which runs the queries through the real ESGeoNames search
+
 use strict;
 
 use Config;
@@ -72,6 +72,17 @@ class ESDeviceLocationManager {
     //                                         jstring provider,
     //                                         jint    status,
     //                                         jobject extrasBundle);
+#else  // Replay backend (ESDeviceLocationManager_replay.cpp), for running the location pipeline on hosts without location services
+    static bool             setReplayTraceFile(const char *path);  // GPX, NMEA or CSV (recognized by content); returns false if no fixes were found
+    static void             setReplaySynthetic(double         startLatitudeDegrees,
+                                               double         startLongitudeDegrees,
+                                               double         speedMetersPerSecond,
+                                               double         headingDegrees,
+                                               ESTimeInterval intervalBetweenFixes,
+                                               int            numFixes);  // A straight track at constant speed
+    static void             setReplaySpeedFactor(double speedFactor);  // 1 is real time, 10 is ten times as fast; 0 means fixes are only delivered by replayNextFix()
+    static bool             replayNextFix();  // Deliver the next fix now, in the calling (main) thread; returns false if the trace is exhausted
+    static int              numReplayFixesRemaining();
 #endif
 
   private:
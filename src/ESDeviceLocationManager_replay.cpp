@@ -0,0 +1,462 @@
+//
+//  ESDeviceLocationManager_replay.cpp
+//
+//  Copyright Emerald Sequoia LLC 2011. All rights reserved.
+//
+
+// A device "backend" for hosts with no location services (e.g., Linux), which replays fixes from a trace
+// file or a synthetic track through ESLocation::newDeviceLocationAvailable just as a real device would.
+// Build it in place of ESDeviceLocationManager_Cocoa.mm or ESDeviceLocationManager_android.cpp.
+//
+// The trace is chosen by calling setReplayTraceFile() or setReplaySynthetic() before init(), or, if neither
+// is called, by the environment:
+//
+//   ES_LOCATION_REPLAY=<path>        GPX (<trkpt>), NMEA ($..GGA and $..RMC sentences), or CSV lines of
+//                                    unixTimeSeconds,latitudeDegrees,longitudeDegrees[,accuracyMeters[,altitudeMeters[,altitudeAccuracyMeters]]]
+//   ES_LOCATION_REPLAY=synthetic     a 30 m/s track northeast from Mountain View, one fix per second for an hour
+//   ES_LOCATION_REPLAY_SPEED=<n>     see setReplaySpeedFactor()
+//
+// Fix timestamps keep the spacing of the trace, but are moved so the first one is the time replay started.
+// With a speed factor, fixes are delivered by a timer (in the main thread) while ESLocation has asked for
+// updates; with a speed factor of 0 they are delivered only when the caller asks, which is the way to run
+// the pipeline as fast as it will go.
+
+#include "ESDeviceLocationManager.hpp"
+
+#include "ESErrorReporter.hpp"
+#include "ESLocation.hpp"
+#include "ESSystemTimeBase.hpp"
+#include "ESThread.hpp"
+#include "ESTimer.hpp"
+#include "ESUtil.hpp"
+#undef ESTRACE
+#include "ESTrace.hpp"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#define ES_REPLAY_DEFAULT_ACCURACY_METERS 10.0   // For fixes which don't say
+#define ES_REPLAY_METERS_PER_HDOP          5.0   // Rough conversion of NMEA/GPX horizontal dilution of precision to accuracy
+
+struct ESReplayFix {
+    double                  unixTime;  // seconds; only differences matter
+    double                  latitudeDegrees;
+    double                  longitudeDegrees;
+    double                  altitudeMeters;
+    double                  altitudeAccuracyMeters;  // -1 if unknown
+    double                  accuracyMeters;
+};
+
+static std::vector<ESReplayFix> replayFixes;
+static size_t nextReplayFix = 0;
+static bool replayConfigured = false;
+static double replaySpeedFactor = 1.0;
+static ESTimeInterval replayBaseTime;  // Timestamp for the first fix
+static bool updating = false;
+static ESTimer *replayTimer = NULL;
+
+static void installReplayTimer(ESTimeInterval delay);
+
+class ESReplayTimerObserver : public ESTimerObserver {
+  public:
+    virtual void            notify(ESTimer *timer) {
+        ESAssert(timer == replayTimer);
+        replayTimer->release();
+        replayTimer = NULL;
+        if (!updating) {
+            return;
+        }
+        if (ESDeviceLocationManager::replayNextFix() &&
+            updating &&  // ESLocation may have stopped updates in response to the fix
+            nextReplayFix < replayFixes.size()) {
+            installReplayTimer((replayFixes[nextReplayFix].unixTime - replayFixes[nextReplayFix - 1].unixTime) / replaySpeedFactor);
+        }
+    }
+};
+static ESReplayTimerObserver *replayTimerObserver = NULL;
+
+static void
+installReplayTimer(ESTimeInterval delay) {
+    ESAssert(ESThread::inMainThread());
+    if (replayTimer) {
+        replayTimer->release();
+    }
+    if (!replayTimerObserver) {
+        replayTimerObserver = new ESReplayTimerObserver;
+    }
+    replayTimer = new ESIntervalTimer(replayTimerObserver, delay > 0 ? delay : 0);
+}
+
+static void
+clearReplayFixes() {
+    replayFixes.clear();
+    nextReplayFix = 0;
+    replayConfigured = true;
+    replayBaseTime = ESSystemTimeBase::currentSystemTime();
+}
+
+// Days since 1970-01-01 in the proleptic Gregorian calendar
+static long
+daysFromCivil(int year, int month, int day) {
+    year -= month <= 2;
+    long era = (year >= 0 ? year : year - 399) / 400;
+    long yearOfEra = year - era * 400;
+    long dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    long dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + dayOfEra - 719468;
+}
+
+// NMEA's ddmm.mmmm (or dddmm.mmmm), with hemisphere letter
+static double
+degreesFromNMEA(const char *value,
+                const char *hemisphere) {
+    double v = atof(value);
+    double degrees = floor(v / 100);
+    degrees += (v - degrees * 100) / 60;
+    return (*hemisphere == 'S' || *hemisphere == 'W') ? -degrees : degrees;
+}
+
+static void
+splitFields(const std::string        &line,
+            std::vector<std::string> *fields) {
+    fields->clear();
+    size_t start = 0;
+    while (true) {
+        size_t comma = line.find_first_of(",*", start);
+        fields->push_back(line.substr(start, comma == std::string::npos ? std::string::npos : comma - start));
+        if (comma == std::string::npos || line[comma] == '*') {  // '*' starts the checksum
+            break;
+        }
+        start = comma + 1;
+    }
+}
+
+static void
+parseCSV(const std::string &contents) {
+    size_t start = 0;
+    while (start < contents.size()) {
+        size_t end = contents.find('\n', start);
+        if (end == std::string::npos) {
+            end = contents.size();
+        }
+        std::string line = contents.substr(start, end - start);
+        start = end + 1;
+        ESReplayFix fix;
+        fix.accuracyMeters = ES_REPLAY_DEFAULT_ACCURACY_METERS;
+        fix.altitudeMeters = 0;
+        fix.altitudeAccuracyMeters = -1;
+        int n = sscanf(line.c_str(), "%lf ,%lf ,%lf ,%lf ,%lf ,%lf",
+                       &fix.unixTime, &fix.latitudeDegrees, &fix.longitudeDegrees,
+                       &fix.accuracyMeters, &fix.altitudeMeters, &fix.altitudeAccuracyMeters);
+        if (n >= 3) {  // Anything else is a header, comment or blank line
+            replayFixes.push_back(fix);
+        }
+    }
+}
+
+static void
+parseNMEA(const std::string &contents) {
+    std::vector<std::string> fields;
+    long day = 0;                     // From the most recent RMC sentence
+    bool haveDay = false;
+    double lastSecondsOfDay = -1;
+    size_t start = 0;
+    while (start < contents.size()) {
+        size_t end = contents.find_first_of("\r\n", start);
+        if (end == std::string::npos) {
+            end = contents.size();
+        }
+        std::string line = contents.substr(start, end - start);
+        start = end + 1;
+        if (line.size() < 6 || line[0] != '$') {
+            continue;
+        }
+        splitFields(line, &fields);
+        std::string type = fields[0].substr(3);
+        bool isRMC = type == "RMC";
+        if (!(isRMC && fields.size() >= 10 && fields[2] == "A") &&
+            !(type == "GGA" && fields.size() >= 10 && atoi(fields[6].c_str()) > 0)) {
+            continue;  // Not a sentence we use, or no fix
+        }
+        const std::string &timeField = fields[1];
+        if (timeField.size() < 6) {
+            continue;
+        }
+        double secondsOfDay = atoi(timeField.substr(0, 2).c_str()) * 3600 + atoi(timeField.substr(2, 2).c_str()) * 60 + atof(timeField.c_str() + 4);
+        if (isRMC) {
+            const std::string &date = fields[9];  // ddmmyy
+            if (date.size() == 6) {
+                day = daysFromCivil(2000 + atoi(date.substr(4, 2).c_str()), atoi(date.substr(2, 2).c_str()), atoi(date.substr(0, 2).c_str()));
+                if (!haveDay) {
+                    // Only RMC sentences carry the date, so the fixes so far are timed from 1970, a long way before the
+                    // rest; drop them, except for this epoch's GGA, which this sentence completes below.  (A trace with
+                    // no dated RMC has only the times of day to go on, and keeps them all.)
+                    bool keepLast = !replayFixes.empty() && secondsOfDay == lastSecondsOfDay;
+                    replayFixes.erase(replayFixes.begin(), keepLast ? replayFixes.end() - 1 : replayFixes.end());
+                    haveDay = true;
+                }
+            }
+        } else if (secondsOfDay < lastSecondsOfDay - 43200) {
+            day++;  // Passed midnight without an RMC to tell us
+        }
+        ESReplayFix fix;
+        fix.unixTime = day * 86400.0 + secondsOfDay;
+        fix.altitudeAccuracyMeters = -1;
+        if (isRMC) {
+            fix.latitudeDegrees = degreesFromNMEA(fields[3].c_str(), fields[4].c_str());
+            fix.longitudeDegrees = degreesFromNMEA(fields[5].c_str(), fields[6].c_str());
+            fix.altitudeMeters = 0;
+            fix.accuracyMeters = ES_REPLAY_DEFAULT_ACCURACY_METERS;
+        } else {
+            fix.latitudeDegrees = degreesFromNMEA(fields[2].c_str(), fields[3].c_str());
+            fix.longitudeDegrees = degreesFromNMEA(fields[4].c_str(), fields[5].c_str());
+            fix.altitudeMeters = atof(fields[9].c_str());
+            fix.accuracyMeters = fields[8].empty() ? ES_REPLAY_DEFAULT_ACCURACY_METERS : atof(fields[8].c_str()) * ES_REPLAY_METERS_PER_HDOP;
+        }
+        if (!replayFixes.empty() && secondsOfDay == lastSecondsOfDay) {
+            // The same epoch reported by both sentences:  GGA has the altitude and precision, RMC the date
+            ESReplayFix &previous = replayFixes.back();
+            if (isRMC) {
+                previous.unixTime = fix.unixTime;
+            } else {
+                fix.unixTime = previous.unixTime;
+                previous = fix;
+            }
+        } else {
+            replayFixes.push_back(fix);
+        }
+        lastSecondsOfDay = secondsOfDay;
+    }
+}
+
+static bool
+isXMLSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+// The value of attribute name="value" (or name='value', with any white space around the '=') within the tag
+// at [start, end) of contents
+static bool
+findAttribute(const std::string &contents,
+              size_t            start,
+              size_t            end,
+              const char        *name,
+              double            *value) {
+    size_t nameLength = strlen(name);
+    for (size_t pos = contents.find(name, start); pos != std::string::npos && pos < end; pos = contents.find(name, pos + 1)) {
+        if (pos == 0 || !isXMLSpace(contents[pos - 1])) {
+            continue;  // Part of a longer name, or of a value
+        }
+        size_t p = pos + nameLength;
+        while (p < end && isXMLSpace(contents[p])) {
+            p++;
+        }
+        if (p >= end || contents[p] != '=') {
+            continue;
+        }
+        p++;
+        while (p < end && isXMLSpace(contents[p])) {
+            p++;
+        }
+        if (p >= end || (contents[p] != '"' && contents[p] != '\'')) {
+            continue;
+        }
+        *value = atof(contents.c_str() + p + 1);
+        return true;
+    }
+    return false;
+}
+
+// The text of <name>text</name> within [start, end) of contents
+static bool
+findElement(const std::string &contents,
+            size_t            start,
+            size_t            end,
+            const char        *name,
+            std::string       *text) {
+    std::string openTag = std::string("<") + name + ">";
+    size_t pos = contents.find(openTag, start);
+    if (pos == std::string::npos || pos >= end) {
+        return false;
+    }
+    pos += openTag.size();
+    size_t close = contents.find('<', pos);
+    if (close == std::string::npos || close > end) {
+        return false;
+    }
+    *text = contents.substr(pos, close - pos);
+    return true;
+}
+
+static void
+parseGPX(const std::string &contents) {
+    size_t start = 0;
+    while ((start = contents.find("<trkpt", start)) != std::string::npos) {
+        size_t tagEnd = contents.find('>', start);
+        size_t end = contents.find("</trkpt>", start);
+        if (tagEnd == std::string::npos) {
+            break;
+        }
+        if (contents[tagEnd - 1] == '/' || end == std::string::npos) {
+            end = tagEnd;  // <trkpt .../> has no elements
+        }
+        ESReplayFix fix;
+        if (findAttribute(contents, start, tagEnd, "lat", &fix.latitudeDegrees) &&
+            findAttribute(contents, start, tagEnd, "lon", &fix.longitudeDegrees)) {
+            std::string text;
+            fix.altitudeMeters = findElement(contents, tagEnd, end, "ele", &text) ? atof(text.c_str()) : 0;
+            fix.altitudeAccuracyMeters = -1;
+            fix.accuracyMeters = findElement(contents, tagEnd, end, "hdop", &text)
+                ? atof(text.c_str()) * ES_REPLAY_METERS_PER_HDOP
+                : ES_REPLAY_DEFAULT_ACCURACY_METERS;
+            int year, month, day, hour, minute;
+            double second;
+            if (findElement(contents, tagEnd, end, "time", &text) &&
+                sscanf(text.c_str(), "%d-%d-%dT%d:%d:%lf", &year, &month, &day, &hour, &minute, &second) == 6) {
+                fix.unixTime = daysFromCivil(year, month, day) * 86400.0 + hour * 3600 + minute * 60 + second;
+            } else {
+                fix.unixTime = replayFixes.empty() ? 0 : replayFixes.back().unixTime + 1;  // One a second, if the track doesn't say
+            }
+            replayFixes.push_back(fix);
+        }
+        start = end;
+    }
+}
+
+/*static*/ bool
+ESDeviceLocationManager::setReplayTraceFile(const char *path) {
+    clearReplayFixes();
+    FILE *fp = fopen(path, "rb");
+    if (!fp) {
+        ESErrorReporter::logError("ESDeviceLocationManager::setReplayTraceFile", "Couldn't open %s", path);
+        return false;
+    }
+    std::string contents;
+    char buf[16384];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), fp)) > 0) {
+        contents.append(buf, n);
+    }
+    fclose(fp);
+    size_t firstNonSpace = contents.find_first_not_of(" \t\r\n");
+    if (contents.find("<trkpt") != std::string::npos) {
+        parseGPX(contents);
+    } else if (firstNonSpace != std::string::npos && contents[firstNonSpace] == '$') {
+        parseNMEA(contents);
+    } else {
+        parseCSV(contents);
+    }
+    ESErrorReporter::logInfo("ESDeviceLocationManager::setReplayTraceFile", "%d fixes from %s", (int)replayFixes.size(), path);
+    return !replayFixes.empty();
+}
+
+/*static*/ void
+ESDeviceLocationManager::setReplaySynthetic(double         startLatitudeDegrees,
+                                            double         startLongitudeDegrees,
+                                            double         speedMetersPerSecond,
+                                            double         headingDegrees,
+                                            ESTimeInterval intervalBetweenFixes,
+                                            int            numFixes) {
+    clearReplayFixes();
+    double earthRadiusMeters = 6371000;  // As in ESLocation::kmBetweenLatLong
+    double heading = headingDegrees * M_PI / 180;
+    double latitude1 = startLatitudeDegrees * M_PI / 180;
+    double longitude1 = startLongitudeDegrees * M_PI / 180;
+    for (int i = 0; i < numFixes; i++) {
+        // Destination along the great circle at the given initial heading
+        double angle = speedMetersPerSecond * intervalBetweenFixes * i / earthRadiusMeters;
+        double latitude2 = asin(sin(latitude1) * cos(angle) + cos(latitude1) * sin(angle) * cos(heading));
+        double longitude2 = longitude1 + atan2(sin(heading) * sin(angle) * cos(latitude1), cos(angle) - sin(latitude1) * sin(latitude2));
+        ESReplayFix fix;
+        fix.unixTime = i * intervalBetweenFixes;
+        fix.latitudeDegrees = latitude2 * 180 / M_PI;
+        fix.longitudeDegrees = remainder(longitude2 * 180 / M_PI, 360);
+        fix.altitudeMeters = 0;
+        fix.altitudeAccuracyMeters = -1;
+        fix.accuracyMeters = ES_REPLAY_DEFAULT_ACCURACY_METERS;
+        replayFixes.push_back(fix);
+    }
+}
+
+/*static*/ void
+ESDeviceLocationManager::setReplaySpeedFactor(double speedFactor) {
+    ESAssert(speedFactor >= 0);
+    replaySpeedFactor = speedFactor;
+    if (speedFactor == 0 && replayTimer) {
+        replayTimer->release();
+        replayTimer = NULL;
+    }
+}
+
+/*static*/ bool
+ESDeviceLocationManager::replayNextFix() {
+    ESAssert(ESThread::inMainThread());  // ESLocation expects its updates there
+    if (nextReplayFix >= replayFixes.size()) {
+        return false;
+    }
+    const ESReplayFix &fix = replayFixes[nextReplayFix++];
+    _lastLatitudeDegrees = fix.latitudeDegrees;
+    _lastLongitudeDegrees = fix.longitudeDegrees;
+    _lastAltitudeMeters = fix.altitudeMeters;
+    _lastAltitudeAccuracyMeters = fix.altitudeAccuracyMeters;
+    _lastLocationAccuracyMeters = fix.accuracyMeters;
+    _lastLocationTimestamp = replayBaseTime + (fix.unixTime - replayFixes[0].unixTime);
+    _lastLocationValid = true;
+    ESLocation::newDeviceLocationAvailable();
+    return true;
+}
+
+/*static*/ int
+ESDeviceLocationManager::numReplayFixesRemaining() {
+    return (int)(replayFixes.size() - nextReplayFix);
+}
+
+/*! Do initialization of infrastructure and retrieve last location, if any, but don't start updating yet */
+/*static*/ void
+ESDeviceLocationManager::init() {
+    ESAssert(ESThread::inMainThread());
+    const char *speed = getenv("ES_LOCATION_REPLAY_SPEED");
+    if (speed) {
+        setReplaySpeedFactor(atof(speed));
+    }
+    if (!replayConfigured) {
+        const char *replay = getenv("ES_LOCATION_REPLAY");
+        if (!replay) {
+            ESErrorReporter::logInfo("ESDeviceLocationManager::init", "No ES_LOCATION_REPLAY trace; the device will never have a location");
+            return;
+        }
+        if (strcmp(replay, "synthetic") == 0) {
+            setReplaySynthetic(37.3861, -122.0839, 30/*m/s*/, 45/*degrees*/, 1/*second*/, 3600);
+        } else {
+            setReplayTraceFile(replay);
+        }
+    }
+}
+
+/*static*/ void
+ESDeviceLocationManager::startUpdatingToAccuracyInMeters(double meters, bool enhanceForNavigation) {  // Called by ESLocation when it needs it
+    tracePrintf1("startUpdatingToAccuracyInMeters %.1f", meters);
+    updating = true;
+    if (replaySpeedFactor > 0 && !replayTimer && nextReplayFix < replayFixes.size()) {
+        installReplayTimer(0);
+    }
+}
+
+/*static*/ void
+ESDeviceLocationManager::stopUpdating() {
+    updating = false;
+    if (replayTimer) {
+        replayTimer->release();
+        replayTimer = NULL;
+    }
+}
+
+/*static*/ ESDeviceLocationAuthorization
+ESDeviceLocationManager::authorizationStatus() {
+    return replayFixes.empty() ? ESDeviceLocationAuthorizationUnknown : ESDeviceLocationAuthorizationAllowed;
+}
@@ -13,6 +13,7 @@
 //#include "ChronometerAppDelegate.h"
 #include "ESErrorReporter.hpp"
 #include "ESGeoNames.hpp"
+#include "ESGeoNamesHashTables.hpp"
 #include "ESLocation.hpp"
 #include "ESThread.hpp"
 //#include "ECWatchTime.h"
@@ -25,24 +26,54 @@
 #include <fcntl.h>  // For open
 #include <unistd.h>  // for lseek, read, close
 #include <stdlib.h>  // For malloc, free
+#include <string.h>  // For memset
 #include <algorithm>
+#include <map>
+#include <list>
+#include <vector>
 
-static ESLock *modifyLock;
+static ESLock *modifyLock;     // Guards sharedData and sharedDataRefCount
+static ESLock *numCitiesLock;  // Guards _numCities, _regionIndexBytes and _overlay (held only briefly, inside an array lock)
+static ESLock *arrayLocks[ESGeoNamesNumArrays];  // One per lazily loaded array, so loading one doesn't block users of another
 static ESGeoNamesData *sharedData;
 static int sharedDataRefCount = 0;
 
+static ESGeoNamesDataset currentDataset = ESGeoNamesDatasetCities1000;
+
+// Indexed by ESGeoNamesDataset
+static const char *datasetDirectories[ESGeoNamesNumDatasets] = {
+    "/eslocation",
+    "/eslocation/cities500",
+    "/eslocation/cities5000",
+    "/eslocation/cities15000",
+    "/eslocation/allCountries",
+};
+
+// Resource path of the named loc-*.dat file in the current dataset
+static std::string
+dataPath(const char *fileName) {
+    return std::string(datasetDirectories[currentDataset]) + "/" + fileName;
+}
+
+static std::string overlayPath;  // Empty for the dataset's own loc-overlay.dat
+static ESFilePathType overlayPathType = ESFilePathTypeRelativeToResourceDir;
+
 static void
 getAndRetainSharedDataObject() {
     if (!modifyLock) {
         ESAssert(ESThread::inMainThread());
         modifyLock = new ESLock;
+        numCitiesLock = new ESLock;
+        for (int i = 0; i < ESGeoNamesNumArrays; i++) {
+            arrayLocks[i] = new ESLock;
+        }
     }
     modifyLock->lock();
     if (!sharedData) {
-        ESAssert(sharedDataRefCount == 0);
         sharedData = new ESGeoNamesData;
-        sharedDataRefCount = 1;
     }
+    ESAssert(sharedDataRefCount >= 0);
+    sharedDataRefCount++;
     modifyLock->unlock();
 }
 
@@ -50,6 +81,7 @@ static void
 releaseSharedDataObject() {
     ESAssert(modifyLock);  // should have been created with getSharedDataObject() and never deleted
     modifyLock->lock();
+    ESAssert(sharedDataRefCount > 0);
     if (--sharedDataRefCount == 0) {
         sharedData->clearStorage();
         // sharedData object is never deleted
@@ -57,6 +89,62 @@ releaseSharedDataObject() {
     modifyLock->unlock();
 }
 
+// A thread that just runs what is sent to it with callInThread; used for prefetching and for parallel name scans
+class ESGeoNamesWorkerThread : public ESChildThread {
+  public:
+                            ESGeoNamesWorkerThread(const char *name)
+    :   ESChildThread(name, ESChildThreadExitsOnlyByParentRequest)
+    {
+    }
+
+    /*virtual*/ void        *main();
+};
+
+/*virtual*/ void *
+ESGeoNamesWorkerThread::main() {
+    while (true) {
+        fd_set readers;
+        FD_ZERO(&readers);
+        int highestThreadFD = ESThread::setBitsForSelect(&readers);
+        select(highestThreadFD + 1, &readers, NULL/*writers*/, NULL, NULL);
+        ESThread::processInterThreadMessages(&readers);
+    }
+    // Exit only happens through pthread_exit()
+    return NULL;
+}
+
+// Background loading for ESGeoNames(true).  Each worker owns one of the arrays the first search needs, so they
+// all load at once; a query that arrives early blocks (in ensureXXX) only on the array lock it actually needs.
+static const ESGeoNamesArray prefetchArrays[] = {
+    ESGeoNamesTZ,           // Slowest by far, since it instantiates every time zone; start it first
+    ESGeoNamesCityData,
+    ESGeoNamesCityNames,
+    ESGeoNamesNameIndices,
+};
+#define ES_NUM_PREFETCH_THREADS ((int)(sizeof(prefetchArrays) / sizeof(prefetchArrays[0])))
+static ESGeoNamesWorkerThread *prefetchThreads[ES_NUM_PREFETCH_THREADS];  // Started on first use, never exit
+
+static void
+prefetchGlue(void *obj,
+             void *param) {
+    ESGeoNamesData *data = (ESGeoNamesData *)obj;
+    data->ensureArray((ESGeoNamesArray)(long)param);
+    releaseSharedDataObject();  // Retained for us by startPrefetch
+}
+
+static void
+startPrefetch() {
+    ESAssert(ESThread::inMainThread());  // for prefetchThreads
+    for (int i = 0; i < ES_NUM_PREFETCH_THREADS; i++) {
+        if (!prefetchThreads[i]) {
+            prefetchThreads[i] = new ESGeoNamesWorkerThread("GeoNamesPrefetch");
+            prefetchThreads[i]->start();
+        }
+        getAndRetainSharedDataObject();  // So the data isn't cleared underneath the worker if the caller goes away first
+        prefetchThreads[i]->callInThread(prefetchGlue, sharedData, (void *)(long)prefetchArrays[i]);
+    }
+}
+
 template<class ElementType>
 static void checkFreeFileArray(ESFileArray<ElementType> **arr) {
     if (*arr) {
@@ -79,15 +167,51 @@ static void checkFreeFileStringArray(ESFileStringArray **arr) {
     }
 }
 
-ESGeoNames::ESGeoNames()
+// The named loc-*.dat file of NUL-terminated strings, sized by counting them, since the count depends on the dataset
+// (the tiers, and anything built by buildLocData -input or -minPopulation, have their own admin1, admin2 and zone lists)
+static ESFileStringArray *
+newStringArrayForDataFile(const char *fileName) {
+    std::string path = dataPath(fileName);
+    int numStrings = 0;
+    {
+        ESFileArray<unsigned char> file(path.c_str(), ESFilePathTypeRelativeToResourceDir);
+        const unsigned char *bytes = file.array();
+        size_t numBytes = bytes ? file.bytesRead() : 0;
+        for (size_t i = 0; i < numBytes; i++) {
+            if (bytes[i] == '\0') {
+                numStrings++;
+            }
+        }
+        if (numBytes > 0 && bytes[numBytes - 1] != '\0') {
+            numStrings++;  // Unterminated last string
+        }
+    }
+    return new ESFileStringArray(path.c_str(), ESFilePathTypeRelativeToResourceDir, numStrings);
+}
+
+static size_t bytesInStringArray(ESFileStringArray *arr) {
+    size_t bytes = arr->numStrings() * sizeof(const char *);
+    const char **ptr = arr->strings();
+    const char **end = ptr + arr->numStrings();
+    for (; ptr < end; ptr++) {
+        bytes += strlen(*ptr) + 1;
+    }
+    return bytes;
+}
+
+ESGeoNames::ESGeoNames(bool prefetchInBackground)
 :   _selectedCityIndex(-1),
     _sortedSearchIndices(NULL),
+    _sortedSearchCapacity(0),
     _numMatchingCities(0)
 {
     _numMatchingAtLevel[0] = 0;
     _numMatchingAtLevel[1] = 0;
     _numMatchingAtLevel[2] = 0;
     getAndRetainSharedDataObject();
+    if (prefetchInBackground) {
+        startPrefetch();
+    }
 }
 
 ESGeoNames::~ESGeoNames() {
@@ -95,6 +219,66 @@ ESGeoNames::~ESGeoNames() {
     checkFreeMallocArray((void**)&_sortedSearchIndices);
 }
 
+/*static*/ void
+ESGeoNames::setDataset(ESGeoNamesDataset dataset) {
+    ESAssert(ESThread::inMainThread());
+    ESAssert(dataset >= 0 && dataset < ESGeoNamesNumDatasets);
+    ESAssert(sharedDataRefCount == 0);  // Else arrays from the old set might be in use; they were all cleared when the count went to 0
+    currentDataset = dataset;
+}
+
+/*static*/ ESGeoNamesDataset
+ESGeoNames::dataset() {
+    return currentDataset;
+}
+
+/*static*/ void
+ESGeoNames::setOverlayPath(const char     *path,
+                           ESFilePathType pathType) {
+    ESAssert(ESThread::inMainThread());
+    ESAssert(sharedDataRefCount == 0);  // As setDataset
+    overlayPath = path ? path : "";
+    overlayPathType = pathType;
+}
+
+static size_t memoryBudget = 0;  // 0 => no budget
+
+/*static*/ void
+ESGeoNames::setMemoryBudget(size_t budgetBytes) {
+    ESAssert(ESThread::inMainThread());
+    memoryBudget = budgetBytes;
+    trimToBudget();
+}
+
+/*static*/ size_t
+ESGeoNames::trimToBudget() {
+    ESAssert(ESThread::inMainThread());
+    if (!memoryBudget) {
+        return bytesInUse();
+    }
+    return trimToBytes(memoryBudget);
+}
+
+/*static*/ size_t
+ESGeoNames::trimToBytes(size_t budgetBytes) {
+    ESAssert(ESThread::inMainThread());
+    if (!sharedData) {
+        return 0;
+    }
+    modifyLock->lock();  // Keep the refcount from dropping to zero (and clearStorage running) underneath us
+    size_t bytes = sharedData->trimToBudget(budgetBytes);
+    modifyLock->unlock();
+    return bytes;
+}
+
+/*static*/ size_t
+ESGeoNames::bytesInUse() {
+    if (!sharedData) {
+        return 0;
+    }
+    return sharedData->bytesInUse();
+}
+
 // Ideally we'd add the country/city index here, but it's only 16 bits and padding would waste 16 bits.
 // If we ever need another 16 bits anyway, we could put all 32 here.
 struct ESCityData {
@@ -109,6 +293,103 @@ struct ESRegionDesc {
     short a2Index;
 };
 
+// As stored by datasets with too many regions or admin2s for a short (see ESGeoNamesData::regionIndexBytes), and
+// as the region accessors return either kind
+struct ESWideRegionDesc {
+    ESINT32 ccIndex;
+    ESINT32 a1Index;
+    ESINT32 a2Index;
+};
+
+// See data/makeRasters.pl for the layouts of the rasters
+#define ES_GEONAMES_TZ_RASTER_HEADER_SIZE 4       // cellsPerDegree, blockSize, tzNames checksum (2)
+#define ES_GEONAMES_TZ_RASTER_DETAIL_FLAG 0x8000  // In a block entry:  the rest is a detail record number
+#define ES_GEONAMES_TZ_RASTER_BORDER 0x7fff       // Cell value:  more than one zone is possible, so find the closest city
+
+#define ES_GEONAMES_CC_RASTER_HEADER_SIZE 4       // cellsPerDegree, numCountries, numRuns (2)
+#define ES_GEONAMES_CC_RASTER_BORDER 0xff         // Run value:  more than one country is possible, so find the closest city
+
+// The overlay file, loc-overlay.dat, holds corrections to a dataset that ship without rebuilding its loc-*.dat files
+// (buildLocData -overlay makes it).  It's
+//   an ESGeoNamesOverlayHeader
+//   numRegionDescs ESWideRegionDescs, added to the dataset's regions (so the first is region baseNumRegionDescs)
+//   numCities ESGeoNamesOverlayCitys, each changing the given fields of one city, or adding a city (which then gets
+//     the next index after the dataset's cities, in order)
+//   numTZRasterCells and numCCRasterCells ESGeoNamesOverlayRasterCells, in increasing cell order, the cells of
+//     loc-tzRaster.dat and loc-ccRaster.dat whose value the corrections change
+//   namesBytes of names, each null-terminated, in the form of loc-names.dat ("searchName+displayName")
+// The header names the dataset it was made for by its city and region counts and tzNames checksum, and the
+// overlay is ignored for any other.  It's applied to each per-city array as the array is loaded (see
+// readOverlay), so the search paths need no changes except to pass over suppressed cities; the raster lookups check
+// its cells before the raster's.
+#define ES_GEONAMES_OVERLAY_MAGIC 0x564f5345  // "ESOV"
+#define ES_GEONAMES_OVERLAY_VERSION 2
+
+struct ESGeoNamesOverlayHeader {
+    ESUINT32 magic;
+    ESUINT32 version;
+    ESUINT32 tzNamesChecksum;
+    ESINT32  baseNumCities;
+    ESINT32  baseNumRegionDescs;
+    ESINT32  numRegionDescs;
+    ESINT32  numCities;
+    ESINT32  rasterCellsPerDegree;  // Of the rasters the cells are for
+    ESINT32  numTZRasterCells;
+    ESINT32  numCCRasterCells;
+    ESINT32  namesBytes;
+};
+
+// Bits in ESGeoNamesOverlayCity::fields
+#define ES_GEONAMES_OVERLAY_NAME       0x01
+#define ES_GEONAMES_OVERLAY_POPULATION 0x02
+#define ES_GEONAMES_OVERLAY_LOCATION   0x04
+#define ES_GEONAMES_OVERLAY_TZ         0x08
+#define ES_GEONAMES_OVERLAY_REGION     0x10
+#define ES_GEONAMES_OVERLAY_SUPPRESS   0x20  // Keeps its index (so saved indices stay good), but no search or lookup finds it
+#define ES_GEONAMES_OVERLAY_ADD_FIELDS 0x1f  // What an added city must have
+
+struct ESGeoNamesOverlayCity {
+    ESINT32  cityIndex;    // -1 to add a city
+    ESUINT32 fields;
+    ESINT32  nameOffset;   // In the overlay's names
+    ESUINT32 population;
+    float    latitude;
+    float    longitude;
+    ESINT32  tzIndex;
+    ESINT32  regionIndex;
+};
+
+struct ESGeoNamesOverlayRasterCell {
+    ESINT32  cell;         // row * (360 * cellsPerDegree) + column, as the raster lookups find them
+    ESINT32  value;        // The zone or country index, or the raster's border value
+};
+
+struct ESGeoNamesOverlay {
+    ESGeoNamesOverlayHeader header;
+    std::vector<ESWideRegionDesc> regionDescs;
+    std::vector<ESGeoNamesOverlayCity> cities;  // With each added city's index filled in
+    std::vector<char>       names;
+    std::vector<ESUINT32>   suppressedCityBits;  // One bit per city (including added ones); empty if none are suppressed
+    std::vector<ESGeoNamesOverlayRasterCell> tzRasterCells;
+    std::vector<ESGeoNamesOverlayRasterCell> ccRasterCells;
+    int                     numCities;           // Including added ones
+};
+
+// Grid cell cache for findClosestCityToLatitudeDegrees; see there
+struct ESGeoNamesCellCache {
+    typedef std::list<ESINT64> LRUList;         // Most recently used first
+    struct Cell {
+        std::vector<int>  candidates;           // City indices, in index order
+        float             nonCandidateMinKm;    // Distance from the cell center to the closest city that isn't a candidate
+        LRUList::iterator lruPosition;
+    };
+    typedef std::map<ESINT64, Cell> CellMap;
+
+    ESLock                  lock;
+    CellMap                 cells;
+    LRUList                 lru;
+};
+
 ESGeoNamesData::ESGeoNamesData()
 :   _numCities(-1),
     _cityNames(NULL),
@@ -116,16 +397,47 @@ ESGeoNamesData::ESGeoNamesData()
     _cityData(NULL),
     _ccNames(NULL),
     _ccCodes(NULL),
+    _ccCodesHashed(false),
     _a1Names(NULL),
     _a2Names(NULL),
     _a1Codes(NULL),
+    _a1CodesHashed(false),
     _tzIndices(NULL),
     _tzNames(NULL),
+    _tzNamesHashed(false),
     _tzCache(NULL),
+    _tzCacheSpare(NULL),
+    _tzCacheExpiration(0),
+    _tzSlotClasses(NULL),
+    _slotCityBits(NULL),
+    _slotCityBitsSpare(NULL),
+    _slotCityBitsWordsPerSlot(0),
+    _populationOrder(NULL),
+    _logPopulations(NULL),
+    _tzRaster(NULL),
+    _tzRasterUsable(false),
+    _ccRaster(NULL),
+    _ccRasterUsable(false),
+    _closestCityCache(new ESGeoNamesCellCache),
+    _cityGridStarts(NULL),
+    _cityGridCities(NULL),
+    _cityGridDegrees(0),
+    _cityGridRows(0),
+    _cityGridColumns(0),
+    _airports(NULL),
+    _airportsUsable(false),
     _cityRegions(NULL),
     _regionDescs(NULL),
-    _numRegionDescs(0)
+    _regionIndexBytes(0),
+    _numRegionDescs(0),
+    _overlay(NULL),
+    _overlayRead(false),
+    _useTick(0)
 {
+    for (int i = 0; i < ESGeoNamesNumArrays; i++) {
+        _arrayBytes[i] = 0;
+        _arrayLastUse[i] = 0;
+    }
 }
 
 ESGeoNamesData::~ESGeoNamesData() {
@@ -133,15 +445,33 @@ ESGeoNamesData::~ESGeoNamesData() {
     clearStorage();
 }
 
+// Called with modifyLock held.  Array locks are taken in enum order, so that refreshExpiredTimezones (which takes
+// ESGeoNamesSlotCityBits while holding ESGeoNamesTZ) can't deadlock against us.
 void
 ESGeoNamesData::clearStorage() {
-    checkFreeFileArray<char>(&_cityNames);
+    for (int i = 0; i < ESGeoNamesNumArrays; i++) {
+        arrayLocks[i]->lock();
+    }
+    checkFreeFileArray<unsigned char>(&_cityNames);
     checkFreeFileArray<short>(&_ccCodes);
     checkFreeFileArray<int>(&_nameIndices);
     checkFreeFileArray<ESCityData>(&_cityData);
     checkFreeFileArray<short>(&_cityRegions);
     checkFreeFileArray<ESRegionDesc>(&_regionDescs);
     checkFreeFileArray<ESTZData>(&_tzCache);
+    checkFreeFileArray<ESTZData>(&_tzCacheSpare);
+    _tzCacheExpiration = 0;
+    checkFreeMallocArray((void**)&_tzSlotClasses);
+    checkFreeMallocArray((void**)&_slotCityBits);
+    checkFreeMallocArray((void**)&_slotCityBitsSpare);
+    checkFreeMallocArray((void**)&_populationOrder);
+    checkFreeMallocArray((void**)&_logPopulations);
+    checkFreeFileArray<unsigned short>(&_tzRaster);
+    checkFreeFileArray<unsigned char>(&_ccRaster);
+    checkFreeMallocArray((void**)&_cityGridStarts);
+    checkFreeMallocArray((void**)&_cityGridCities);
+    checkFreeFileArray<ESUINT32>(&_airports);
+    clearClosestCityCache();  // Its contents are city indices, which are only good for this cityData
     checkFreeFileStringArray(&_ccNames);
     checkFreeFileStringArray(&_a1Names);
     checkFreeFileStringArray(&_a2Names);
@@ -150,10 +480,21 @@ ESGeoNamesData::clearStorage() {
     checkFreeFileStringArray(&_tzNames);
     _numCities = -1;
     _numRegionDescs = -1;
+    _regionIndexBytes = 0;  // The next dataset may differ
+    delete _overlay;        // As may its overlay
+    _overlay = NULL;
+    _overlayRead = false;
+    for (int i = 0; i < ESGeoNamesNumArrays; i++) {
+        _arrayBytes[i] = 0;
+    }
+    for (int i = ESGeoNamesNumArrays - 1; i >= 0; i--) {
+        arrayLocks[i]->unlock();
+    }
 }
 
 void
 ESGeoNamesData::qualifyNumCities(int numCitiesRead) {
+    numCitiesLock->lock();  // Several arrays may be loading at once
     if (_numCities < 0) {
 	_numCities = numCitiesRead;
     } else {
@@ -162,49 +503,424 @@ ESGeoNamesData::qualifyNumCities(int numCitiesRead) {
 	    exit(1);
 	}
     }
+    numCitiesLock->unlock();
+}
+
+static inline bool
+bitIsSet(const ESUINT32 *bits,
+         int            indx) {
+    return (bits[indx >> 5] >> (indx & 31)) & 1;
+}
+
+// In increasing order, on the raster's grid, and each value no more than the border value
+static bool
+rasterCellsAreValid(const std::vector<ESGeoNamesOverlayRasterCell> &cells,
+                    int                                            cellsPerDegree,
+                    int                                            borderValue) {
+    int numCells = cellsPerDegree > 0 && cellsPerDegree <= 3600 ? 180 * cellsPerDegree * 360 * cellsPerDegree : 0;
+    int lastCell = -1;
+    for (size_t i = 0; i < cells.size(); i++) {
+        if (cells[i].cell <= lastCell || cells[i].cell >= numCells || cells[i].value < 0 || cells[i].value > borderValue) {
+            return false;
+        }
+        lastCell = cells[i].cell;
+    }
+    return true;
+}
+
+// The overlay's value for the given raster cell, or -1 if it doesn't change that cell
+static int
+overlayRasterCellValue(const std::vector<ESGeoNamesOverlayRasterCell> &cells,
+                       int                                            cell) {
+    int lo = 0;
+    int hi = (int)cells.size();
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (cells[mid].cell < cell) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo < (int)cells.size() && cells[lo].cell == cell ? cells[lo].value : -1;
+}
+
+// Reads and checks the overlay for the current dataset (see ESGeoNamesOverlayHeader); NULL if there isn't one, or it's bad
+static ESGeoNamesOverlay *
+readOverlay(int regionIndexBytes) {
+    std::string path = overlayPath.empty() ? dataPath("loc-overlay.dat") : overlayPath;
+    ESFileArray<unsigned char> file(path.c_str(), overlayPath.empty() ? ESFilePathTypeRelativeToResourceDir : overlayPathType);
+    size_t bytesRead = file.bytesRead();
+    if (bytesRead == 0) {
+        return NULL;  // The usual case:  nothing to correct
+    }
+    const unsigned char *bytes = file.array();
+    ESGeoNamesOverlayHeader header;
+    const char *problem = NULL;
+    if (bytesRead < sizeof(header)) {
+        problem = "is truncated";
+    } else {
+        memcpy(&header, bytes, sizeof(header));
+        if (header.magic != ES_GEONAMES_OVERLAY_MAGIC || header.version != ES_GEONAMES_OVERLAY_VERSION) {
+            problem = "isn't an overlay this code understands";
+        } else if (header.numRegionDescs < 0 || header.numCities < 0 || header.namesBytes < 0 ||
+                   header.numTZRasterCells < 0 || header.numCCRasterCells < 0 ||
+                   bytesRead != sizeof(header) + header.numRegionDescs * sizeof(ESWideRegionDesc)
+                                + header.numCities * sizeof(ESGeoNamesOverlayCity)
+                                + (header.numTZRasterCells + header.numCCRasterCells) * sizeof(ESGeoNamesOverlayRasterCell)
+                                + header.namesBytes) {
+            problem = "is truncated";
+        } else if (header.tzNamesChecksum != ESFile::readSingleUnsignedFromFile(dataPath("loc-tzNames.sum").c_str(), ESFilePathTypeRelativeToResourceDir)) {
+            problem = "was made for another dataset";
+        } else {
+            // loc-tz.dat is the smallest of the per-city files
+            ESFileArray<short> tzIndices(dataPath("loc-tz.dat").c_str(), ESFilePathTypeRelativeToResourceDir);
+            ESFileArray<unsigned char> regionDescs(dataPath("loc-regiondesc.dat").c_str(), ESFilePathTypeRelativeToResourceDir);
+            if ((int)(tzIndices.bytesRead() / sizeof(short)) != header.baseNumCities ||
+                (int)(regionDescs.bytesRead() / (3 * regionIndexBytes)) != header.baseNumRegionDescs) {
+                problem = "was made for another dataset";
+            }
+        }
+    }
+    ESGeoNamesOverlay *overlay = NULL;
+    if (!problem) {
+        overlay = new ESGeoNamesOverlay;
+        overlay->header = header;
+        const unsigned char *ptr = bytes + sizeof(header);
+        const ESWideRegionDesc *regionDescs = (const ESWideRegionDesc *)ptr;
+        overlay->regionDescs.assign(regionDescs, regionDescs + header.numRegionDescs);
+        ptr += header.numRegionDescs * sizeof(ESWideRegionDesc);
+        const ESGeoNamesOverlayCity *cities = (const ESGeoNamesOverlayCity *)ptr;
+        overlay->cities.assign(cities, cities + header.numCities);
+        ptr += header.numCities * sizeof(ESGeoNamesOverlayCity);
+        const ESGeoNamesOverlayRasterCell *rasterCells = (const ESGeoNamesOverlayRasterCell *)ptr;
+        overlay->tzRasterCells.assign(rasterCells, rasterCells + header.numTZRasterCells);
+        rasterCells += header.numTZRasterCells;
+        overlay->ccRasterCells.assign(rasterCells, rasterCells + header.numCCRasterCells);
+        ptr += (header.numTZRasterCells + header.numCCRasterCells) * sizeof(ESGeoNamesOverlayRasterCell);
+        overlay->names.assign((const char *)ptr, (const char *)ptr + header.namesBytes);
+        overlay->numCities = header.baseNumCities;
+        if (!rasterCellsAreValid(overlay->tzRasterCells, header.rasterCellsPerDegree, ES_GEONAMES_TZ_RASTER_BORDER) ||
+            !rasterCellsAreValid(overlay->ccRasterCells, header.rasterCellsPerDegree, ES_GEONAMES_CC_RASTER_BORDER)) {
+            problem = "has bad raster cells";
+        }
+        int numRegions = header.baseNumRegionDescs + header.numRegionDescs;
+        int maxIndex = regionIndexBytes == 4 ? 0x7fffffff : 0x7fff;  // Region indices are read as signed
+        if (numRegions > maxIndex) {
+            problem = "has too many regions for this dataset";
+        }
+        for (int i = 0; i < header.numRegionDescs; i++) {
+            const ESWideRegionDesc &desc = overlay->regionDescs[i];
+            if (desc.ccIndex > maxIndex || desc.a1Index > maxIndex || desc.a2Index > maxIndex) {
+                problem = "has too many regions for this dataset";
+            }
+        }
+        bool anySuppressed = false;
+        for (int i = 0; i < header.numCities && !problem; i++) {
+            ESGeoNamesOverlayCity &city = overlay->cities[i];
+            if (city.cityIndex < 0) {
+                if ((city.fields & ES_GEONAMES_OVERLAY_ADD_FIELDS) != ES_GEONAMES_OVERLAY_ADD_FIELDS ||
+                    (city.fields & ES_GEONAMES_OVERLAY_SUPPRESS)) {
+                    problem = "adds a city without all of its fields";
+                }
+                city.cityIndex = overlay->numCities++;
+            } else if (city.cityIndex >= header.baseNumCities) {
+                problem = "changes a city that isn't there";
+            }
+            if ((city.fields & ES_GEONAMES_OVERLAY_NAME) &&
+                (city.nameOffset < 0 || city.nameOffset >= header.namesBytes ||
+                 !memchr(&overlay->names[city.nameOffset], '\0',
+                         std::min(header.namesBytes - city.nameOffset, ES_GEONAMES_NAME_BUFFER_SIZE - 8)))) {
+                problem = "has a bad name";
+            }
+            if ((city.fields & ES_GEONAMES_OVERLAY_REGION) && (city.regionIndex < 0 || city.regionIndex >= numRegions)) {
+                problem = "has a bad region";
+            }
+            if ((city.fields & ES_GEONAMES_OVERLAY_TZ) && (city.tzIndex < 0 || city.tzIndex > 0x7fff)) {
+                problem = "has a bad time zone";
+            }
+            anySuppressed = anySuppressed || (city.fields & ES_GEONAMES_OVERLAY_SUPPRESS);
+        }
+        if (anySuppressed && !problem) {
+            overlay->suppressedCityBits.resize((overlay->numCities + 31) / 32);
+            for (int i = 0; i < header.numCities; i++) {
+                const ESGeoNamesOverlayCity &city = overlay->cities[i];
+                if (city.fields & ES_GEONAMES_OVERLAY_SUPPRESS) {
+                    overlay->suppressedCityBits[city.cityIndex >> 5] |= 1U << (city.cityIndex & 31);
+                }
+            }
+        }
+    }
+    if (problem) {
+        ESErrorReporter::logError("ESGeoNames", "%s %s; ignoring it", path.c_str(), problem);
+        delete overlay;
+        return NULL;
+    }
+    ESErrorReporter::logInfo("ESGeoNames", "%s:  %d city corrections (%d added), %d regions added",
+                             path.c_str(), header.numCities, overlay->numCities - header.baseNumCities, header.numRegionDescs);
+    return overlay;
+}
+
+// The overlay for the current dataset, or NULL if there isn't one.  Read on the first load of any per-city array, so
+// they all see the same one; after that it doesn't change until clearStorage.
+ESGeoNamesOverlay *
+ESGeoNamesData::overlay() {
+    int indexBytes = regionIndexBytes();  // Before we take numCitiesLock, which it takes too
+    numCitiesLock->lock();
+    if (!_overlayRead) {
+        _overlay = readOverlay(indexBytes);
+        _overlayRead = true;
+    }
+    ESGeoNamesOverlay *overlay = _overlay;
+    numCitiesLock->unlock();
+    return overlay;
+}
+
+// One bit per city, set if the overlay suppressed it; NULL if it suppressed none.  Only call once a per-city array has
+// been loaded, after which _overlay is fixed.
+const ESUINT32 *
+ESGeoNamesData::suppressedCityBits() {
+    return _overlay && !_overlay->suppressedCityBits.empty() ? &_overlay->suppressedCityBits[0] : NULL;
+}
+
+// Replaces a loaded array with a writable copy holding numElements, the first numBaseElements from the file and the
+// rest zero, for the overlay to change
+template<class ElementType> static ESFileArray<ElementType> *
+overlayCopyOfFileArray(ESFileArray<ElementType> *baseArray,
+                       int                      numBaseElements,
+                       int                      numElements) {
+    ESAssert(baseArray->bytesRead() == numBaseElements * sizeof(ElementType));
+    ESFileArray<ElementType> *arr = new ESFileArray<ElementType>("ThisFileShouldNeverExist.dat", ESFilePathTypeRelativeToAppSupportDir, false /* don't try reading */);
+    arr->setupForWriteWithNumElements(numElements);
+    memcpy(arr->writableArray(), baseArray->array(), numBaseElements * sizeof(ElementType));
+    delete baseArray;
+    return arr;
 }
 
 void
 ESGeoNamesData::readCityData() {
     traceEnter("ESGeoNamesData::readCityData");
-    _cityData = new ESFileArray<ESCityData>("/eslocation/loc-data.dat", ESFilePathTypeRelativeToResourceDir);
+    _cityData = new ESFileArray<ESCityData>(dataPath("loc-data.dat").c_str(), ESFilePathTypeRelativeToResourceDir);
     size_t bytesRead = _cityData->bytesRead();
     ESAssert(bytesRead != 0);
     ESErrorReporter::logInfo("GeoNames", "%d bytes read of %s, first byte is 0x%016lx (%ld)", bytesRead, "loc-data.dat", _cityData->array()[0].population,  _cityData->array()[0].population);
-    qualifyNumCities((int)(bytesRead / sizeof(ESCityData)));
+    int numCitiesRead = (int)(bytesRead / sizeof(ESCityData));
+    ESGeoNamesOverlay *overlay = this->overlay();
+    if (overlay) {
+        _cityData = overlayCopyOfFileArray(_cityData, numCitiesRead, overlay->numCities);
+        ESCityData *cityData = _cityData->writableArray();
+        for (std::vector<ESGeoNamesOverlayCity>::const_iterator city = overlay->cities.begin(); city != overlay->cities.end(); city++) {
+            ESCityData *data = cityData + city->cityIndex;
+            if (city->fields & ES_GEONAMES_OVERLAY_POPULATION) {
+                data->population = city->population;
+            }
+            if (city->fields & ES_GEONAMES_OVERLAY_LOCATION) {
+                data->latitude = city->latitude;
+                data->longitude = city->longitude;
+            }
+            if (city->fields & ES_GEONAMES_OVERLAY_SUPPRESS) {
+                data->population = 0;  // So the searches in population order never reach it
+            }
+        }
+        numCitiesRead = overlay->numCities;
+    }
+    qualifyNumCities(numCitiesRead);
     traceExit("ESGeoNamesData::readCityData");
 }
 
 void
 ESGeoNamesData::readCityNames() {
     traceEnter("ESGeoNamesData::readCityNames");
-    _cityNames = new ESFileArray<char>("/eslocation/loc-names.dat", ESFilePathTypeRelativeToResourceDir);
+    _cityNames = new ESFileArray<unsigned char>(dataPath("loc-names-fsst.dat").c_str(), ESFilePathTypeRelativeToResourceDir);
+    ESAssert(_cityNames->bytesRead() > ES_GEONAMES_SYMBOL_TABLE_SIZE);
     traceExit("ESGeoNamesData::readCityNames");
 }
 
+// A name from the overlay isn't added to the compressed names; its index is -1 - its offset in the overlay's names
+// instead (see decodeNameAtNameIndex).
 void
 ESGeoNamesData::readNameIndices() {
-    _nameIndices = new ESFileArray<int>("/eslocation/loc-index.dat", ESFilePathTypeRelativeToResourceDir);
+    _nameIndices = new ESFileArray<int>(dataPath("loc-index-fsst.dat").c_str(), ESFilePathTypeRelativeToResourceDir);
     size_t bytesRead = _nameIndices->bytesRead();
-    qualifyNumCities((int)(bytesRead / sizeof(int)));
+    int numCitiesRead = (int)(bytesRead / sizeof(int));
+    ESGeoNamesOverlay *overlay = this->overlay();
+    if (overlay) {
+        _nameIndices = overlayCopyOfFileArray(_nameIndices, numCitiesRead, overlay->numCities);
+        int *nameIndices = _nameIndices->writableArray();
+        for (std::vector<ESGeoNamesOverlayCity>::const_iterator city = overlay->cities.begin(); city != overlay->cities.end(); city++) {
+            if (city->fields & ES_GEONAMES_OVERLAY_NAME) {
+                nameIndices[city->cityIndex] = -1 - city->nameOffset;
+            }
+        }
+        numCitiesRead = overlay->numCities;
+    }
+    qualifyNumCities(numCitiesRead);
+}
+
+// The shipped set has few enough regions (and admin1s and admin2s) to index them with shorts.  A dataset with more
+// has 32-bit indices in loc-region.dat and loc-regiondesc.dat, and says so with a loc-regionIndexBytes.dat holding 4.
+int
+ESGeoNamesData::regionIndexBytes() {
+    numCitiesLock->lock();
+    if (!_regionIndexBytes) {
+        ESFileArray<ESUINT32> indexBytes(dataPath("loc-regionIndexBytes.dat").c_str(), ESFilePathTypeRelativeToResourceDir);
+        _regionIndexBytes = indexBytes.bytesRead() == sizeof(ESUINT32) && indexBytes.array()[0] == 4 ? 4 : 2;
+    }
+    int bytes = _regionIndexBytes;
+    numCitiesLock->unlock();
+    return bytes;
 }
 
 void
 ESGeoNamesData::readRegions() {
-    _cityRegions = new ESFileArray<short>("/eslocation/loc-region.dat", ESFilePathTypeRelativeToResourceDir);
+    int indexBytes = regionIndexBytes();
+    _cityRegions = new ESFileArray<short>(dataPath("loc-region.dat").c_str(), ESFilePathTypeRelativeToResourceDir);
     size_t bytesRead = _cityRegions->bytesRead();
-    qualifyNumCities((int)(bytesRead / sizeof(short)));
+    int numCitiesRead = (int)(bytesRead / indexBytes);
+    ESGeoNamesOverlay *overlay = this->overlay();
+    if (overlay) {
+        int shortsPerCity = indexBytes / sizeof(short);
+        _cityRegions = overlayCopyOfFileArray(_cityRegions, numCitiesRead * shortsPerCity, overlay->numCities * shortsPerCity);
+        short *cityRegions = _cityRegions->writableArray();
+        for (std::vector<ESGeoNamesOverlayCity>::const_iterator city = overlay->cities.begin(); city != overlay->cities.end(); city++) {
+            if (city->fields & ES_GEONAMES_OVERLAY_REGION) {
+                if (indexBytes == 4) {
+                    ((ESINT32 *)cityRegions)[city->cityIndex] = city->regionIndex;
+                } else {
+                    cityRegions[city->cityIndex] = (short)city->regionIndex;
+                }
+            }
+        }
+        numCitiesRead = overlay->numCities;
+    }
+    qualifyNumCities(numCitiesRead);
 }
 
 void
 ESGeoNamesData::readRegionDescs() {
     traceEnter("readRegionDescs");
-    _regionDescs = new ESFileArray<ESRegionDesc>("/eslocation/loc-regiondesc.dat", ESFilePathTypeRelativeToResourceDir);
+    int indexBytes = regionIndexBytes();
+    _regionDescs = new ESFileArray<ESRegionDesc>(dataPath("loc-regiondesc.dat").c_str(), ESFilePathTypeRelativeToResourceDir);
     size_t bytesRead = _regionDescs->bytesRead();
-    _numRegionDescs = (int)(bytesRead / sizeof(ESRegionDesc));
+    _numRegionDescs = (int)(bytesRead / (3 * indexBytes));
+    ESGeoNamesOverlay *overlay = this->overlay();
+    if (overlay && !overlay->regionDescs.empty()) {
+        int descsPerRegion = indexBytes / sizeof(short);  // In ESRegionDescs, the array's type
+        int numRegions = _numRegionDescs + (int)overlay->regionDescs.size();
+        _regionDescs = overlayCopyOfFileArray(_regionDescs, _numRegionDescs * descsPerRegion, numRegions * descsPerRegion);
+        for (size_t i = 0; i < overlay->regionDescs.size(); i++) {
+            const ESWideRegionDesc &desc = overlay->regionDescs[i];
+            if (indexBytes == 4) {
+                ((ESWideRegionDesc *)_regionDescs->writableArray())[_numRegionDescs + i] = desc;
+            } else {
+                ESRegionDesc *regionDesc = _regionDescs->writableArray() + _numRegionDescs + i;
+                regionDesc->ccIndex = (short)desc.ccIndex;
+                regionDesc->a1Index = (short)desc.a1Index;
+                regionDesc->a2Index = (short)desc.a2Index;
+            }
+        }
+        _numRegionDescs = numRegions;
+    }
     traceExit("readRegionDescs");
 }
 
+// Call ensureRegions first
+int
+ESGeoNamesData::regionIndexForCity(int cityIndex) {
+    ESAssert(_cityRegions);
+    ESAssert(cityIndex >= 0 && cityIndex < _numCities);
+    if (_regionIndexBytes == 4) {
+        return ((const ESINT32 *)_cityRegions->array())[cityIndex];
+    }
+    return _cityRegions->array()[cityIndex];
+}
+
+// Call ensureRegionDescs first
+void
+ESGeoNamesData::regionDescAtIndex(int              regionIndex,
+                                  ESWideRegionDesc *descReturn) {
+    ESAssert(_regionDescs);
+    ESAssert(regionIndex >= 0 && regionIndex < _numRegionDescs);
+    if (_regionIndexBytes == 4) {
+        *descReturn = ((const ESWideRegionDesc *)_regionDescs->array())[regionIndex];
+    } else {
+        const ESRegionDesc *regionDesc = _regionDescs->array() + regionIndex;
+        descReturn->ccIndex = regionDesc->ccIndex;
+        descReturn->a1Index = regionDesc->a1Index;
+        descReturn->a2Index = regionDesc->a2Index;
+    }
+}
+
+// With an overlay, the files may be wrong, so these load the arrays after all
+int
+ESGeoNamesData::readRegionIndexFromFile(int cityIndex) {
+    if (overlay()) {
+        ensureRegions();
+        return regionIndexForCity(cityIndex);
+    }
+    if (regionIndexBytes() == 4) {
+        ESINT32 regionIndex;
+        ESFileArray<ESINT32>::readElementFromFileAtIndex(dataPath("loc-region.dat").c_str(), ESFilePathTypeRelativeToResourceDir, cityIndex, &regionIndex);
+        return regionIndex;
+    }
+    short regionIndex;
+    ESFileArray<short>::readElementFromFileAtIndex(dataPath("loc-region.dat").c_str(), ESFilePathTypeRelativeToResourceDir, cityIndex, &regionIndex);
+    return regionIndex;
+}
+
+void
+ESGeoNamesData::readRegionDescFromFile(int              regionIndex,
+                                       ESWideRegionDesc *descReturn) {
+    if (overlay()) {
+        ensureRegionDescs();
+        regionDescAtIndex(regionIndex, descReturn);
+        return;
+    }
+    if (regionIndexBytes() == 4) {
+        ESFileArray<ESWideRegionDesc>::readElementFromFileAtIndex(dataPath("loc-regiondesc.dat").c_str(), ESFilePathTypeRelativeToResourceDir, regionIndex, descReturn);
+        return;
+    }
+    ESRegionDesc regionDesc;
+    ESFileArray<ESRegionDesc>::readElementFromFileAtIndex(dataPath("loc-regiondesc.dat").c_str(), ESFilePathTypeRelativeToResourceDir, regionIndex, &regionDesc);
+    descReturn->ccIndex = regionDesc.ccIndex;
+    descReturn->a1Index = regionDesc.a1Index;
+    descReturn->a2Index = regionDesc.a2Index;
+}
+
+// Fill in the offsets for the named zone as of the given time.  The currentOffset and nextTransition
+// fields are only good until nextTransition; see refreshExpiredTimezones.
+static void
+setupTZDataForTimeZoneName(const char     *tzName,
+                           ESTimeInterval now,
+                           ESTZData       *tzCacheEntry) {
+    ESTimeZone *estz = ESCalendar_initTimeZoneFromOlsonID(tzName);
+#ifndef NDEBUG
+    if (!estz) {
+	printf("Couldn't construct ESTimeZone with name %s\n", tzName);
+    }
+    ESAssert(estz);
+#endif
+    int currentOffset = (int)rint(ESCalendar_tzOffsetForTimeInterval(estz, now));
+    ESAssert((currentOffset % 60) == 0);
+    tzCacheEntry->currentOffset = currentOffset / 60;
+    tzCacheEntry->nextTransition = ESCalendar_nextDSTChangeAfterTimeInterval(estz, now);
+    if (tzCacheEntry->nextTransition) {
+	ESAssert(tzCacheEntry->nextTransition > now);
+	int postTransitionOffset = (int)rint(ESCalendar_tzOffsetForTimeInterval(estz, tzCacheEntry->nextTransition + 7200));
+	ESAssert((postTransitionOffset % 60) == 0);
+	ESAssert(currentOffset - postTransitionOffset <= 3600);  // no DST transition greater than an hour
+	tzCacheEntry->stdOffset = 
+            (currentOffset < postTransitionOffset ? currentOffset : postTransitionOffset) / 60;
+	tzCacheEntry->dstOffset = 
+            (currentOffset < postTransitionOffset ? postTransitionOffset : currentOffset) / 60;
+    } else {
+	tzCacheEntry->stdOffset
+            = tzCacheEntry->dstOffset 
+            = tzCacheEntry->currentOffset;
+    }
+    ESCalendar_releaseTimeZone(estz);
+}
+
 void
 ESGeoNamesData::setupTimezoneRangeTable() {
     traceEnter("setupTimezoneRangeTable");
@@ -213,43 +929,119 @@ ESGeoNamesData::setupTimezoneRangeTable() {
     ESAssert(_tzIndices);
     const char **ptr = _tzNames->strings();
     const char **end = ptr + _tzNames->numStrings();
+    ESTimeInterval now = ESTime::currentTime();
+    _tzCacheExpiration = 0;
     for (int i = 0; ptr < end; ptr++, i++) {
         const char *tzName = *ptr;
 	ESAssert(tzName == _tzNames->stringAtIndex(i));
-	ESTimeZone *estz = ESCalendar_initTimeZoneFromOlsonID(tzName);
-#ifndef NDEBUG
-	if (!estz) {
-	    printf("Couldn't construct ESTimeZone with name %s\n", tzName);
-	}
-	ESAssert(estz);
-#endif
         ESTZData *tzCacheEntry = &_tzCache->writableArray()[i];
-
-	ESTimeInterval now = ESTime::currentTime();
-        int currentOffset = (int)rint(ESCalendar_tzOffsetForTimeInterval(estz, now));
-	ESAssert((currentOffset % 60) == 0);
-        tzCacheEntry->currentOffset = currentOffset / 60;
-        tzCacheEntry->nextTransition = ESCalendar_nextDSTChangeAfterTimeInterval(estz, now);
-	if (tzCacheEntry->nextTransition) {
-	    ESAssert(tzCacheEntry->nextTransition > now);
-	    int postTransitionOffset = (int)rint(ESCalendar_tzOffsetForTimeInterval(estz, tzCacheEntry->nextTransition + 7200));
-	    ESAssert((postTransitionOffset % 60) == 0);
-	    ESAssert(currentOffset - postTransitionOffset <= 3600);  // no DST transition greater than an hour
-	    tzCacheEntry->stdOffset = 
-                (currentOffset < postTransitionOffset ? currentOffset : postTransitionOffset) / 60;
-	    tzCacheEntry->dstOffset = 
-                (currentOffset < postTransitionOffset ? postTransitionOffset : currentOffset) / 60;
-	} else {
-	    tzCacheEntry->stdOffset
-                = tzCacheEntry->dstOffset 
-                = tzCacheEntry->currentOffset;
-	}
+        setupTZDataForTimeZoneName(tzName, now, tzCacheEntry);
+        if (tzCacheEntry->nextTransition &&
+            (!_tzCacheExpiration || tzCacheEntry->nextTransition < _tzCacheExpiration)) {
+            _tzCacheExpiration = tzCacheEntry->nextTransition;
+        }
 //	printf("%03d\t%+04d\t%+04d\t%s\n",i, _tzCache->array()[i].stdOffset, _tzCache->array()[i].dstOffset, tzName);
-	ESCalendar_releaseTimeZone(estz);
     }
     traceExit ("setupTimezoneRangeTable");
 }
 
+// Called with the ESGeoNamesTZ lock held when the earliest nextTransition in _tzCache has passed.  Only the zones
+// whose transition has passed are recomputed.  The new entries are written into a second copy of the
+// cache which then replaces _tzCache in a single pointer store, so a reader never sees a half-updated
+// entry; the previous copy is kept as the spare for the next refresh (months away) rather than freed
+// out from under any reader still using it.
+void
+ESGeoNamesData::refreshExpiredTimezones(ESTimeInterval now) {
+    traceEnter("refreshExpiredTimezones");
+    ESAssert(_tzCache);
+    ESAssert(_tzNames);
+    int numTZ = _tzNames->numStrings();
+    if (!_tzCacheSpare) {
+        _tzCacheSpare = new ESFileArray<ESTZData>("ThisFileShouldNeverExist.dat", ESFilePathTypeRelativeToAppSupportDir, false /* don't try reading */);
+        _tzCacheSpare->setupForWriteWithNumElements(numTZ);
+    }
+    ESTZData *newCache = _tzCacheSpare->writableArray();
+    memcpy(newCache, _tzCache->array(), numTZ * sizeof(ESTZData));
+    bool slotsChanged = false;
+    int numRefreshed = 0;
+    _tzCacheExpiration = 0;
+    for (int i = 0; i < numTZ; i++) {
+        ESTZData *tzCacheEntry = newCache + i;
+        if (tzCacheEntry->nextTransition && tzCacheEntry->nextTransition <= now) {
+            short oldStdOffset = tzCacheEntry->stdOffset;
+            short oldDSTOffset = tzCacheEntry->dstOffset;
+            setupTZDataForTimeZoneName(_tzNames->stringAtIndex(i), now, tzCacheEntry);
+            if (tzCacheEntry->stdOffset != oldStdOffset || tzCacheEntry->dstOffset != oldDSTOffset) {
+                slotsChanged = true;  // Only happens if the zone's rules changed, e.g., it abandoned DST
+            }
+            numRefreshed++;
+        }
+        if (tzCacheEntry->nextTransition &&
+            (!_tzCacheExpiration || tzCacheEntry->nextTransition < _tzCacheExpiration)) {
+            _tzCacheExpiration = tzCacheEntry->nextTransition;
+        }
+    }
+    __sync_synchronize();  // Make sure the new entries are visible before the pointer that leads to them
+    ESFileArray<ESTZData> *oldCache = _tzCache;
+    _tzCache = _tzCacheSpare;
+    _tzCacheSpare = oldCache;
+    if (slotsChanged) {
+        for (int i = 0; i < numTZ; i++) {
+            setupSlotInclusionClassesForTZ(i);  // Single-byte stores; unchanged zones get the same values
+        }
+        arrayLocks[ESGeoNamesSlotCityBits]->lock();
+        if (_slotCityBits) {
+            setupSlotCityBits();
+        }
+        arrayLocks[ESGeoNamesSlotCityBits]->unlock();
+    }
+    ESErrorReporter::logInfo("ESGeoNames", "refreshed %d time zone(s) past their DST transition", numRefreshed);
+    traceExit("refreshExpiredTimezones");
+}
+
+// Precompute, for each of the 24 nominal slots, a bitset of the cities whose zone fits in that slot, so that
+// searchForCityNameFragmentForNominalTZSlot can skip non-fitting cities without a per-city lock and tz lookup.
+void
+ESGeoNamesData::setupSlotCityBits() {
+    traceEnter("setupSlotCityBits");
+    ESAssert(_tzIndices);
+    ESAssert(_numCities > 0);
+    int numTZ = _tzNames->numStrings();
+    ESUINT32 *slotMaskForTZ = (ESUINT32 *)malloc(numTZ * sizeof(ESUINT32));  // bit h set iff zone fits slot h
+    ESAssert(_tzSlotClasses);
+    for (int tz = 0; tz < numTZ; tz++) {
+        const unsigned char *slotClasses = _tzSlotClasses + tz * 24;
+        ESUINT32 mask = 0;
+        for (int h = 0; h < 24; h++) {
+            if (slotClasses[h] != notIncluded) {
+                mask |= (1 << h);
+            }
+        }
+        slotMaskForTZ[tz] = mask;
+    }
+    int wordsPerSlot = (_numCities + 31) / 32;
+    // Build into a fresh buffer so that a search running during a rebuild (see refreshExpiredTimezones) sees
+    // either the old bits or the new ones.  The previous buffer is kept until the next rebuild.
+    ESUINT32 *slotCityBits = (ESUINT32 *)calloc(24 * wordsPerSlot, sizeof(ESUINT32));
+    const short *tzIndices = _tzIndices->array();
+    const ESUINT32 *suppressed = suppressedCityBits();  // Left out here, so the slot searches never see them
+    for (int i = 0; i < _numCities; i++) {
+        ESUINT32 mask = suppressed && bitIsSet(suppressed, i) ? 0 : slotMaskForTZ[tzIndices[i]];
+        for (int h = 0; mask; h++, mask >>= 1) {
+            if (mask & 1) {
+                slotCityBits[h * wordsPerSlot + (i >> 5)] |= (1U << (i & 31));
+            }
+        }
+    }
+    free(slotMaskForTZ);
+    checkFreeMallocArray((void**)&_slotCityBitsSpare);
+    _slotCityBitsWordsPerSlot = wordsPerSlot;
+    __sync_synchronize();
+    _slotCityBitsSpare = _slotCityBits;
+    _slotCityBits = slotCityBits;
+    traceExit("setupSlotCityBits");
+}
+
 #ifndef NDEBUG
 void
 ESGeoNamesData::testTZNames() {
@@ -273,14 +1065,27 @@ ESGeoNamesData::testTZNames() {
 void
 ESGeoNamesData::readTZ() {
     traceEnter("readTZ");
-    _tzIndices = new ESFileArray<short>("/eslocation/loc-tz.dat", ESFilePathTypeRelativeToResourceDir);
+    _tzIndices = new ESFileArray<short>(dataPath("loc-tz.dat").c_str(), ESFilePathTypeRelativeToResourceDir);
     size_t bytesRead = _tzIndices->bytesRead();
-    qualifyNumCities((int)(bytesRead / sizeof(short)));
+    int numCitiesRead = (int)(bytesRead / sizeof(short));
+    ESGeoNamesOverlay *overlay = this->overlay();
+    if (overlay) {
+        _tzIndices = overlayCopyOfFileArray(_tzIndices, numCitiesRead, overlay->numCities);
+        short *tzIndices = _tzIndices->writableArray();
+        for (std::vector<ESGeoNamesOverlayCity>::const_iterator city = overlay->cities.begin(); city != overlay->cities.end(); city++) {
+            if (city->fields & ES_GEONAMES_OVERLAY_TZ) {
+                tzIndices[city->cityIndex] = (short)city->tzIndex;
+            }
+        }
+        numCitiesRead = overlay->numCities;
+    }
+    qualifyNumCities(numCitiesRead);
     ESAssert(!_tzNames);
     ESAssert(_numCities > 0);
-    _tzNames = new ESFileStringArray("/eslocation/loc-tzNames.dat", ESFilePathTypeRelativeToResourceDir, _numCities);
-    _tzNamesChecksum = ESFile::readSingleUnsignedFromFile("/eslocation/loc-tzNames.sum", ESFilePathTypeRelativeToResourceDir);
+    _tzNames = newStringArrayForDataFile("loc-tzNames.dat");
+    _tzNamesChecksum = ESFile::readSingleUnsignedFromFile(dataPath("loc-tzNames.sum").c_str(), ESFilePathTypeRelativeToResourceDir);
     //printf("_tzNames checksum is %u (0x%08x)\n", _tzNamesChecksum, _tzNamesChecksum);
+    _tzNamesHashed = _tzNamesChecksum == ES_GEONAMES_HASHED_TZ_NAMES_CHECKSUM && _tzNames->numStrings() == ES_GEONAMES_HASHED_NUM_TZ_NAMES;
     if (_tzCache) {
 	ESAssert(false);
 	return;
@@ -295,12 +1100,132 @@ ESGeoNamesData::readTZ() {
     ESAssert(cacheSize = _tzCache->bytesRead());
 #endif
     setupTimezoneRangeTable();
+    ESAssert(!_tzSlotClasses);
+    _tzSlotClasses = (unsigned char *)malloc(_tzNames->numStrings() * 24);
+    for (int i = 0; i < _tzNames->numStrings(); i++) {
+        setupSlotInclusionClassesForTZ(i);
+    }
     ESErrorReporter::logInfo("ESGeoNames", "done generating");
     // Don't write to path; I don't trust versioning, especially on Android.
     // _tzCache->writeToPath(fn.c_str(), ESFilePathTypeRelativeToAppSupportDir);
     traceExit("readTZ");
 }
 
+void
+ESGeoNamesData::readTZRaster() {
+    traceEnter("readTZRaster");
+    ESAssert(!_tzRaster);
+    _tzRaster = new ESFileArray<unsigned short>(dataPath("loc-tzRaster.dat").c_str(), ESFilePathTypeRelativeToResourceDir);
+    size_t numEntries = _tzRaster->bytesRead() / sizeof(unsigned short);
+    const unsigned short *raster = _tzRaster->array();
+    _tzRasterUsable = false;
+    if (numEntries >= ES_GEONAMES_TZ_RASTER_HEADER_SIZE && raster[0] > 0 && raster[1] > 0) {
+        int cellsPerDegree = raster[0];
+        int blockSize = raster[1];
+        unsigned int checksum = raster[2] | ((unsigned int)raster[3] << 16);
+        size_t numBlocks = (size_t)(180 * cellsPerDegree / blockSize) * (360 * cellsPerDegree / blockSize);
+        _tzRasterUsable = (180 * cellsPerDegree) % blockSize == 0 &&
+            numEntries >= ES_GEONAMES_TZ_RASTER_HEADER_SIZE + numBlocks &&
+            checksum == ESFile::readSingleUnsignedFromFile(dataPath("loc-tzNames.sum").c_str(), ESFilePathTypeRelativeToResourceDir);
+    }
+    if (!_tzRasterUsable) {
+        ESErrorReporter::logError("ESGeoNames", "loc-tzRaster.dat is missing or doesn't match loc-tzNames.dat; finding time zones by closest city");
+    } else if (overlay() && !_overlay->tzRasterCells.empty() && _overlay->header.rasterCellsPerDegree != raster[0]) {
+        // The cells the overlay changes are for another grid
+        ESErrorReporter::logError("ESGeoNames", "the overlay's raster cells don't match loc-tzRaster.dat; finding time zones by closest city");
+        _tzRasterUsable = false;
+    }
+    traceExit("readTZRaster");
+}
+
+void
+ESGeoNamesData::readCCRaster() {
+    traceEnter("readCCRaster");
+    ESAssert(!_ccRaster);
+    _ccRaster = new ESFileArray<unsigned char>(dataPath("loc-ccRaster.dat").c_str(), ESFilePathTypeRelativeToResourceDir);
+    size_t bytesRead = _ccRaster->bytesRead();
+    const unsigned short *header = (const unsigned short *)_ccRaster->array();
+    _ccRasterUsable = false;
+    if (bytesRead >= ES_GEONAMES_CC_RASTER_HEADER_SIZE * sizeof(unsigned short) && header[0] > 0) {
+        int cellsPerDegree = header[0];
+        int numCountries = header[1];
+        size_t numRuns = header[2] | ((size_t)header[3] << 16);
+        _ccRasterUsable = bytesRead == (ES_GEONAMES_CC_RASTER_HEADER_SIZE + numCountries + 180 * cellsPerDegree + 1 + numRuns) * sizeof(unsigned short) + numRuns;
+    }
+    if (!_ccRasterUsable) {
+        ESErrorReporter::logError("ESGeoNames", "loc-ccRaster.dat is missing or malformed; finding countries by closest city");
+    } else if (overlay() && !_overlay->ccRasterCells.empty() && _overlay->header.rasterCellsPerDegree != header[0]) {
+        ESErrorReporter::logError("ESGeoNames", "the overlay's raster cells don't match loc-ccRaster.dat; finding countries by closest city");
+        _ccRasterUsable = false;
+    }
+    traceExit("readCCRaster");
+}
+
+#define ES_GEONAMES_AIRPORTS_HEADER_SIZE 3       // numCities, hashBits, hashSeed
+
+// The only slot in the table where code can be (as airportHash in data/buildLocData.cpp)
+static inline unsigned int
+airportSlot(ESUINT32 code,
+            ESUINT32 seed,
+            ESUINT32 hashBits) {
+    return ((code ^ seed) * 0x9e3779b1u) >> (32 - hashBits);
+}
+
+// Call ensureCityData first
+void
+ESGeoNamesData::readAirports() {
+    traceEnter("readAirports");
+    ESAssert(!_airports);
+    _airports = new ESFileArray<ESUINT32>(dataPath("loc-airports.dat").c_str(), ESFilePathTypeRelativeToResourceDir);
+    size_t numEntries = _airports->bytesRead() / sizeof(ESUINT32);
+    const ESUINT32 *table = _airports->array();
+    _airportsUsable = false;
+    if (numEntries >= ES_GEONAMES_AIRPORTS_HEADER_SIZE && table[1] > 0 && table[1] < 24) {
+        ESGeoNamesOverlay *overlay = this->overlay();
+        int baseNumCities = overlay ? overlay->header.baseNumCities : _numCities;  // The table's indices are of the cities before any are added
+        _airportsUsable = (int)table[0] == baseNumCities &&
+            numEntries == ES_GEONAMES_AIRPORTS_HEADER_SIZE + 2 * ((size_t)1 << table[1]);
+    }
+    if (!_airportsUsable) {
+        ESErrorReporter::logError("ESGeoNames", "loc-airports.dat is missing or doesn't match loc-data.dat; no airport codes in searches");
+    }
+    traceExit("readAirports");
+}
+
+// Needs nothing but the airport table:  a code hashes to exactly one slot, which either holds it or doesn't
+int
+ESGeoNamesData::cityIndexForAirportCode(const char *fragment) {
+    ESUINT32 code = 0;
+    for (int i = 0; i < 3; i++) {
+        char c = fragment[i];
+        if (c >= 'a' && c <= 'z') {
+            c -= 'a' - 'A';
+        } else if (c < 'A' || c > 'Z') {
+            return -1;  // (Including a fragment shorter than three)
+        }
+        code |= (ESUINT32)c << (8 * i);
+    }
+    if (fragment[3]) {
+        return -1;
+    }
+    ensureAirports();
+    int cityIndex = -1;
+    arrayLocks[ESGeoNamesAirports]->lock();
+    if (_airports && _airportsUsable) {  // (It might have been trimmed since we ensured it)
+        const ESUINT32 *table = _airports->array();
+        const ESUINT32 *entry = table + ES_GEONAMES_AIRPORTS_HEADER_SIZE + 2 * airportSlot(code, table[2], table[1]);
+        if (entry[0] == code) {
+            cityIndex = (int)entry[1];
+        }
+    }
+    arrayLocks[ESGeoNamesAirports]->unlock();
+    const ESUINT32 *suppressed = suppressedCityBits();
+    if (cityIndex >= _numCities || (cityIndex >= 0 && suppressed && bitIsSet(suppressed, cityIndex))) {
+        cityIndex = -1;
+    }
+    return cityIndex;
+}
+
 #ifndef NDEBUG
 ESFileStringArray *
 ESGeoNamesData::tzNames() {
@@ -314,7 +1239,7 @@ void
 ESGeoNamesData::readCCNames() {
     ESAssert(!_ccNames);
     traceEnter("readCCNames");
-    _ccNames = new ESFileStringArray("/eslocation/loc-cc.dat", ESFilePathTypeRelativeToResourceDir, 238);
+    _ccNames = newStringArrayForDataFile("loc-cc.dat");
     traceExit("readCCNames");
 }
 
@@ -322,137 +1247,539 @@ void
 ESGeoNamesData::readCCCodes() {
     ESAssert(!_ccCodes);
     traceEnter("readCCCodes");
-    _ccCodes = new ESFileArray<short>("/eslocation/loc-ccCodes.dat", ESFilePathTypeRelativeToResourceDir);
+    _ccCodes = new ESFileArray<short>(dataPath("loc-ccCodes.dat").c_str(), ESFilePathTypeRelativeToResourceDir);
     ESAssert(_ccCodes->array());
+    int numCodes = (int)(_ccCodes->bytesRead() / sizeof(short));
+    _ccCodesHashed = numCodes == ES_GEONAMES_HASHED_NUM_CC_CODES;
+    for (int i = 0; i < esGeoNamesCCCodeHash.numEntries && _ccCodesHashed; i++) {
+        const ESGeoNamesHashEntry &entry = esGeoNamesCCCodeHash.entries[i];
+        _ccCodesHashed = entry.index >= 0 && entry.index < numCodes && strncmp((const char *)&_ccCodes->array()[entry.index], entry.key, 2) == 0;
+    }
+    if (!_ccCodesHashed) {
+        ESErrorReporter::logInfo("ESGeoNames", "loc-ccCodes.dat doesn't match ESGeoNamesHashTables.hpp; scanning for countries");
+    }
     traceExit("readCCCodes");
 }
 
 void
 ESGeoNamesData::readA1Names() {
     ESAssert(!_a1Names);
-    _a1Names = new ESFileStringArray("/eslocation/loc-a1.dat", ESFilePathTypeRelativeToResourceDir, 3269);
+    _a1Names = newStringArrayForDataFile("loc-a1.dat");
 }
 
 void
 ESGeoNamesData::readA2Names() {
     ESAssert(!_a2Names);
-    _a2Names = new ESFileStringArray("/eslocation/loc-a2.dat", ESFilePathTypeRelativeToResourceDir, 569);
+    _a2Names = newStringArrayForDataFile("loc-a2.dat");
 }
 
 void
 ESGeoNamesData::readA1Codes() {
     ESAssert(!_a1Codes);
-    _a1Codes = new ESFileStringArray("/eslocation/loc-a1Codes.dat", ESFilePathTypeRelativeToResourceDir, 3269);
+    _a1Codes = newStringArrayForDataFile("loc-a1Codes.dat");
+    int numCodes = _a1Codes->numStrings();
+    _a1CodesHashed = numCodes == ES_GEONAMES_HASHED_NUM_A1_CODES;
+    for (int i = 0; i < esGeoNamesA1CodeHash.numEntries && _a1CodesHashed; i++) {
+        const ESGeoNamesHashEntry &entry = esGeoNamesA1CodeHash.entries[i];
+        _a1CodesHashed = entry.index >= 0 && entry.index < numCodes && strcmp(_a1Codes->stringAtIndex(entry.index), entry.key) == 0;
+    }
+    if (!_a1CodesHashed) {
+        ESErrorReporter::logInfo("ESGeoNames", "loc-a1Codes.dat doesn't match ESGeoNamesHashTables.hpp; scanning for admin1 codes");
+    }
+}
+
+// As hashKey in data/buildLocData.cpp:  FNV-1a over the key with ASCII letters upper-cased
+static inline ESUINT32
+hashKey(const char *key) {
+    ESUINT32 hash = 2166136261u;
+    for (; *key; key++) {
+        unsigned char c = (unsigned char)*key;
+        if (c >= 'a' && c <= 'z') {
+            c -= 'a' - 'A';
+        }
+        hash = (hash ^ c) * 16777619u;
+    }
+    return hash;
+}
+
+// As hashMix in data/buildLocData.cpp (murmur3's finalizer)
+static inline ESUINT32
+hashMix(ESUINT32 hash) {
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6bu;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35u;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+// The index the table has for key, or -1.  The key's bucket gives the displacement that gives its slot; the entry
+// there is the key or it isn't in the table.
+static int
+hashLookup(const ESGeoNamesHashTable &table,
+           const char                *key,
+           bool                      ignoreCase) {
+    if (!table.numEntries) {
+        return -1;
+    }
+    ESUINT32 hash = hashKey(key);
+    ESUINT32 displacement = table.displacements[hashMix(hash) % table.numBuckets];
+    const ESGeoNamesHashEntry &entry = table.entries[hashMix(hash ^ displacement) % table.numEntries];
+    bool same = ignoreCase ? strcasecmp(entry.key, key) == 0 : strcmp(entry.key, key) == 0;
+    return same ? entry.index : -1;
+}
+
+int
+ESGeoNamesData::ccIndexForCountry(const char *country) {
+    if (!*country) {
+        return -1;
+    }
+    if (_ccCodesHashed) {
+        int ccIndex = hashLookup(esGeoNamesCCCodeHash, country, true/*ignoreCase*/);
+        return ccIndex >= 0 ? ccIndex : hashLookup(esGeoNamesCCAliasHash, country, true/*ignoreCase*/);
+    }
+    // The files aren't the ones the tables were made from:  scan the codes, then the names
+    const short *ccCodes = _ccCodes->array();
+    int numCodes = (int)(_ccCodes->bytesRead() / sizeof(short));
+    if (strlen(country) == 2) {
+        for (int i = 0; i < numCodes; i++) {
+            if (strncasecmp((const char *)&ccCodes[i], country, 2) == 0) {
+                return i;
+            }
+        }
+    }
+    ensureCCNames();
+    for (int i = 0; i < _ccNames->numStrings(); i++) {
+        if (strcasecmp(_ccNames->stringAtIndex(i), country) == 0) {
+            return i;
+        }
+    }
+    // An alias ("USA") can still be found by way of the code the tables have for it
+    int hashedCCIndex = hashLookup(esGeoNamesCCAliasHash, country, true/*ignoreCase*/);
+    for (int e = 0; hashedCCIndex >= 0 && e < esGeoNamesCCCodeHash.numEntries; e++) {
+        if (esGeoNamesCCCodeHash.entries[e].index == hashedCCIndex) {
+            const char *code = esGeoNamesCCCodeHash.entries[e].key;
+            for (int i = 0; i < numCodes; i++) {
+                if (strncmp((const char *)&ccCodes[i], code, 2) == 0) {
+                    return i;
+                }
+            }
+        }
+    }
+    return -1;
+}
+
+int
+ESGeoNamesData::a1IndexForCode(const char *a1Code) {
+    if (_a1CodesHashed) {
+        return hashLookup(esGeoNamesA1CodeHash, a1Code, true/*ignoreCase*/);
+    }
+    for (int i = 0; i < _a1Codes->numStrings(); i++) {
+        if (strcasecmp(_a1Codes->stringAtIndex(i), a1Code) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int
+ESGeoNamesData::tzIndexForName(const char *tzName) {
+    if (_tzNamesHashed) {
+        return hashLookup(esGeoNamesTZNameHash, tzName, false/*!ignoreCase*/);
+    }
+    const char **ptr = _tzNames->strings();
+    const char **end = ptr + _tzNames->numStrings();
+    for (int i = 0; ptr < end; ptr++, i++) {
+        if (strcmp(tzName, *ptr) == 0) {
+            return i;
+        }
+    }
+    return -1;
 }
 
 void 
 ESGeoNamesData::ensureCityData() {
-    ESAssert(modifyLock);
-    modifyLock->lock();
+    ESAssert(arrayLocks[ESGeoNamesCityData]);
+    arrayLocks[ESGeoNamesCityData]->lock();
     if (!_cityData) {
         readCityData();
+        _arrayBytes[ESGeoNamesCityData] = _cityData->bytesRead();
     }
-    modifyLock->unlock();
+    noteArrayUse(ESGeoNamesCityData);
+    arrayLocks[ESGeoNamesCityData]->unlock();
 }
 
 void 
 ESGeoNamesData::ensureCityNames() {
-    ESAssert(modifyLock);
-    modifyLock->lock();
+    ESAssert(arrayLocks[ESGeoNamesCityNames]);
+    arrayLocks[ESGeoNamesCityNames]->lock();
     if (!_cityNames) {
         readCityNames();
+        _arrayBytes[ESGeoNamesCityNames] = _cityNames->bytesRead();
     }
-    modifyLock->unlock();
+    noteArrayUse(ESGeoNamesCityNames);
+    arrayLocks[ESGeoNamesCityNames]->unlock();
 }
 
 void 
 ESGeoNamesData::ensureNameIndices() {
-    ESAssert(modifyLock);
-    modifyLock->lock();
+    ESAssert(arrayLocks[ESGeoNamesNameIndices]);
+    arrayLocks[ESGeoNamesNameIndices]->lock();
     if (!_nameIndices) {
         readNameIndices();
+        _arrayBytes[ESGeoNamesNameIndices] = _nameIndices->bytesRead();
     }
-    modifyLock->unlock();
+    noteArrayUse(ESGeoNamesNameIndices);
+    arrayLocks[ESGeoNamesNameIndices]->unlock();
 }
 
 void 
 ESGeoNamesData::ensureRegions() {
-    ESAssert(modifyLock);
-    modifyLock->lock();
+    ESAssert(arrayLocks[ESGeoNamesRegions]);
+    arrayLocks[ESGeoNamesRegions]->lock();
     if (!_cityRegions) {
         readRegions();
+        _arrayBytes[ESGeoNamesRegions] = _cityRegions->bytesRead();
     }
-    modifyLock->unlock();
+    noteArrayUse(ESGeoNamesRegions);
+    arrayLocks[ESGeoNamesRegions]->unlock();
 }
 
 void 
 ESGeoNamesData::ensureRegionDescs() {
-    ESAssert(modifyLock);
-    modifyLock->lock();
+    ESAssert(arrayLocks[ESGeoNamesRegionDescs]);
+    arrayLocks[ESGeoNamesRegionDescs]->lock();
     if (!_regionDescs) {
         readRegionDescs();
+        _arrayBytes[ESGeoNamesRegionDescs] = _regionDescs->bytesRead();
     }
-    modifyLock->unlock();
+    noteArrayUse(ESGeoNamesRegionDescs);
+    arrayLocks[ESGeoNamesRegionDescs]->unlock();
 }
 
 void 
 ESGeoNamesData::ensureCCNames() {
-    ESAssert(modifyLock);
-    modifyLock->lock();
+    ESAssert(arrayLocks[ESGeoNamesCCNames]);
+    arrayLocks[ESGeoNamesCCNames]->lock();
     if (!_ccNames) {
         readCCNames();
+        _arrayBytes[ESGeoNamesCCNames] = bytesInStringArray(_ccNames);
     }
-    modifyLock->unlock();
+    noteArrayUse(ESGeoNamesCCNames);
+    arrayLocks[ESGeoNamesCCNames]->unlock();
 }
 
 void 
 ESGeoNamesData::ensureCCCodes() {
-    ESAssert(modifyLock);
-    modifyLock->lock();
+    ESAssert(arrayLocks[ESGeoNamesCCCodes]);
+    arrayLocks[ESGeoNamesCCCodes]->lock();
     if (!_ccCodes) {
         readCCCodes();
+        _arrayBytes[ESGeoNamesCCCodes] = _ccCodes->bytesRead();
     }
-    modifyLock->unlock();
+    noteArrayUse(ESGeoNamesCCCodes);
+    arrayLocks[ESGeoNamesCCCodes]->unlock();
 }
 
 void 
 ESGeoNamesData::ensureA1Names() {
-    ESAssert(modifyLock);
-    modifyLock->lock();
+    ESAssert(arrayLocks[ESGeoNamesA1Names]);
+    arrayLocks[ESGeoNamesA1Names]->lock();
     if (!_a1Names) {
         readA1Names();
+        _arrayBytes[ESGeoNamesA1Names] = bytesInStringArray(_a1Names);
     }
-    modifyLock->unlock();
+    noteArrayUse(ESGeoNamesA1Names);
+    arrayLocks[ESGeoNamesA1Names]->unlock();
 }
 
 void 
 ESGeoNamesData::ensureA2Names() {
-    ESAssert(modifyLock);
-    modifyLock->lock();
+    ESAssert(arrayLocks[ESGeoNamesA2Names]);
+    arrayLocks[ESGeoNamesA2Names]->lock();
     if (!_a2Names) {
         readA2Names();
+        _arrayBytes[ESGeoNamesA2Names] = bytesInStringArray(_a2Names);
     }
-    modifyLock->unlock();
+    noteArrayUse(ESGeoNamesA2Names);
+    arrayLocks[ESGeoNamesA2Names]->unlock();
 }
 
 void 
 ESGeoNamesData::ensureA1Codes() {
-    ESAssert(modifyLock);
-    modifyLock->lock();
+    ESAssert(arrayLocks[ESGeoNamesA1Codes]);
+    arrayLocks[ESGeoNamesA1Codes]->lock();
     if (!_a1Codes) {
         readA1Codes();
+        _arrayBytes[ESGeoNamesA1Codes] = bytesInStringArray(_a1Codes);
     }
-    modifyLock->unlock();
+    noteArrayUse(ESGeoNamesA1Codes);
+    arrayLocks[ESGeoNamesA1Codes]->unlock();
 }
 
 void 
 ESGeoNamesData::ensureTZ() {
-    ESAssert(modifyLock);
-    modifyLock->lock();
+    ESAssert(arrayLocks[ESGeoNamesTZ]);
+    arrayLocks[ESGeoNamesTZ]->lock();
     if (!_tzIndices) {
         readTZ();
+        _arrayBytes[ESGeoNamesTZ] = _tzIndices->bytesRead() + bytesInStringArray(_tzNames)
+            + 2 * _tzCache->bytesRead() + _tzNames->numStrings() * 24;
+    } else if (_tzCacheExpiration && ESTime::currentTime() >= _tzCacheExpiration) {
+        refreshExpiredTimezones(ESTime::currentTime());
+    }
+    noteArrayUse(ESGeoNamesTZ);
+    arrayLocks[ESGeoNamesTZ]->unlock();
+}
+
+void 
+ESGeoNamesData::ensureSlotCityBits() {
+    ensureTZ();
+    ESAssert(arrayLocks[ESGeoNamesSlotCityBits]);
+    arrayLocks[ESGeoNamesSlotCityBits]->lock();
+    if (!_slotCityBits) {
+        setupSlotCityBits();
+        _arrayBytes[ESGeoNamesSlotCityBits] = 2 * 24 * _slotCityBitsWordsPerSlot * sizeof(ESUINT32);  // current + spare
+    }
+    noteArrayUse(ESGeoNamesSlotCityBits);
+    arrayLocks[ESGeoNamesSlotCityBits]->unlock();
+}
+
+void 
+ESGeoNamesData::ensurePopulationOrder() {
+    ensureCityData();
+    ESAssert(arrayLocks[ESGeoNamesPopulationOrder]);
+    arrayLocks[ESGeoNamesPopulationOrder]->lock();
+    if (!_populationOrder) {
+        setupPopulationOrder();
+        _arrayBytes[ESGeoNamesPopulationOrder] = _numCities * (sizeof(int) + sizeof(float));
+    }
+    noteArrayUse(ESGeoNamesPopulationOrder);
+    arrayLocks[ESGeoNamesPopulationOrder]->unlock();
+}
+
+void 
+ESGeoNamesData::ensureTZRaster() {
+    ESAssert(arrayLocks[ESGeoNamesTZRaster]);
+    arrayLocks[ESGeoNamesTZRaster]->lock();
+    if (!_tzRaster) {
+        readTZRaster();
+        _arrayBytes[ESGeoNamesTZRaster] = _tzRaster->bytesRead();
+    }
+    noteArrayUse(ESGeoNamesTZRaster);
+    arrayLocks[ESGeoNamesTZRaster]->unlock();
+}
+
+void 
+ESGeoNamesData::ensureCCRaster() {
+    ESAssert(arrayLocks[ESGeoNamesCCRaster]);
+    arrayLocks[ESGeoNamesCCRaster]->lock();
+    if (!_ccRaster) {
+        readCCRaster();
+        _arrayBytes[ESGeoNamesCCRaster] = _ccRaster->bytesRead();
+    }
+    noteArrayUse(ESGeoNamesCCRaster);
+    arrayLocks[ESGeoNamesCCRaster]->unlock();
+}
+
+void 
+ESGeoNamesData::ensureCityGrid() {
+    ensureCityData();
+    ESAssert(arrayLocks[ESGeoNamesCityGrid]);
+    arrayLocks[ESGeoNamesCityGrid]->lock();
+    if (!_cityGridStarts) {
+        setupCityGrid();
+        _arrayBytes[ESGeoNamesCityGrid] = (_cityGridRows * _cityGridColumns + 1 + _numCities) * sizeof(int);
+    }
+    noteArrayUse(ESGeoNamesCityGrid);
+    arrayLocks[ESGeoNamesCityGrid]->unlock();
+}
+
+void 
+ESGeoNamesData::ensureAirports() {
+    ensureCityData();  // For the number of cities to check the table against
+    ESAssert(arrayLocks[ESGeoNamesAirports]);
+    arrayLocks[ESGeoNamesAirports]->lock();
+    if (!_airports) {
+        readAirports();
+        _arrayBytes[ESGeoNamesAirports] = _airports->bytesRead();
+    }
+    noteArrayUse(ESGeoNamesAirports);
+    arrayLocks[ESGeoNamesAirports]->unlock();
+}
+
+// Called with the array's lock held, from each ensureXXX (i.e., at the start of each query that needs the array)
+void
+ESGeoNamesData::noteArrayUse(ESGeoNamesArray which) {
+    _arrayLastUse[which] = __sync_add_and_fetch(&_useTick, 1);
+}
+
+static bool
+arrayIsEvictable(ESGeoNamesArray which) {
+    switch (which) {
+      case ESGeoNamesCityNames:
+      case ESGeoNamesNameIndices:
+      case ESGeoNamesRegions:
+      case ESGeoNamesRegionDescs:
+      case ESGeoNamesCCNames:
+      case ESGeoNamesCCCodes:
+      case ESGeoNamesA1Names:
+      case ESGeoNamesA2Names:
+      case ESGeoNamesA1Codes:
+      case ESGeoNamesTZRaster:
+      case ESGeoNamesCCRaster:
+      case ESGeoNamesAirports:
+        return true;
+      default:
+        // cityData (and the city grid made from it) is needed by every location lookup, including those on the time
+        // helper thread, and the tz tables are expensive to rebuild, so those stay until clearStorage.
+        return false;
+    }
+}
+
+// Called with the array's lock held
+void
+ESGeoNamesData::evictArray(ESGeoNamesArray which) {
+    switch (which) {
+      case ESGeoNamesCityNames:
+        checkFreeFileArray<unsigned char>(&_cityNames);
+        break;
+      case ESGeoNamesNameIndices:
+        checkFreeFileArray<int>(&_nameIndices);
+        break;
+      case ESGeoNamesRegions:
+        checkFreeFileArray<short>(&_cityRegions);
+        break;
+      case ESGeoNamesRegionDescs:
+        checkFreeFileArray<ESRegionDesc>(&_regionDescs);
+        break;
+      case ESGeoNamesCCNames:
+        checkFreeFileStringArray(&_ccNames);
+        break;
+      case ESGeoNamesCCCodes:
+        checkFreeFileArray<short>(&_ccCodes);
+        break;
+      case ESGeoNamesA1Names:
+        checkFreeFileStringArray(&_a1Names);
+        break;
+      case ESGeoNamesA2Names:
+        checkFreeFileStringArray(&_a2Names);
+        break;
+      case ESGeoNamesA1Codes:
+        checkFreeFileStringArray(&_a1Codes);
+        break;
+      case ESGeoNamesTZRaster:
+        checkFreeFileArray<unsigned short>(&_tzRaster);
+        break;
+      case ESGeoNamesCCRaster:
+        checkFreeFileArray<unsigned char>(&_ccRaster);
+        break;
+      case ESGeoNamesAirports:
+        checkFreeFileArray<ESUINT32>(&_airports);
+        break;
+      default:
+        ESAssert(false);
+        return;
+    }
+    _arrayBytes[which] = 0;
+}
+
+size_t
+ESGeoNamesData::bytesInUse() {
+    size_t total = 0;
+    for (int i = 0; i < ESGeoNamesNumArrays; i++) {
+        total += _arrayBytes[i];
+    }
+    return total;
+}
+
+// Evict evictable arrays, least recently used first, until we're within budgetBytes.  Evicted arrays are reloaded
+// by the next ensureXXX that needs them.  Most queries hold no lock while walking an array, so this must be called
+// on the main thread, and those queries are main thread only too (see ESGeoNames.hpp).  What other threads may use:
+// cityData and the tz tables, which aren't evictable; the rasters, which their lookups read with the array lock
+// held; the region and country code arrays, likewise, for countryCodeForLatitudeDegrees; and whatever prefetch
+// workers load, with which they're done when they release its lock.
+size_t
+ESGeoNamesData::trimToBudget(size_t budgetBytes) {
+    ESAssert(ESThread::inMainThread());
+    size_t total = bytesInUse();
+    while (total > budgetBytes) {
+        int lruArray = -1;
+        for (int i = 0; i < ESGeoNamesNumArrays; i++) {
+            if (_arrayBytes[i] && arrayIsEvictable((ESGeoNamesArray)i) &&
+                (lruArray < 0 || _arrayLastUse[i] < _arrayLastUse[lruArray])) {
+                lruArray = i;
+            }
+        }
+        if (lruArray < 0) {
+            break;  // Nothing left that we're willing to evict
+        }
+        arrayLocks[lruArray]->lock();
+        total -= _arrayBytes[lruArray];
+        evictArray((ESGeoNamesArray)lruArray);
+        arrayLocks[lruArray]->unlock();
+    }
+    return total;
+}
+
+void
+ESGeoNamesData::ensureArray(ESGeoNamesArray which) {
+    switch (which) {
+      case ESGeoNamesCityData:
+        ensureCityData();
+        break;
+      case ESGeoNamesCityNames:
+        ensureCityNames();
+        break;
+      case ESGeoNamesNameIndices:
+        ensureNameIndices();
+        break;
+      case ESGeoNamesRegions:
+        ensureRegions();
+        break;
+      case ESGeoNamesRegionDescs:
+        ensureRegionDescs();
+        break;
+      case ESGeoNamesCCNames:
+        ensureCCNames();
+        break;
+      case ESGeoNamesCCCodes:
+        ensureCCCodes();
+        break;
+      case ESGeoNamesA1Names:
+        ensureA1Names();
+        break;
+      case ESGeoNamesA2Names:
+        ensureA2Names();
+        break;
+      case ESGeoNamesA1Codes:
+        ensureA1Codes();
+        break;
+      case ESGeoNamesTZ:
+        ensureTZ();
+        break;
+      case ESGeoNamesSlotCityBits:
+        ensureSlotCityBits();
+        break;
+      case ESGeoNamesPopulationOrder:
+        ensurePopulationOrder();
+        break;
+      case ESGeoNamesTZRaster:
+        ensureTZRaster();
+        break;
+      case ESGeoNamesCCRaster:
+        ensureCCRaster();
+        break;
+      case ESGeoNamesCityGrid:
+        ensureCityGrid();
+        break;
+      case ESGeoNamesAirports:
+        ensureAirports();
+        break;
+      default:
+        ESAssert(false);
+        break;
     }
-    modifyLock->unlock();
 }
 
 static float distanceBetweenTwoCoordinates(float lat1, float long1,
@@ -489,47 +1816,514 @@ ESGeoNamesData::findWackyZones() {
 }
 #endif
 
+// Cache for findClosestCityToLatitudeDegrees, keyed by grid cell.  For each cell we keep every city that could be
+// the closest one to *some* point in the cell:  If the closest city to the cell center is d0 away, and every point in
+// the cell is within r of the center, then the closest city to any point in the cell is within d0 + r of that point,
+// and hence within d0 + 2r of the center.  So a lookup in a cached cell only has to check those few cities, and
+// since it checks them in index order, it gets the same answer as a full scan would.  The cities for a new cell are
+// found with the (much coarser) city grid below, using the batch distance, whose difference from the scalar one the
+// lookup uses is covered by the slack.
+#define ES_GEONAMES_CELL_DEGREES 0.01         // About a km north-south
+#define ES_GEONAMES_MAX_CACHED_CELLS 256
+#define ES_GEONAMES_CELL_SLACK_KM 0.01         // Covers float rounding in the distances
+#define ES_GEONAMES_DISTANCE_CHUNK 256         // Cities per batch distance call
+
+// The city grid divides the globe into cells of equal latitude and longitude extent, small enough to hold only a
+// handful of cities each on average (from 2 degrees for the shipped set down to a quarter degree for allCountries).
+// visitCityGrid shows a visitor the cities cell by cell, starting with the cell containing the point and working
+// outward, and skips every cell that can't hold a city within the visitor's threshold (which the visitor shrinks as
+// it goes).  The bound for a cell comes from the haversine formula,
+//   hav(d) = hav(dLat) + cos(lat1) cos(lat2) hav(dLong),
+// in which each term is smallest for the smallest dLat, cos(lat2) and dLong that any point in the cell can have.
+#define ES_GEONAMES_GRID_CITIES_PER_CELL 8
+#define ES_GEONAMES_GRID_MIN_DEGREES 0.25f
+#define ES_GEONAMES_GRID_RELATIVE_SLACK 1E-4   // Covers the batch distance's error, which grows with the distance
+
+struct ESGeoNamesGridVisitor {
+    virtual                 ~ESGeoNamesGridVisitor() {}
+    virtual void            visitCities(const int   *cityIndices,
+                                        const float *distancesKm,
+                                        int         count) = 0;
+
+    float                   thresholdKm;         // Cells which can only hold cities farther than this are skipped
+};
+
+// Finds the distance to the closest city
+struct ESGeoNamesClosestVisitor : public ESGeoNamesGridVisitor {
+                            ESGeoNamesClosestVisitor()
+    {
+        thresholdKm = 1E20;
+    }
+
+    /*virtual*/ void        visitCities(const int   *cityIndices,
+                                        const float *distancesKm,
+                                        int         count) {
+        for (int i = 0; i < count; i++) {
+            if (distancesKm[i] < thresholdKm) {
+                thresholdKm = distancesKm[i];
+            }
+        }
+    }
+};
+
+// Collects every city within maxCandidateKm, and finds the distance to the closest one that isn't
+struct ESGeoNamesCandidateVisitor : public ESGeoNamesGridVisitor {
+                            ESGeoNamesCandidateVisitor(float            maxCandidateDistKm,
+                                                       std::vector<int> *candidatesReturn)
+    :   maxCandidateKm(maxCandidateDistKm),
+        nonCandidateMinKm(1E20),
+        candidates(candidatesReturn)
+    {
+        thresholdKm = 1E20;
+    }
+
+    /*virtual*/ void        visitCities(const int   *cityIndices,
+                                        const float *distancesKm,
+                                        int         count) {
+        for (int i = 0; i < count; i++) {
+            if (distancesKm[i] <= maxCandidateKm) {
+                candidates->push_back(cityIndices[i]);
+            } else if (distancesKm[i] < nonCandidateMinKm) {
+                nonCandidateMinKm = distancesKm[i];
+                thresholdKm = fmaxf(maxCandidateKm, nonCandidateMinKm);
+            }
+        }
+    }
+
+    float                   maxCandidateKm;
+    float                   nonCandidateMinKm;
+    std::vector<int>        *candidates;
+};
+
+void
+ESGeoNamesData::setupCityGrid() {
+    traceEnter("setupCityGrid");
+    ESAssert(_cityData);
+    float degrees = 2;
+    while (degrees > ES_GEONAMES_GRID_MIN_DEGREES &&
+           _numCities / ((180 / degrees) * (360 / degrees)) > ES_GEONAMES_GRID_CITIES_PER_CELL) {
+        degrees /= 2;
+    }
+    _cityGridDegrees = degrees;
+    _cityGridRows = (int)(180 / degrees);
+    _cityGridColumns = (int)(360 / degrees);
+    int numCells = _cityGridRows * _cityGridColumns;
+    const ESCityData *cityData = _cityData->array();
+    int *cellForCity = (int *)malloc(_numCities * sizeof(int));
+    int *starts = (int *)calloc(numCells + 1, sizeof(int));
+    const ESUINT32 *suppressed = suppressedCityBits();  // Left out of the grid, so no location lookup finds them
+    for (int i = 0; i < _numCities; i++) {
+        if (suppressed && bitIsSet(suppressed, i)) {
+            cellForCity[i] = -1;
+            continue;
+        }
+        int row = (int)floorf((cityData[i].latitude + 90) / degrees);
+        row = row < 0 ? 0 : row >= _cityGridRows ? _cityGridRows - 1 : row;
+        int column = (int)floorf((cityData[i].longitude + 180) / degrees) % _cityGridColumns;
+        if (column < 0) {
+            column += _cityGridColumns;
+        }
+        cellForCity[i] = row * _cityGridColumns + column;
+        starts[cellForCity[i] + 1]++;
+    }
+    for (int cell = 0; cell < numCells; cell++) {
+        starts[cell + 1] += starts[cell];
+    }
+    // Fill each cell in index order, advancing its start as we go; then each start is where the next cell's was
+    int *cities = (int *)malloc(_numCities * sizeof(int));
+    for (int i = 0; i < _numCities; i++) {
+        if (cellForCity[i] >= 0) {
+            cities[starts[cellForCity[i]]++] = i;
+        }
+    }
+    for (int cell = numCells; cell > 0; cell--) {
+        starts[cell] = starts[cell - 1];
+    }
+    starts[0] = 0;
+    free(cellForCity);
+    _cityGridStarts = starts;
+    _cityGridCities = cities;
+    traceExit("setupCityGrid");
+}
+
+// Lower bound on the distance from a point to anything in a grid cell, given the terms described above
+static float
+gridLowerBoundKm(double halfDLatTerm,           // hav(dLat)
+                 double cosProduct,             // cos(lat1) times the smallest cos(lat2) in the cell
+                 double dLongDegrees) {
+    double sinHalfDLong = sin(dLongDegrees * M_PI / 360);
+    double hav = halfDLatTerm + cosProduct * sinHalfDLong * sinHalfDLong;
+    double km = 2 * 6371 * asin(sqrt(hav < 1 ? hav : 1));
+    return (float)(km * (1 - ES_GEONAMES_GRID_RELATIVE_SLACK) - ES_GEONAMES_CELL_SLACK_KM);
+}
+
+// Call ensureCityGrid first
+void
+ESGeoNamesData::visitCityGrid(float                 latitudeDegrees,
+                              float                 longitudeDegrees,
+                              ESGeoNamesGridVisitor *visitor) {
+    ESAssert(_cityGridStarts);
+    double degrees = _cityGridDegrees;
+    int centerRow = (int)floor((latitudeDegrees + 90) / degrees);
+    centerRow = centerRow < 0 ? 0 : centerRow >= _cityGridRows ? _cityGridRows - 1 : centerRow;
+    double longitude = fmod(longitudeDegrees + 180.0, 360.0);  // Degrees east of the grid's west edge
+    if (longitude < 0) {
+        longitude += 360;
+    }
+    int centerColumn = (int)floor(longitude / degrees) % _cityGridColumns;
+    double cosLatitude = cos(latitudeDegrees * M_PI / 180);
+    const ESCityData *cityData = _cityData->array();
+    float latitudes[ES_GEONAMES_DISTANCE_CHUNK];
+    float longitudes[ES_GEONAMES_DISTANCE_CHUNK];
+    float distances[ES_GEONAMES_DISTANCE_CHUNK];
+    // Rows outward from ours, north and south in turn; each way stops at the first row too far away, since the rest
+    // of the rows that way are farther still
+    bool northDone = false;
+    bool southDone = false;
+    for (int rowStep = 0; !northDone || !southDone; rowStep++) {
+        for (int direction = 0; direction < 2; direction++) {
+            bool &done = direction == 0 ? northDone : southDone;
+            if (done) {
+                continue;
+            }
+            if (rowStep == 0 && direction == 1) {
+                break;  // Our own row, already visited going north
+            }
+            int row = direction == 0 ? centerRow + rowStep : centerRow - rowStep;
+            if (row < 0 || row >= _cityGridRows) {
+                done = true;
+                continue;
+            }
+            double south = row * degrees - 90;
+            double north = south + degrees;
+            double dLat = latitudeDegrees < south ? south - latitudeDegrees : latitudeDegrees > north ? latitudeDegrees - north : 0;
+            double sinHalfDLat = sin(dLat * M_PI / 360);
+            double halfDLatTerm = sinHalfDLat * sinHalfDLat;
+            if (gridLowerBoundKm(halfDLatTerm, 0, 0) > visitor->thresholdKm) {
+                done = true;
+                continue;
+            }
+            double cosProduct = cosLatitude * fmin(cos(south * M_PI / 180), cos(north * M_PI / 180));
+            // Columns outward from ours, east and west in turn, as far as halfway round; likewise each way stops at
+            // the first column too far away
+            bool eastDone = false;
+            bool westDone = false;
+            for (int columnStep = 0; columnStep <= _cityGridColumns / 2 && (!eastDone || !westDone); columnStep++) {
+                for (int side = 0; side < 2; side++) {
+                    bool &sideDone = side == 0 ? eastDone : westDone;
+                    if (sideDone) {
+                        continue;
+                    }
+                    int column = side == 0 ? centerColumn + columnStep : centerColumn - columnStep;
+                    column = (column + _cityGridColumns) % _cityGridColumns;
+                    if (side == 1 && (columnStep == 0 || columnStep * 2 == _cityGridColumns)) {
+                        break;  // Same column as the east one
+                    }
+                    double west = column * degrees;
+                    double dLong = 0;
+                    if (longitude < west || longitude >= west + degrees) {
+                        double eastGap = fmod(west - longitude + 360, 360);
+                        double westGap = fmod(longitude - (west + degrees) + 360, 360);
+                        dLong = fmin(eastGap, westGap);
+                    }
+                    if (gridLowerBoundKm(halfDLatTerm, cosProduct, dLong) > visitor->thresholdKm) {
+                        sideDone = true;
+                        continue;
+                    }
+                    int cell = row * _cityGridColumns + column;
+                    const int *cityIndices = _cityGridCities + _cityGridStarts[cell];
+                    int numInCell = _cityGridStarts[cell + 1] - _cityGridStarts[cell];
+                    for (int chunkStart = 0; chunkStart < numInCell; chunkStart += ES_GEONAMES_DISTANCE_CHUNK) {
+                        int chunkSize = numInCell - chunkStart < ES_GEONAMES_DISTANCE_CHUNK ? numInCell - chunkStart : ES_GEONAMES_DISTANCE_CHUNK;
+                        for (int i = 0; i < chunkSize; i++) {
+                            const ESCityData *thisData = cityData + cityIndices[chunkStart + i];
+                            latitudes[i] = thisData->latitude;
+                            longitudes[i] = thisData->longitude;
+                        }
+                        ESLocation::kmFromLatLongDegrees(latitudeDegrees, longitudeDegrees, latitudes, longitudes, chunkSize, distances);
+                        visitor->visitCities(cityIndices + chunkStart, distances, chunkSize);
+                    }
+                }
+            }
+        }
+    }
+}
+
+static ESINT64
+cellKeyForLatitudeDegrees(float latitudeDegrees,
+                          float longitudeDegrees,
+                          int   *latCell,
+                          int   *longCell) {
+    *latCell = (int)floor(latitudeDegrees / ES_GEONAMES_CELL_DEGREES);
+    *longCell = (int)floor(longitudeDegrees / ES_GEONAMES_CELL_DEGREES);
+    return ((ESINT64)*latCell << 32) | (ESUINT32)*longCell;
+}
+
+// Called without the cache lock; this is the expensive part (two passes over the city grid)
+void
+ESGeoNamesData::findCandidatesForCell(int              latCell,
+                                      int              longCell,
+                                      std::vector<int> *candidates,
+                                      float            *nonCandidateMinKm) {
+    float southLatitude = latCell * ES_GEONAMES_CELL_DEGREES;
+    float westLongitude = longCell * ES_GEONAMES_CELL_DEGREES;
+    float centerLatitude = southLatitude + ES_GEONAMES_CELL_DEGREES / 2;
+    float centerLongitude = westLongitude + ES_GEONAMES_CELL_DEGREES / 2;
+    // The corners are the farthest points from the center (the north and south corners differ away from the equator)
+    float cellRadius = fmaxf(distanceBetweenTwoCoordinates(centerLatitude, centerLongitude, southLatitude, westLongitude),
+                             distanceBetweenTwoCoordinates(centerLatitude, centerLongitude, southLatitude + ES_GEONAMES_CELL_DEGREES, westLongitude));
+    ESGeoNamesClosestVisitor closestVisitor;
+    visitCityGrid(centerLatitude, centerLongitude, &closestVisitor);
+    float maxCandidateDist = closestVisitor.thresholdKm + 2 * cellRadius + ES_GEONAMES_CELL_SLACK_KM;
+    ESGeoNamesCandidateVisitor candidateVisitor(maxCandidateDist, candidates);
+    visitCityGrid(centerLatitude, centerLongitude, &candidateVisitor);
+    *nonCandidateMinKm = candidateVisitor.nonCandidateMinKm;
+    std::sort(candidates->begin(), candidates->end());  // The grid gives them to us by cell
+}
+
+// If stableRadiusKmReturn is given, it is set to a distance that the given point can move while keeping the same
+// answer:  half the gap between the closest city and the next closest (or the nearest non-candidate, if closer).
 int
 ESGeoNamesData::findClosestCityToLatitudeDegrees(float toLatitude,
-                                                 float toLongitude) {
+                                                 float toLongitude,
+                                                 float *stableRadiusKmReturn) {
     traceEnter("findClosestCityToLatitudeDegrees");
     ensureCityData();
+    ensureCityGrid();
+    int latCell;
+    int longCell;
+    ESINT64 cellKey = cellKeyForLatitudeDegrees(toLatitude, toLongitude, &latCell, &longCell);
+    const ESCityData *cityData = _cityData->array();
+    ESGeoNamesCellCache *cache = _closestCityCache;
+    cache->lock.lock();
+    ESGeoNamesCellCache::CellMap::iterator iter = cache->cells.find(cellKey);
+    if (iter == cache->cells.end()) {
+        cache->lock.unlock();
+        std::vector<int> candidates;
+        float nonCandidateMinKm;
+        findCandidatesForCell(latCell, longCell, &candidates, &nonCandidateMinKm);
+        cache->lock.lock();
+        iter = cache->cells.find(cellKey);
+        if (iter == cache->cells.end()) {  // Another thread may have beaten us to it
+            if (cache->cells.size() >= ES_GEONAMES_MAX_CACHED_CELLS) {
+                cache->cells.erase(cache->lru.back());
+                cache->lru.pop_back();
+            }
+            iter = cache->cells.insert(std::make_pair(cellKey, ESGeoNamesCellCache::Cell())).first;
+            iter->second.candidates.swap(candidates);
+            iter->second.nonCandidateMinKm = nonCandidateMinKm;
+            cache->lru.push_front(cellKey);
+            iter->second.lruPosition = cache->lru.begin();
+        }
+    } else {
+        cache->lru.splice(cache->lru.begin(), cache->lru, iter->second.lruPosition);
+    }
     float closestDist = 1E20;
+    float nextClosestDist = 1E20;
+    if (stableRadiusKmReturn) {
+        // No non-candidate can be closer to us than its distance to the center less our distance to the center
+        float centerLatitude = latCell * ES_GEONAMES_CELL_DEGREES + ES_GEONAMES_CELL_DEGREES / 2;
+        float centerLongitude = longCell * ES_GEONAMES_CELL_DEGREES + ES_GEONAMES_CELL_DEGREES / 2;
+        nextClosestDist = iter->second.nonCandidateMinKm - ES_GEONAMES_CELL_SLACK_KM
+            - distanceBetweenTwoCoordinates(toLatitude, toLongitude, centerLatitude, centerLongitude);
+    }
     int indx = -1;
-    for (int i = 0; i < _numCities; i++) {
-	const ESCityData *thisData = _cityData->array() + i;
+    std::vector<int>::const_iterator end = iter->second.candidates.end();
+    for (std::vector<int>::const_iterator candidate = iter->second.candidates.begin(); candidate != end; candidate++) {
+	const ESCityData *thisData = cityData + *candidate;
 	float thisDist = distanceBetweenTwoCoordinates(thisData->latitude, thisData->longitude,
 						       toLatitude, toLongitude);
 	if (thisDist < closestDist) {
+            nextClosestDist = fminf(nextClosestDist, closestDist);
 	    closestDist = thisDist;
-	    indx = i;
-	}
+	    indx = *candidate;
+	} else if (thisDist < nextClosestDist) {
+            nextClosestDist = thisDist;
+        }
+    }
+    cache->lock.unlock();
+    if (stableRadiusKmReturn) {
+        *stableRadiusKmReturn = nextClosestDist > closestDist ? (nextClosestDist - closestDist) / 2 : 0;
     }
     traceExit("findClosestCityToLatitudeDegrees");
     return indx;
 }
 
+void
+ESGeoNamesData::clearClosestCityCache() {
+    _closestCityCache->lock.lock();
+    _closestCityCache->cells.clear();
+    _closestCityCache->lru.clear();
+    _closestCityCache->lock.unlock();
+}
+
+// Best match scores each city by distance / sqrt(population), lowest score winning (the lowest index among equal
+// scores).  We first score the largest cities, in descending population order, to get a good score quickly.  Every
+// city not yet scored is no bigger than the next one in that order, so it can only win (or tie) if it's within the
+// current best score times the square root of that population; the grid then shows us only the cities that close,
+// each of which we score exactly as the rest.  Nothing is approximated, so the result is the same as scoring every
+// city.
+#define ES_GEONAMES_BEST_MATCH_LARGEST_CITIES 256
+
+// A great-circle distance is never less than the distance along the meridian between the two latitudes.  This
+// is a slightly conservative version of that, so that rounding can't make it exceed the real distance.
+#define ES_GEONAMES_KM_PER_DEGREE_LATITUDE_LOWER_BOUND (6371 * M_PI / 180 * 0.999)
+
+// Scores each city and keeps the best, with the same arithmetic and tie-break as the straightforward loop
+struct ESGeoNamesBestMatchScorer {
+                            ESGeoNamesBestMatchScorer(const ESCityData *cityDataArray,
+                                                      float            toLatitudeDegrees,
+                                                      float            toLongitudeDegrees)
+    :   cityData(cityDataArray),
+        toLatitude(toLatitudeDegrees),
+        toLongitude(toLongitudeDegrees),
+        bestScore(1E20),
+        bestIndex(-1)
+    {
+    }
+
+    // The farthest a city of the given population can be and still win or tie, with slack for the rounding in the
+    // score and in distances which are bounded rather than computed exactly
+    float                   maxWinningKm(float sqrtPopulation) {
+        return bestScore * sqrtPopulation * (1 + ES_GEONAMES_GRID_RELATIVE_SLACK) + ES_GEONAMES_CELL_SLACK_KM;
+    }
+
+    void                    scoreCity(int i) {
+        const ESCityData *thisData = cityData + i;
+        float sqrtPopulation = powf(thisData->population, .5);
+        if (fabsf(thisData->latitude - toLatitude) * ES_GEONAMES_KM_PER_DEGREE_LATITUDE_LOWER_BOUND >= maxWinningKm(sqrtPopulation)) {
+            return;
+        }
+        float score = distanceBetweenTwoCoordinates(thisData->latitude, thisData->longitude,
+                                                    toLatitude, toLongitude) / sqrtPopulation;
+        if (score < bestScore || (score == bestScore && i < bestIndex)) {
+            bestScore = score;
+            bestIndex = i;
+        }
+    }
+
+    const ESCityData        *cityData;
+    float                   toLatitude;
+    float                   toLongitude;
+    float                   bestScore;
+    int                     bestIndex;
+};
+
+// Scores every city the grid shows it within the distance at which a city of maxPopulation could still win
+struct ESGeoNamesBestMatchVisitor : public ESGeoNamesGridVisitor {
+                            ESGeoNamesBestMatchVisitor(ESGeoNamesBestMatchScorer *theScorer,
+                                                       ESUINT32                  maxPopulation)
+    :   scorer(theScorer),
+        sqrtMaxPopulation(powf(maxPopulation, .5))
+    {
+        thresholdKm = scorer->maxWinningKm(sqrtMaxPopulation);
+    }
+
+    /*virtual*/ void        visitCities(const int   *cityIndices,
+                                        const float *distancesKm,
+                                        int         count) {
+        for (int i = 0; i < count; i++) {
+            if (distancesKm[i] <= thresholdKm) {
+                scorer->scoreCity(cityIndices[i]);
+            }
+        }
+        thresholdKm = scorer->maxWinningKm(sqrtMaxPopulation);
+    }
+
+    ESGeoNamesBestMatchScorer *scorer;
+    float                   sqrtMaxPopulation;
+};
+
 int
 ESGeoNamesData::findBestMatchCityToLatitudeDegrees(float toLatitude,
                                                    float toLongitude) {
     ensureCityData();
-    float closestDist = 1E20;
-    int indx = -1;
+    ensurePopulationOrder();
+    ensureCityGrid();
+    const ESCityData *cityData = _cityData->array();
+    ESGeoNamesBestMatchScorer scorer(cityData, toLatitude, toLongitude);
+    int j = 0;
+    for (; j < _numCities && j < ES_GEONAMES_BEST_MATCH_LARGEST_CITIES; j++) {
+        int i = _populationOrder[j];
+        if (cityData[i].population == 0) {
+            return scorer.bestIndex;  // This and the rest score infinity (or NaN), which never wins
+        }
+        scorer.scoreCity(i);
+    }
+    if (j < _numCities && cityData[_populationOrder[j]].population > 0) {
+        ESGeoNamesBestMatchVisitor visitor(&scorer, cityData[_populationOrder[j]].population);
+        visitCityGrid(toLatitude, toLongitude, &visitor);
+    }
+    return scorer.bestIndex;
+}
+
+static const ESCityData *populationSortCityData;  // Only valid during setupPopulationOrder, which is called with its lock held
+
+static int
+populationOrderComparator(const void *v1, const void *v2) {
+    ESUINT32 pop1 = populationSortCityData[*(const int *)v1].population;
+    ESUINT32 pop2 = populationSortCityData[*(const int *)v2].population;
+    if (pop1 != pop2) {
+        return pop1 > pop2 ? -1 : 1;
+    }
+    return *(const int *)v1 - *(const int *)v2;  // Keep ties in index order, as the unsorted loops did
+}
+
+void
+ESGeoNamesData::setupPopulationOrder() {
+    traceEnter("setupPopulationOrder");
+    ESAssert(_cityData);
+    const ESCityData *cityData = _cityData->array();
+    _logPopulations = (float *)malloc(_numCities * sizeof(float));
+    int *populationOrder = (int *)malloc(_numCities * sizeof(int));
     for (int i = 0; i < _numCities; i++) {
-	const ESCityData *thisData = _cityData->array() + i;
-	float thisDist = distanceBetweenTwoCoordinates(thisData->latitude, thisData->longitude,
-						       toLatitude, toLongitude) / powf(thisData->population, .5);
-	if (thisDist < closestDist) {
-	    closestDist = thisDist;
-	    indx = i;
-	}
+        _logPopulations[i] = logf((float)cityData[i].population);  // -inf for population 0, which never wins
+        populationOrder[i] = i;
     }
-    return indx;
+    populationSortCityData = cityData;
+    qsort(populationOrder, _numCities, sizeof(int), populationOrderComparator);
+    populationSortCityData = NULL;
+    _populationOrder = populationOrder;
+    traceExit("setupPopulationOrder");
+}
+
+// The names file starts with a table of 255 symbols of up to 8 bytes each (code 0 is end-of-name), followed by the
+// symbol lengths, followed by the names, each a string of codes.  Code 255 is an escape for a single literal byte.
+// See data/compressNames.pl.  Each symbol is copied as a full 8 bytes and then the output pointer advances only by its
+// length, which is why the buffer needs some slop past the longest name.
+// A negative nameIndex is a name from the overlay (see readNameIndices).
+const char *
+ESGeoNamesData::decodeNameAtNameIndex(int  nameIndex,
+                                      char *buffer) {
+    if (nameIndex < 0) {
+        ESAssert(_overlay);
+        strcpy(buffer, &_overlay->names[-1 - nameIndex]);  // Its length was checked when it was read
+        return buffer;
+    }
+    const unsigned char *symbols = _cityNames->array();
+    const unsigned char *symbolLengths = symbols + 256 * 8;
+    const unsigned char *code = symbols + ES_GEONAMES_SYMBOL_TABLE_SIZE + nameIndex;
+    char *out = buffer;
+    while (true) {
+        unsigned char c = *code++;
+        if (c == 0) {
+            break;
+        } else if (c == 255) {
+            *out++ = *code++;
+        } else {
+            memcpy(out, symbols + c * 8, 8);
+            out += symbolLengths[c];
+        }
+    }
+    *out = '\0';
+    ESAssert(out - buffer < ES_GEONAMES_NAME_BUFFER_SIZE - 8);
+    return buffer;
 }
 
 std::string
 ESGeoNamesData::getDisplayNameAtNameIndex(int nameIndex) {
-    const char *compoundName = _cityNames->array() + nameIndex;
+    char nameBuffer[ES_GEONAMES_NAME_BUFFER_SIZE];
+    const char *compoundName = decodeNameAtNameIndex(nameIndex, nameBuffer);
     const char *displayNameStart = strrchr(compoundName, '+');
     if (displayNameStart) {
 	displayNameStart++;  // Move past '+'
@@ -571,15 +2365,7 @@ ESGeoNamesData::findBestCityForTZName(const std::string &tzName) {
     // }
 #endif
     // First get tz index of tzName
-    const char **ptr = _tzNames->strings();
-    const char **end = ptr + _tzNames->numStrings();
-    int tzIndex = -1;
-    for (int i = 0; ptr < end; ptr++, i++) {
-        if (tzName == *ptr) {
-            tzIndex = i;
-            break;
-        }
-    }
+    int tzIndex = tzIndexForName(tzName.c_str());
     // ESErrorReporter::logInfo("ESGeoNamesData::findBestCityForTZName", 
     //                          "tz '%s' is at index %d", tzName.c_str(), tzIndex);
     int bestCityIndex = -1;
@@ -642,7 +2428,11 @@ ESGeoNamesData::findBestCityForTZName(const std::string &tzName) {
     double bestDistance = 1E100;
     const short *tzIndices = _tzIndices->array();
     const ESTZData *cacheArray = _tzCache->array();
+    const ESUINT32 *suppressed = suppressedCityBits();  // (The population search above passes them over already)
     for (int i = 0; i < _numCities; i++) {
+        if (suppressed && bitIsSet(suppressed, i)) {
+            continue;
+        }
         const ESTZData &cacheEntry = cacheArray[tzIndices[i]];
         if (currentOffset == cacheEntry.currentOffset &&
             nextTransition == cacheEntry.nextTransition &&
@@ -675,6 +2465,9 @@ ESGeoNamesData::findBestCityForTZName(const std::string &tzName) {
     // now we care only about currentOffset, and ignore nextTransition and postTransitionOffset.
     
     for (int i = 0; i < _numCities; i++) {
+        if (suppressed && bitIsSet(suppressed, i)) {
+            continue;
+        }
         const ESTZData &cacheEntry = cacheArray[tzIndices[i]];
         if (currentOffset == cacheEntry.currentOffset) {
             if (cityAtIndexIsOlsonCity(i)) {
@@ -704,6 +2497,9 @@ ESGeoNamesData::findBestCityForTZName(const std::string &tzName) {
     int indexOfLargestCityWithin15km = -1;
     ESUINT32 populationOfLargestCityWithin15km = 0;
     for (int i = 0; i < _numCities; i++) {
+        if (suppressed && bitIsSet(suppressed, i)) {
+            continue;
+        }
         const ESTZData &cacheEntry = cacheArray[tzIndices[i]];
         if (currentOffset == cacheEntry.currentOffset) {
             const ESCityData *thisData = _cityData->array() + i;
@@ -743,9 +2539,10 @@ ESGeoNamesData::findBestCityForTZName(const std::string &tzName) {
 
 void
 ESGeoNames::findClosestCityToLatitudeDegrees(float toLatitude,
-                                             float toLongitude) {
+                                             float toLongitude,
+                                             float *stableRadiusKmReturn) {
     ESAssert(sharedData);
-    _selectedCityIndex = sharedData->findClosestCityToLatitudeDegrees(toLatitude, toLongitude);
+    _selectedCityIndex = sharedData->findClosestCityToLatitudeDegrees(toLatitude, toLongitude, stableRadiusKmReturn);
 }
 
 void
@@ -775,14 +2572,17 @@ ESGeoNamesData::cityNameForSelectedIndex(int indx) {
 	return "";
     }
     ensureCityNames();
+    if (overlay()) {
+        ensureNameIndices();  // The overlay may have changed the name, so the file won't do
+    }
     int nameIndex;
-    modifyLock->lock();
+    arrayLocks[ESGeoNamesNameIndices]->lock();
     if (_nameIndices) {
 	nameIndex = _nameIndices->array()[indx];
     } else {
-        ESFileArray<int>::readElementFromFileAtIndex("/eslocation/loc-index.dat", ESFilePathTypeRelativeToResourceDir, indx, &nameIndex);
+        ESFileArray<int>::readElementFromFileAtIndex(dataPath("loc-index-fsst.dat").c_str(), ESFilePathTypeRelativeToResourceDir, indx, &nameIndex);
     }
-    modifyLock->unlock();
+    arrayLocks[ESGeoNamesNameIndices]->unlock();
     std::string displayName = getDisplayNameAtNameIndex(nameIndex);
     traceExit("cityNameForSelectedIndex");
     return displayName;
@@ -794,12 +2594,18 @@ ESGeoNamesData::cityRegionNameForSelectedIndex(int indx) {     // returns last f
 	return "";
     }
     //ESTime::noteTimeAtPhase("selectedCityRegionName start");
-    short regionIndex;
-    ESFileArray<short>::readElementFromFileAtIndex("/eslocation/loc-region.dat", ESFilePathTypeRelativeToResourceDir, indx, &regionIndex);
+    int regionIndex = readRegionIndexFromFile(indx);
     //ESTime::noteTimeAtPhase("selectedCityRegionName finished reading region index");
-    ESRegionDesc regionDesc;
-    ESFileArray<ESRegionDesc>::readElementFromFileAtIndex("/eslocation/loc-regiondesc.dat", ESFilePathTypeRelativeToResourceDir, regionIndex, &regionDesc);
+    ESWideRegionDesc regionDesc;
+    readRegionDescFromFile(regionIndex, &regionDesc);
     //ESTime::noteTimeAtPhase("selectedCityRegionName finished reading region descriptor");
+    std::string regionString = regionNameForRegionDesc(regionDesc);
+    //ESTime::noteTimeAtPhase("selectedCityRegionName end");
+    return regionString;
+}
+
+std::string
+ESGeoNamesData::regionNameForRegionDesc(const ESWideRegionDesc &regionDesc) {
     std::string regionString = "";
     if (regionDesc.a2Index >= 0) {
         ensureA2Names();
@@ -830,7 +2636,6 @@ ESGeoNamesData::cityRegionNameForSelectedIndex(int indx) {     // returns last f
 	    }
 	}
     }
-    //ESTime::noteTimeAtPhase("selectedCityRegionName end");
     return regionString;
 }
 
@@ -850,6 +2655,152 @@ ESGeoNamesData::cityTZNameForSelectedIndex(int indx) {
     return _tzNames->stringAtIndex(_tzIndices->array()[indx]);
 }
 
+std::string
+ESGeoNamesData::tzNameForTZIndex(int tzIndex) {
+    if (tzIndex < 0) {
+	return "";
+    }
+    ensureTZ();
+    return _tzNames->stringAtIndex(tzIndex);
+}
+
+// The raster gives the zone for most of the globe in constant time; in cells where the closest city might be in
+// either of two zones, fall back to finding it.
+int
+ESGeoNamesData::tzIndexForLatitudeDegrees(float latitudeDegrees,
+                                          float longitudeDegrees) {
+    ensureTZRaster();
+    int tzIndex = ES_GEONAMES_TZ_RASTER_BORDER;
+    arrayLocks[ESGeoNamesTZRaster]->lock();
+    if (_tzRaster && _tzRasterUsable) {  // (It might have been trimmed since we ensured it, in which case we'll do it the slow way this once)
+        const unsigned short *raster = _tzRaster->array();
+        int cellsPerDegree = raster[0];
+        int blockSize = raster[1];
+        int numRows = 180 * cellsPerDegree;
+        int numColumns = 360 * cellsPerDegree;
+        int row = (int)floorf((latitudeDegrees + 90) * cellsPerDegree);
+        if (row < 0) {
+            row = 0;
+        } else if (row >= numRows) {
+            row = numRows - 1;
+        }
+        int column = (int)floorf((longitudeDegrees + 180) * cellsPerDegree) % numColumns;
+        if (column < 0) {
+            column += numColumns;
+        }
+        int overlayValue = _overlay ? overlayRasterCellValue(_overlay->tzRasterCells, row * numColumns + column) : -1;
+        if (overlayValue >= 0) {
+            tzIndex = overlayValue;
+        } else {
+            int blocksPerRow = numColumns / blockSize;
+            const unsigned short *blocks = raster + ES_GEONAMES_TZ_RASTER_HEADER_SIZE;
+            unsigned short entry = blocks[(row / blockSize) * blocksPerRow + column / blockSize];
+            if (entry & ES_GEONAMES_TZ_RASTER_DETAIL_FLAG) {
+                const unsigned short *details = blocks + (numRows / blockSize) * blocksPerRow;
+                entry = details[(entry & ~ES_GEONAMES_TZ_RASTER_DETAIL_FLAG) * blockSize * blockSize
+                                + (row % blockSize) * blockSize + column % blockSize];
+            }
+            tzIndex = entry;
+        }
+    }
+    arrayLocks[ESGeoNamesTZRaster]->unlock();
+    if (tzIndex == ES_GEONAMES_TZ_RASTER_BORDER) {
+        int cityIndex = findClosestCityToLatitudeDegrees(latitudeDegrees, longitudeDegrees);
+        if (cityIndex < 0) {
+            return -1;  // No cities (e.g., all suppressed by the overlay)
+        }
+        ensureTZ();
+        tzIndex = _tzIndices->array()[cityIndex];
+    }
+    return tzIndex;
+}
+
+// Needs nothing but the country raster.  Each row is a sorted list of runs, so this is a short binary search.
+std::string
+ESGeoNamesData::rasterCountryCodeForLatitudeDegrees(float latitudeDegrees,
+                                                    float longitudeDegrees) {
+    ensureCCRaster();
+    std::string countryCode;
+    arrayLocks[ESGeoNamesCCRaster]->lock();
+    if (_ccRaster && _ccRasterUsable) {  // (It might have been trimmed since we ensured it)
+        const unsigned short *header = (const unsigned short *)_ccRaster->array();
+        int cellsPerDegree = header[0];
+        int numCountries = header[1];
+        size_t numRuns = header[2] | ((size_t)header[3] << 16);
+        int numRows = 180 * cellsPerDegree;
+        int numColumns = 360 * cellsPerDegree;
+        const unsigned short *codes = header + ES_GEONAMES_CC_RASTER_HEADER_SIZE;
+        const unsigned short *rowStarts = codes + numCountries;
+        const unsigned short *runStarts = rowStarts + numRows + 1;
+        const unsigned char *runValues = (const unsigned char *)(runStarts + numRuns);
+        int row = (int)floorf((latitudeDegrees + 90) * cellsPerDegree);
+        if (row < 0) {
+            row = 0;
+        } else if (row >= numRows) {
+            row = numRows - 1;
+        }
+        int column = (int)floorf((longitudeDegrees + 180) * cellsPerDegree) % numColumns;
+        if (column < 0) {
+            column += numColumns;
+        }
+        int ccIndex = _overlay ? overlayRasterCellValue(_overlay->ccRasterCells, row * numColumns + column) : -1;
+        if (ccIndex < 0) {
+            // Find the last run in the row starting at or before column (the first run in each row starts at column 0)
+            int lo = rowStarts[row];
+            int hi = rowStarts[row + 1] - 1;
+            while (lo < hi) {
+                int mid = (lo + hi + 1) / 2;
+                if (runStarts[mid] <= column) {
+                    lo = mid;
+                } else {
+                    hi = mid - 1;
+                }
+            }
+            ccIndex = runValues[lo];
+        }
+        if (ccIndex != ES_GEONAMES_CC_RASTER_BORDER) {
+            ESAssert(ccIndex < numCountries);
+            char str[3];
+            bcopy(&codes[ccIndex], str, 2);
+            str[2] = '\0';
+            countryCode = str;
+        }
+    }
+    arrayLocks[ESGeoNamesCCRaster]->unlock();
+    return countryCode;
+}
+
+std::string
+ESGeoNamesData::countryCodeForLatitudeDegrees(float latitudeDegrees,
+                                              float longitudeDegrees) {
+    std::string countryCode = rasterCountryCodeForLatitudeDegrees(latitudeDegrees, longitudeDegrees);
+    if (countryCode.empty()) {
+        countryCode = cityCountryCodeForSelectedIndex(findClosestCityToLatitudeDegrees(latitudeDegrees, longitudeDegrees));
+    }
+    return countryCode;
+}
+
+std::string
+ESGeoNames::countryCodeForLatitudeDegrees(float latitudeDegrees,
+                                          float longitudeDegrees) {
+    ESAssert(sharedData);
+    return sharedData->countryCodeForLatitudeDegrees(latitudeDegrees, longitudeDegrees);
+}
+
+std::string
+ESGeoNames::rasterCountryCodeForLatitudeDegrees(float latitudeDegrees,
+                                                float longitudeDegrees) {
+    ESAssert(sharedData);
+    return sharedData->rasterCountryCodeForLatitudeDegrees(latitudeDegrees, longitudeDegrees);
+}
+
+std::string
+ESGeoNames::tzNameForLatitudeDegrees(float latitudeDegrees,
+                                     float longitudeDegrees) {
+    ESAssert(sharedData);
+    return sharedData->tzNameForTZIndex(sharedData->tzIndexForLatitudeDegrees(latitudeDegrees, longitudeDegrees));
+}
+
 float 
 ESGeoNamesData::cityLatitudeForSelectedIndex(int indx) {
     ESAssert(_cityData);
@@ -907,23 +2858,118 @@ ESGeoNames::selectedCityValidForSlotAtOffsetHour(int offsetHours) {
 std::string 
 ESGeoNamesData::cityCountryCodeForSelectedIndex(int indx) {
     traceEnter("selectedCityCountryCode");
-    if (indx >= 0) {
-        ensureCCCodes();
-        ensureRegions();
-        ESAssert(indx < _numCities);
-        short regionIndex = _cityRegions->array()[indx];
-        ESRegionDesc regionDesc;
-        ESFileArray<ESRegionDesc>::readElementFromFileAtIndex("/eslocation/loc-regiondesc.dat", ESFilePathTypeRelativeToResourceDir, regionIndex, &regionDesc);
-        short container = _ccCodes->array()[regionDesc.ccIndex];
-        char str[3];
-        bcopy(&container, str, 2);
-        str[2] = '\0';
-        traceExit("selectedCityCountryCode");
-        return str;
-    } else {
+    if (indx < 0) {
         traceExit("selectedCityCountryCode");
         return "";
     }
+    ESAssert(indx < _numCities);
+    // Unlike the other selected* lookups, this one is safe off the main thread (countryCodeForLatitudeDegrees is for any
+    // thread), so it holds the locks of the evictable arrays it reads, in enum order; if trimToBudget evicts one between
+    // ensuring it and locking it, go round again
+    bool descsLoaded = overlay() != NULL;  // Else the one desc is read from the file
+    char str[3] = "";
+    bool done = false;
+    while (!done) {
+        ensureRegions();
+        if (descsLoaded) {
+            ensureRegionDescs();
+        }
+        ensureCCCodes();
+        arrayLocks[ESGeoNamesRegions]->lock();
+        arrayLocks[ESGeoNamesRegionDescs]->lock();
+        arrayLocks[ESGeoNamesCCCodes]->lock();
+        done = _cityRegions && (_regionDescs || !descsLoaded) && _ccCodes;
+        if (done) {
+            ESWideRegionDesc regionDesc;
+            if (descsLoaded) {
+                regionDescAtIndex(regionIndexForCity(indx), &regionDesc);  // Not readRegionDescFromFile, which would ensure it again
+            } else {
+                readRegionDescFromFile(regionIndexForCity(indx), &regionDesc);
+            }
+            if (regionDesc.ccIndex >= 0) {
+                bcopy(&_ccCodes->array()[regionDesc.ccIndex], str, 2);
+                str[2] = '\0';
+            }
+        }
+        arrayLocks[ESGeoNamesCCCodes]->unlock();
+        arrayLocks[ESGeoNamesRegionDescs]->unlock();
+        arrayLocks[ESGeoNamesRegions]->unlock();
+    }
+    traceExit("selectedCityCountryCode");
+    return str;
+}
+
+// The selected* values for a page of results at once.  The arrays they come from are each loaded (or found loaded)
+// once, rather than read from the files row by row, and each region name and zone is built or copied once however
+// many rows share it.  The strings go in text as they're made, and the rows point into it at the end, once it's
+// done growing.
+void
+ESGeoNamesData::fillSearchResults(const int              *cityIndices,
+                                  int                    numCities,
+                                  ESGeoNamesSearchResult *resultsReturn,
+                                  std::vector<char>      *textReturn) {
+    traceEnter("fillSearchResults");
+    ensureCityData();
+    ensureCityNames();
+    ensureNameIndices();
+    ensureRegions();
+    ensureRegionDescs();
+    ensureCCCodes();
+    ensureTZ();
+    textReturn->clear();
+    std::vector<size_t> offsets(3 * numCities);  // name, region, zone for each row
+    std::map<int, size_t> regionOffsets;
+    std::map<int, size_t> tzOffsets;
+    char nameBuffer[ES_GEONAMES_NAME_BUFFER_SIZE];
+    for (int r = 0; r < numCities; r++) {
+        int indx = cityIndices[r];
+        ESAssert(indx >= 0 && indx < _numCities);
+        ESGeoNamesSearchResult *result = resultsReturn + r;
+        result->cityIndex = indx;
+        const ESCityData *thisData = _cityData->array() + indx;
+        result->latitude = thisData->latitude;
+        result->longitude = thisData->longitude;
+        result->population = thisData->population;
+
+        const char *compoundName = decodeNameAtNameIndex(_nameIndices->array()[indx], nameBuffer);
+        const char *displayName = strrchr(compoundName, '+');
+        displayName = displayName ? displayName + 1 : compoundName;
+        offsets[3 * r] = textReturn->size();
+        textReturn->insert(textReturn->end(), displayName, displayName + strlen(displayName) + 1);
+
+        int regionIndex = regionIndexForCity(indx);
+        ESWideRegionDesc regionDesc;
+        regionDescAtIndex(regionIndex, &regionDesc);
+        std::map<int, size_t>::iterator region = regionOffsets.find(regionIndex);
+        if (region == regionOffsets.end()) {
+            std::string regionName = regionNameForRegionDesc(regionDesc);
+            region = regionOffsets.insert(std::make_pair(regionIndex, textReturn->size())).first;
+            textReturn->insert(textReturn->end(), regionName.c_str(), regionName.c_str() + regionName.length() + 1);
+        }
+        offsets[3 * r + 1] = region->second;
+        if (regionDesc.ccIndex >= 0) {
+            bcopy(&_ccCodes->array()[regionDesc.ccIndex], result->countryCode, 2);
+            result->countryCode[2] = '\0';
+        } else {
+            result->countryCode[0] = '\0';
+        }
+
+        int tzIndex = _tzIndices->array()[indx];
+        std::map<int, size_t>::iterator tz = tzOffsets.find(tzIndex);
+        if (tz == tzOffsets.end()) {
+            const char *tzName = _tzNames->stringAtIndex(tzIndex);
+            tz = tzOffsets.insert(std::make_pair(tzIndex, textReturn->size())).first;
+            textReturn->insert(textReturn->end(), tzName, tzName + strlen(tzName) + 1);
+        }
+        offsets[3 * r + 2] = tz->second;
+    }
+    const char *text = textReturn->empty() ? NULL : &(*textReturn)[0];
+    for (int r = 0; r < numCities; r++) {
+        resultsReturn[r].name = text + offsets[3 * r];
+        resultsReturn[r].regionName = text + offsets[3 * r + 1];
+        resultsReturn[r].tzName = text + offsets[3 * r + 2];
+    }
+    traceExit("fillSearchResults");
 }
 
 std::string 
@@ -963,13 +3009,38 @@ int comparator(const void *v1, const void *v2) {
 // so the idea is to match find as much matching info as possible and assign a higher confidence level based on:
 //  - which things match (eg. state is more definitive than country)
 //  - how many of the quantities match
-// we'll probably want to catch a few special cases (eg. "GB" for "UK", "USA" for "United States")
+// the special cases ("USA" for "United States", "UK" for "GB") are aliases in ESGeoNamesHashTables.hpp
 // it must all be case-insensitive compares
+//
+// The country and code are looked up once here, as is the state as an admin1 code in that country, so each city
+// compares indices rather than strings.
+void
+ESGeoNamesData::resolveRegionQuery(const char            *state,
+                                   const char            *country,
+                                   const char            *code,
+                                   ESGeoNamesRegionQuery *queryReturn) {
+    ensureCCCodes();
+    ensureA1Codes();
+    queryReturn->state = state;
+    queryReturn->hasCountry = *code || *country;
+    queryReturn->ccIndices[0] = ccIndexForCountry(code);
+    queryReturn->ccIndices[1] = ccIndexForCountry(country);
+    for (int i = 0; i < 2; i++) {
+        queryReturn->stateA1Indices[i] = -1;
+        int ccIndex = queryReturn->ccIndices[i];
+        char a1Code[32];
+        if (ccIndex >= 0 && *state && strlen(state) < sizeof(a1Code) - 3) {
+            memcpy(a1Code, &_ccCodes->array()[ccIndex], 2);
+            a1Code[2] = '.';
+            strcpy(a1Code + 3, state);
+            queryReturn->stateA1Indices[i] = a1IndexForCode(a1Code);
+        }
+    }
+}
+
 int
-ESGeoNamesData::regionMatchConfidenceForIndex(int         cityIndex,
-                                              const char *state,
-                                              const char *country,
-                                              const char *code) {
+ESGeoNamesData::regionMatchConfidenceForIndex(int                         cityIndex,
+                                              const ESGeoNamesRegionQuery &query) {
     traceEnter("regionMatchConfidence");
     ESAssert(cityIndex >= 0);
     ESAssert(cityIndex < _numCities);
@@ -978,8 +3049,9 @@ ESGeoNamesData::regionMatchConfidenceForIndex(int         cityIndex,
     ensureRegions();
     ensureRegionDescs();
 
-    short regionIndex = _cityRegions->array()[cityIndex];
-    const ESRegionDesc *regionDesc = _regionDescs->array() + regionIndex;
+    ESWideRegionDesc regionDescBuffer;
+    regionDescAtIndex(regionIndexForCity(cityIndex), &regionDescBuffer);
+    const ESWideRegionDesc *regionDesc = &regionDescBuffer;
 
 #ifndef NDEBUG
     static bool firstTime = false;
@@ -995,50 +3067,40 @@ ESGeoNamesData::regionMatchConfidenceForIndex(int         cityIndex,
 #endif
 
     int confidenceLevel = 0;
-    const char *a1String = "";
-    std::string a1Code = "";
-    const char *cString = "";
-    std::string cCode = "";
-    if (regionDesc->a1Index >= 0) {
-        ensureA1Names();
-	a1String = _a1Names->stringAtIndex(regionDesc->a1Index);
-	a1Code = std::string(_a1Codes->stringAtIndex(regionDesc->a1Index)).substr(3,2);
-	ESAssert(a1String && *a1String);
-	ESAssert(a1Code.length());
-    }
-    if (regionDesc->ccIndex >= 0) {
-        ensureCCNames();
-	cString = _ccNames->stringAtIndex(regionDesc->ccIndex);
-	cCode = std::string(_a1Codes->stringAtIndex(regionDesc->a1Index)).substr(0,2);
-    }
-
+    const char *state = query.state;
     bool statesMatch = false;
     bool countriesMatch = false;
-    if (( *a1String             && *state && strcasecmp(state, a1String)       == 0) ||
-        (  a1Code.length() > 0  && *state && strcasecmp(state, a1Code.c_str()) == 0)) {
-	statesMatch = true;
-	confidenceLevel++;
+    if (*state && regionDesc->a1Index >= 0) {
+        ensureA1Names();
+	const char *a1String = _a1Names->stringAtIndex(regionDesc->a1Index);
+	if (*a1String && strcasecmp(state, a1String) == 0) {
+	    statesMatch = true;
+	} else if (query.hasCountry) {
+	    // Only a city in the query's country can match, and the state's code there was looked up once
+	    statesMatch = regionDesc->a1Index == query.stateA1Indices[0] || regionDesc->a1Index == query.stateA1Indices[1];
+	} else {
+	    const char *a1Code = _a1Codes->stringAtIndex(regionDesc->a1Index);  // "CC.A1"
+	    statesMatch = strlen(a1Code) > 3 && strcasecmp(state, a1Code + 3) == 0;
+	}
+	if (statesMatch) {
+	    confidenceLevel++;
+	}
     }
-    if ((cCode.length() > 0    && *code    && ( strcasecmp(code, cCode.c_str()) == 0 ||
-                                                            (strcasecmp(code, "GB") == 0    && strcasecmp(cCode.c_str(), "UK") == 0))) ||
-	(cCode.length() > 0    && *country && ( strcasecmp(country, cCode.c_str()) == 0 ||
-                                                            (strcasecmp(country, "GB") == 0 && strcasecmp(cCode.c_str(), "UK") == 0))) ||
-        (*cString              && *country && ( strcasecmp(country, cString) == 0 ||
-                                                (strcasecmp(country, "USA") == 0 && strcasecmp(cString, "United States")  == 0) ||
-                                                (strcasecmp(country, "GB")  == 0 && strcasecmp(cString, "United Kingdom") == 0)))) {
+    if (regionDesc->ccIndex >= 0 &&
+        (regionDesc->ccIndex == query.ccIndices[0] || regionDesc->ccIndex == query.ccIndices[1])) {
 	countriesMatch = true;
 	confidenceLevel++;
     }
     
     if ((!statesMatch &&    *state > 0) ||
-	(!countriesMatch && (*code || *country))) {
+	(!countriesMatch && query.hasCountry)) {
 	confidenceLevel = 0;
     }
     // subtract some if the city name matches only partially?
 
 #ifdef ECTRACE
-    std::string tmp =  ESUtil::stringWithFormat("%s %s %s %s", a1String, a1Code.c_str(), cString, cCode.c_str());
-    std::string tmp2 = ESUtil::stringWithFormat("%s %s %s", state, country, code);
+    std::string tmp =  ESUtil::stringWithFormat("a1 %d cc %d", regionDesc->a1Index, regionDesc->ccIndex);
+    std::string tmp2 = ESUtil::stringWithFormat("%s cc %d %d a1 %d %d", state, query.ccIndices[0], query.ccIndices[1], query.stateA1Indices[0], query.stateA1Indices[1]);
     tracePrintf3("'%s' matches '%s' with confidence %d", tmp2.c_str(), tmp.c_str(), confidenceLevel);
     traceExit ("regionMatchConfidence");
 #endif
@@ -1081,9 +3143,165 @@ searchForString(const char *searchIn,
     }
 }
 
-const char *
-ESGeoNamesData::cityNamesArray() {
-    return _cityNames->array();
+// Scans of the bigger datasets are split into chunks, which worker threads (and the calling thread) take in turn.  The
+// shipped set scans in a few ms, not much more than it would take to wake the workers, so it's scanned in one piece.
+#define ES_GEONAMES_PARALLEL_SCAN_MIN_CITIES 250000
+#define ES_GEONAMES_SCAN_CHUNK_CITIES 32768        // A multiple of 32, so each chunk starts on a word of the slot bitsets
+#define ES_GEONAMES_MAX_SCAN_THREADS 8
+
+// Shared by the thread asking for the scan and the workers it sends it to; the last one done with it deletes it (a
+// worker may not start until the scan is over, in which case it finds no chunks left and just lets go of it)
+struct ESGeoNamesNameScan {
+                            ESGeoNamesNameScan(int numChunksToScan)
+    :   numChunks(numChunksToScan),
+        nextChunk(0),
+        chunkLocks(new ESLock[numChunksToScan]),
+        chunkMatches(new std::vector<int>[numChunksToScan])
+    {
+    }
+                            ~ESGeoNamesNameScan()
+    {
+        delete [] chunkLocks;
+        delete [] chunkMatches;
+    }
+
+    ESGeoNamesData          *data;
+    const char              *nameFragment;
+    const ESUINT32          *onlyCityBits;
+    int                     numCities;
+    int                     numChunks;
+    int                     nextChunk;           // Guarded by lock
+    int                     refCount;            // Guarded by lock
+    ESLock                  lock;
+    ESLock                  *chunkLocks;         // Each held by whoever is scanning that chunk, from when it's claimed until it's done
+    std::vector<int>        *chunkMatches;       // Matches found in each chunk
+};
+
+static ESGeoNamesWorkerThread *scanThreads[ES_GEONAMES_MAX_SCAN_THREADS];  // Started on the first big scan, never exit
+static int numScanThreads = -1;  // Guarded by modifyLock
+
+static int
+startScanThreads() {
+    modifyLock->lock();
+    if (numScanThreads < 0) {
+        long numCPUs = sysconf(_SC_NPROCESSORS_ONLN);  // The calling thread does its share, so one fewer than this
+        numScanThreads = numCPUs > 1 ? (int)std::min(numCPUs - 1, (long)ES_GEONAMES_MAX_SCAN_THREADS) : 0;
+        for (int i = 0; i < numScanThreads; i++) {
+            scanThreads[i] = new ESGeoNamesWorkerThread("GeoNamesScan");
+            scanThreads[i]->start();
+        }
+    }
+    int numThreads = numScanThreads;
+    modifyLock->unlock();
+    return numThreads;
+}
+
+static void
+scanNameChunks(ESGeoNamesNameScan *scan) {
+    while (true) {
+        scan->lock.lock();
+        int chunk = scan->nextChunk < scan->numChunks ? scan->nextChunk++ : -1;
+        if (chunk >= 0) {
+            scan->chunkLocks[chunk].lock();  // Before the scan lock is released, so the caller can't see it claimed but not locked
+        }
+        scan->lock.unlock();
+        if (chunk < 0) {
+            return;
+        }
+        int firstCity = chunk * ES_GEONAMES_SCAN_CHUNK_CITIES;
+        int endCity = std::min(firstCity + ES_GEONAMES_SCAN_CHUNK_CITIES, scan->numCities);
+        scan->data->findCitiesMatchingNameInRange(scan->nameFragment, scan->onlyCityBits, firstCity, endCity, &scan->chunkMatches[chunk]);
+        scan->chunkLocks[chunk].unlock();
+    }
+}
+
+static void
+releaseNameScan(ESGeoNamesNameScan *scan) {
+    scan->lock.lock();
+    bool lastOne = --scan->refCount == 0;
+    scan->lock.unlock();
+    if (lastOne) {
+        delete scan;
+    }
+}
+
+static void
+nameScanGlue(void *obj,
+             void *param) {
+    ESGeoNamesNameScan *scan = (ESGeoNamesNameScan *)obj;
+    scanNameChunks(scan);
+    releaseNameScan(scan);
+}
+
+void
+ESGeoNamesData::findCitiesMatchingNameInRange(const char       *nameFragment,
+                                              const ESUINT32   *onlyCityBits,
+                                              int              firstCity,
+                                              int              endCity,
+                                              std::vector<int> *matchesReturn) {
+    bool getEmAll = *nameFragment == '\0';
+    const int *nameIndices = _nameIndices->array();
+    char nameBuffer[ES_GEONAMES_NAME_BUFFER_SIZE];
+    if (onlyCityBits) {
+        // Walk only the cities in the bitset, so the (expensive) name match is done only for those
+        ESAssert((firstCity & 31) == 0);
+        int endWord = (endCity + 31) / 32;
+        for (int w = firstCity / 32; w < endWord; w++) {
+            ESUINT32 word = onlyCityBits[w];
+            while (word) {
+                int i = (w << 5) + __builtin_ctz(word);
+                word &= word - 1;  // clear lowest set bit
+                if (getEmAll || searchForString(decodeNameAtNameIndex(nameIndices[i], nameBuffer), nameFragment)) {
+                    matchesReturn->push_back(i);
+                }
+            }
+        }
+    } else {
+        const ESUINT32 *suppressed = suppressedCityBits();  // (The slot bits above already leave these out)
+        for (int i = firstCity; i < endCity; i++) {
+            if (suppressed && bitIsSet(suppressed, i)) {
+                continue;
+            }
+            if (getEmAll || searchForString(decodeNameAtNameIndex(nameIndices[i], nameBuffer), nameFragment)) {
+                matchesReturn->push_back(i);
+            }
+        }
+    }
+}
+
+void
+ESGeoNamesData::findCitiesMatchingName(const char       *nameFragment,
+                                       const ESUINT32   *onlyCityBits,
+                                       std::vector<int> *matchesReturn) {
+    ESAssert(_cityNames && _nameIndices);
+    matchesReturn->clear();
+    if (_numCities < ES_GEONAMES_PARALLEL_SCAN_MIN_CITIES) {
+        findCitiesMatchingNameInRange(nameFragment, onlyCityBits, 0, _numCities, matchesReturn);
+        return;
+    }
+    int numWorkers = startScanThreads();
+    ESGeoNamesNameScan *scan = new ESGeoNamesNameScan((_numCities + ES_GEONAMES_SCAN_CHUNK_CITIES - 1) / ES_GEONAMES_SCAN_CHUNK_CITIES);
+    scan->data = this;
+    scan->nameFragment = nameFragment;
+    scan->onlyCityBits = onlyCityBits;
+    scan->numCities = _numCities;
+    scan->refCount = 1 + numWorkers;
+    for (int i = 0; i < numWorkers; i++) {
+        scanThreads[i]->callInThread(nameScanGlue, scan, NULL);
+    }
+    scanNameChunks(scan);
+    // Every chunk has been claimed now; wait for those still being scanned
+    size_t numMatches = 0;
+    for (int chunk = 0; chunk < scan->numChunks; chunk++) {
+        scan->chunkLocks[chunk].lock();
+        scan->chunkLocks[chunk].unlock();
+        numMatches += scan->chunkMatches[chunk].size();
+    }
+    matchesReturn->reserve(numMatches);
+    for (int chunk = 0; chunk < scan->numChunks; chunk++) {
+        matchesReturn->insert(matchesReturn->end(), scan->chunkMatches[chunk].begin(), scan->chunkMatches[chunk].end());
+    }
+    releaseNameScan(scan);
 }
 
 const int *
@@ -1096,6 +3314,11 @@ ESGeoNamesData::cityDataArray() {
     return _cityData->array();
 }
 
+const float *
+ESGeoNamesData::logPopulationsArray() {
+    return _logPopulations;
+}
+
 void
 ESGeoNames::searchForCityNameFragment(const char *cityNameFragment,
                                       bool       proximity) {
@@ -1103,8 +3326,9 @@ ESGeoNames::searchForCityNameFragment(const char *cityNameFragment,
     sharedData->ensureCityData();
     sharedData->ensureCityNames();
     sharedData->ensureNameIndices();
-
-    int numCities = sharedData->numCities();
+    if (proximity) {
+        sharedData->ensurePopulationOrder();
+    }
 
     ESLocation *deviceLocation = ESLocation::deviceLocation();
     float nameSearchCenterLat = deviceLocation->latitudeDegrees();
@@ -1112,32 +3336,32 @@ ESGeoNames::searchForCityNameFragment(const char *cityNameFragment,
 
     //ESTime::noteTimeAtPhaseWithString(ESUtil::stringWithFormat("search for fragment start: '%s'", cityNameFragment));
 
-    if (!_sortedSearchIndices) {
-	_sortedSearchIndices = (ESGeoSortDescriptor *)malloc(numCities * sizeof(ESGeoSortDescriptor));
-    }
+    std::vector<int> matches;
+    sharedData->findCitiesMatchingName(cityNameFragment, NULL, &matches);
+    int airportCity = sharedData->cityIndexForAirportCode(cityNameFragment);
+    ensureSearchCapacity((int)matches.size() + 1);
     _numMatchingCities = 0;
     _numMatchingAtLevel[0] = 0;
     _numMatchingAtLevel[1] = 0;
     _numMatchingAtLevel[2] = 0;
-    bool getEmAll = *cityNameFragment == '\0';
-    const char *cityNamesArray = sharedData->cityNamesArray();
-    const int *nameIndicesArray = sharedData->nameIndicesArray();
+    int numFirst = pinAirportCity(airportCity);
     const ESCityData *cityDataArray = sharedData->cityDataArray();
-    for (int i = 0; i < numCities; i++) {
-	_sortedSearchIndices[i].index = i;
-	const char *searchMe = cityNamesArray + nameIndicesArray[i];
-	if (getEmAll || searchForString(searchMe, cityNameFragment)) {
-	    const ESCityData *data = cityDataArray + i;
-	    _sortedSearchIndices[_numMatchingCities].index = i;
-	    if (proximity) {
-		_sortedSearchIndices[_numMatchingCities++].sortValue = distanceBetweenTwoCoordinates(data->latitude, data->longitude, nameSearchCenterLat, nameSearchCenterLong) / powf(data->population, 2.8);
-	    } else {
-		_sortedSearchIndices[_numMatchingCities++].sortValue = -data->population;
-	    }
+    const float *logPopulations = proximity ? sharedData->logPopulationsArray() : NULL;
+    for (std::vector<int>::const_iterator match = matches.begin(); match != matches.end(); match++) {
+	int i = *match;
+	if (i == airportCity) {
+	    continue;  // Already first
+	}
+	const ESCityData *data = cityDataArray + i;
+	_sortedSearchIndices[_numMatchingCities].index = i;
+	if (proximity) {
+	    _sortedSearchIndices[_numMatchingCities++].sortValue = logf(distanceBetweenTwoCoordinates(data->latitude, data->longitude, nameSearchCenterLat, nameSearchCenterLong)) - 2.8f * logPopulations[i];  // log(distance / population^2.8)
+	} else {
+	    _sortedSearchIndices[_numMatchingCities++].sortValue = -data->population;
 	}
     }
     //ESTime::noteTimeAtPhase("sort search start");
-    qsort(_sortedSearchIndices, _numMatchingCities, sizeof(ESGeoSortDescriptor), comparator);
+    qsort(_sortedSearchIndices + numFirst, _numMatchingCities - numFirst, sizeof(ESGeoSortDescriptor), comparator);
     //ESTime::noteTimeAtPhase("sort search finish");
 }
 
@@ -1176,58 +3400,97 @@ ESGeoNames::validTZ(ESTimeZone *tz,
     return validTZCenteredAt(tzCenterForTZ(tz), offsetHours/*forSlot*/);
 }
 
+// Classify a zone with the given offsets against the slot (slotHour:slotHour+1), where slotHour is in 0..23
+static ESSlotInclusionClass
+inclusionClassForTZDataInSlot(const ESTZData *tzData,
+                              int            slotHour) {
+    short tzCenter = (tzData->stdOffset + tzData->dstOffset) / 2;
+    if (!ESGeoNames::validTZCenteredAt(tzCenter, slotHour/*forSlot*/)) {
+	return notIncluded;
+    }
+    short std = tzData->stdOffset;
+    short dst = tzData->dstOffset;
+    if (std<0) {
+	std += 24*60;
+	dst += 24*60;
+    }
+    if (std == 24*60) {
+	std = 0;
+    }
+    if (dst == 24*60) {
+	dst = 0;
+    }
+    if (std == dst) {
+	// no DST in this zone
+	if ((std % 60) == 0) {
+	    return (slotHour * 60) == std ? normalNoDSTRight : normalNoDSTLeft;
+	} else if ((std % 30) == 0) {
+	    return halfNoDST;
+	}
+	return oddNoDST;
+    } else {
+	ESAssert(dst == (std+60) % (24*60));
+	if ((std % 60) == 0) {
+	    return normalHasDST;
+	} else if ((std % 30) == 0) {
+	    return (slotHour * 60) > std ? halfHasDSTRight : halfHasDSTLeft;
+	}
+	return oddHasDST;
+    }
+}
+
+void
+ESGeoNamesData::setupSlotInclusionClassesForTZ(int tzIndex) {
+    ESAssert(_tzCache);
+    ESAssert(_tzSlotClasses);
+    const ESTZData *tzData = _tzCache->array() + tzIndex;
+    unsigned char *slotClasses = _tzSlotClasses + tzIndex * 24;
+    for (int h = 0; h < 24; h++) {
+        slotClasses[h] = (unsigned char)inclusionClassForTZDataInSlot(tzData, h);
+    }
+}
+
 bool
 ESGeoNamesData::validCity(int cityIndex,
                           int offsetHours) {
-    ensureTZ();
-    ESAssert(_tzIndices);
-    ESAssert(_tzCache);
-    short tzCenter = (_tzCache->array()[_tzIndices->array()[cityIndex]].stdOffset + _tzCache->array()[_tzIndices->array()[cityIndex]].dstOffset) / 2;
-    return ESGeoNames::validTZCenteredAt(tzCenter, offsetHours/*forSlot*/);
+    return inclusionClassForSlotAtOffsetHourForSelectedIndex(cityIndex, offsetHours/*forSlot*/) != notIncluded;
+}
+
+const ESUINT32 *
+ESGeoNamesData::slotCityBitsForOffsetHour(int offsetHours) {
+    ensureSlotCityBits();
+    int slot = ((offsetHours % 24) + 24) % 24;
+    return _slotCityBits + slot * _slotCityBitsWordsPerSlot;
 }
 
 ESSlotInclusionClass 
 ESGeoNamesData::inclusionClassForSlotAtOffsetHourForSelectedIndex(int indx,
                                                                   int offsetHours) {	    // returns a code indicating why city is or isn't in this slot
-    if (cityValidForSlotAtOffsetHourForSelectedIndex(indx, offsetHours)) {
-	short std = _tzCache->array()[_tzIndices->array()[indx]].stdOffset;
-	short dst = _tzCache->array()[_tzIndices->array()[indx]].dstOffset;
-	if (std<0) {
-	    std += 24*60;
-	    dst += 24*60;
-	}
-	if (offsetHours<0) {
-	    offsetHours += 24;
-	}
-	if (std == 24*60) {
-	    std = 0;
-	}
-	if (dst == 24*60) {
-	    dst = 0;
-	}
-	if (offsetHours == 24) {
-	    offsetHours = 0;
-	}
-	if (std == dst) {
-	    // no DST in this zone
-	    if ((std % 60) == 0) {
-		return (offsetHours * 60) == std ? normalNoDSTRight : normalNoDSTLeft;
-	    } else if ((std % 30) == 0) {
-		return halfNoDST;
-	    }
-	    return oddNoDST;
-	} else {
-	    ESAssert(dst == (std+60) % (24*60));
-	    if ((std % 60) == 0) {
-		return normalHasDST;
-	    } else if ((std % 30) == 0) {
-		return (offsetHours * 60) > std ? halfHasDSTRight : halfHasDSTLeft;
-	    }
-	    return oddHasDST;
-	}
-    } else {
+    if (indx < 0) {
 	return notIncluded;
     }
+    ensureTZ();
+    ESAssert(_tzIndices);
+    ESAssert(_tzSlotClasses);
+    int slot = ((offsetHours % 24) + 24) % 24;
+    return (ESSlotInclusionClass)_tzSlotClasses[_tzIndices->array()[indx] * 24 + slot];
+}
+
+void
+ESGeoNamesData::inclusionClassesForSlotAtOffsetHour(const int            *cityIndices,
+                                                    int                  numCityIndices,
+                                                    int                  offsetHours,
+                                                    ESSlotInclusionClass *classesReturn) {
+    ensureTZ();
+    ESAssert(_tzIndices);
+    ESAssert(_tzSlotClasses);
+    int slot = ((offsetHours % 24) + 24) % 24;
+    const short *tzIndices = _tzIndices->array();
+    const unsigned char *slotColumn = _tzSlotClasses + slot;
+    for (int i = 0; i < numCityIndices; i++) {
+        int indx = cityIndices[i];
+        classesReturn[i] = indx < 0 ? notIncluded : (ESSlotInclusionClass)slotColumn[tzIndices[indx] * 24];
+    }
 }
 
 ESSlotInclusionClass
@@ -1236,44 +3499,51 @@ ESGeoNames::selectedCityInclusionClassForSlotAtOffsetHour(int offsetHours) {
     return sharedData->inclusionClassForSlotAtOffsetHourForSelectedIndex(_selectedCityIndex, offsetHours);
 }	 
 
+void
+ESGeoNames::inclusionClassesForCitiesAtSlotOffsetHour(const int            *cityIndices,
+                                                      int                  numCityIndices,
+                                                      int                  offsetHours,
+                                                      ESSlotInclusionClass *classesReturn) {
+    ESAssert(sharedData);
+    sharedData->inclusionClassesForSlotAtOffsetHour(cityIndices, numCityIndices, offsetHours, classesReturn);
+}
+
 void
 ESGeoNames::searchForCityNameFragmentForNominalTZSlot(const char *cityNameFragment,
                                                       int        offsetHours) {
     traceEnter("searchForCityNameFragmentForNominalTZSlot");
-    sharedData->ensureTZ();
     ESAssert(sharedData);
     sharedData->ensureCityData();  // for population, for sorting
     sharedData->ensureCityNames();
     sharedData->ensureNameIndices();
 
-    int numCities = sharedData->numCities();
-
     //ESTime::noteTimeAtPhaseWithString(ESUtil::stringWithFormat("search for fragment start: '%s'", cityNameFragment.c_str()));
 
-    if (!_sortedSearchIndices) {
-	_sortedSearchIndices = (ESGeoSortDescriptor *)malloc(numCities * sizeof(ESGeoSortDescriptor));
+    // Only the cities that fit the slot get the name match
+    const ESUINT32 *slotBits = sharedData->slotCityBitsForOffsetHour(offsetHours/*forSlot*/);
+    std::vector<int> matches;
+    sharedData->findCitiesMatchingName(cityNameFragment, slotBits, &matches);
+    int airportCity = sharedData->cityIndexForAirportCode(cityNameFragment);
+    if (airportCity >= 0 && slotBits && !bitIsSet(slotBits, airportCity)) {
+        airportCity = -1;  // Its city doesn't fit the slot
     }
+    ensureSearchCapacity((int)matches.size() + 1);
     _numMatchingCities = 0;
     _numMatchingAtLevel[0] = 0;
     _numMatchingAtLevel[1] = 0;
     _numMatchingAtLevel[2] = 0;
-    bool getEmAll = *cityNameFragment == '\0';
-    const char *cityNamesArray = sharedData->cityNamesArray();
-    const int *nameIndicesArray = sharedData->nameIndicesArray();
+    int numFirst = pinAirportCity(airportCity);
     const ESCityData *cityDataArray = sharedData->cityDataArray();
-    for (int i = 0; i < numCities; i++) {
-	_sortedSearchIndices[i].index = i;
-	const char *searchMe = cityNamesArray + nameIndicesArray[i];
-	if (getEmAll || searchForString(searchMe, cityNameFragment)) {
-	    if (sharedData->validCity(i, offsetHours/*forSlot*/)) {
-		const ESCityData *data = cityDataArray + i;
-		_sortedSearchIndices[_numMatchingCities].index = i;
-		_sortedSearchIndices[_numMatchingCities++].sortValue = -data->population;
-	    }
-	}
+    for (std::vector<int>::const_iterator match = matches.begin(); match != matches.end(); match++) {
+        if (*match == airportCity) {
+            continue;  // Already first
+        }
+        const ESCityData *data = cityDataArray + *match;
+        _sortedSearchIndices[_numMatchingCities].index = *match;
+        _sortedSearchIndices[_numMatchingCities++].sortValue = -data->population;
     }
     //ESTime::noteTimeAtPhase("sort search start");
-    qsort(_sortedSearchIndices, _numMatchingCities, sizeof(ESGeoSortDescriptor), comparator);
+    qsort(_sortedSearchIndices + numFirst, _numMatchingCities - numFirst, sizeof(ESGeoSortDescriptor), comparator);
     //ESTime::noteTimeAtPhase("sort search finish");
     traceExit("searchForCityNameFragmentForNominalTZSlot");
 }
@@ -1288,8 +3558,7 @@ ESGeoNames::searchForCity(const char *cityName,
     sharedData->ensureCityData();
     sharedData->ensureCityNames();
     sharedData->ensureNameIndices();
-
-    int numCities = sharedData->numCities();
+    sharedData->ensurePopulationOrder();
 
     ESLocation *deviceLocation = ESLocation::deviceLocation();
     float nameSearchCenterLat = deviceLocation->latitudeDegrees();
@@ -1302,31 +3571,29 @@ ESGeoNames::searchForCity(const char *cityName,
 
     ESAssert(cityName && *cityName);  // nonempty
     
-    if (!_sortedSearchIndices) {
-	_sortedSearchIndices = (ESGeoSortDescriptor *)malloc(numCities * sizeof(ESGeoSortDescriptor));
-    }
+    std::vector<int> matches;
+    sharedData->findCitiesMatchingName(cityName, NULL, &matches);
+    ensureSearchCapacity((int)matches.size());
+    ESGeoNamesRegionQuery regionQuery;
+    sharedData->resolveRegionQuery(state, country, code, &regionQuery);
 
     int confidenceLevel = -1;
     _numMatchingCities = 0;
     _numMatchingAtLevel[0] = 0;
     _numMatchingAtLevel[1] = 0;
     _numMatchingAtLevel[2] = 0;
-    const char *cityNamesArray = sharedData->cityNamesArray();
-    const int *nameIndicesArray = sharedData->nameIndicesArray();
     const ESCityData *cityDataArray = sharedData->cityDataArray();
-    for (int i = 0; i < numCities; i++) {
-	_sortedSearchIndices[i].index = i;
-	const char *searchMe = cityNamesArray + nameIndicesArray[i];
-	if (searchForString(searchMe, cityName)) {
-	    const ESCityData *data = cityDataArray + i;
-	    _sortedSearchIndices[_numMatchingCities].index = i;
-	    _sortedSearchIndices[_numMatchingCities].sortValue  = distanceBetweenTwoCoordinates(data->latitude, data->longitude, nameSearchCenterLat, nameSearchCenterLong) / powf(data->population, 2.8);
-	    int conf = sharedData->regionMatchConfidenceForIndex(i, state, country, code);
-	    _sortedSearchIndices[_numMatchingCities].sortValue2 = conf;
-	    confidenceLevel = fmax(confidenceLevel, conf);
-	    _numMatchingCities++;
-	    _numMatchingAtLevel[conf]++;
-	}
+    const float *logPopulations = sharedData->logPopulationsArray();
+    for (std::vector<int>::const_iterator match = matches.begin(); match != matches.end(); match++) {
+	int i = *match;
+	const ESCityData *data = cityDataArray + i;
+	_sortedSearchIndices[_numMatchingCities].index = i;
+	_sortedSearchIndices[_numMatchingCities].sortValue  = logf(distanceBetweenTwoCoordinates(data->latitude, data->longitude, nameSearchCenterLat, nameSearchCenterLong)) - 2.8f * logPopulations[i];  // log(distance / population^2.8)
+	int conf = sharedData->regionMatchConfidenceForIndex(i, regionQuery);
+	_sortedSearchIndices[_numMatchingCities].sortValue2 = conf;
+	confidenceLevel = fmax(confidenceLevel, conf);
+	_numMatchingCities++;
+	_numMatchingAtLevel[conf]++;
     }
     //tracePrintf1("sort search2 start %d matches", _numMatchingCities);
     qsort(_sortedSearchIndices, _numMatchingCities, sizeof(ESGeoSortDescriptor), comparator2);
@@ -1334,6 +3601,31 @@ ESGeoNames::searchForCity(const char *cityName,
     return confidenceLevel;
 }
 
+// The descriptors need only hold this search's matches.  We keep the largest buffer needed so far, since typing more
+// of a name only narrows the next search.
+void
+ESGeoNames::ensureSearchCapacity(int numMatches) {
+    if (!_sortedSearchIndices || numMatches > _sortedSearchCapacity) {
+        checkFreeMallocArray((void**)&_sortedSearchIndices);
+        _sortedSearchCapacity = numMatches > 0 ? numMatches : 1;
+        _sortedSearchIndices = (ESGeoSortDescriptor *)malloc(_sortedSearchCapacity * sizeof(ESGeoSortDescriptor));
+    }
+}
+
+// Puts the city an airport code found first in the (just cleared) search results, where the sort won't move it,
+// and returns the number of results so placed
+int
+ESGeoNames::pinAirportCity(int airportCity) {
+    if (airportCity < 0) {
+        return 0;
+    }
+    ESAssert(_numMatchingCities == 0 && _sortedSearchCapacity > 0);
+    _sortedSearchIndices[0].index = airportCity;
+    _sortedSearchIndices[0].sortValue = 0;
+    _numMatchingCities = 1;
+    return 1;
+}
+
 void
 ESGeoNames::clearSelection() {
     _selectedCityIndex = -1;
@@ -1342,6 +3634,7 @@ ESGeoNames::clearSelection() {
     _numMatchingAtLevel[1] = 0;
     _numMatchingAtLevel[2] = 0;
     checkFreeMallocArray((void**)&_sortedSearchIndices);
+    _sortedSearchCapacity = 0;
 }
 
 void
@@ -1378,3 +3671,23 @@ ESGeoNames::numMatchesAtLevel(int level) {
     return _numMatchingAtLevel[level];
 }
 
+int
+ESGeoNames::getSearchResults(int                    first,
+                             int                    count,
+                             ESGeoNamesSearchResult *resultsReturn,
+                             std::vector<char>      *textReturn) {
+    ESAssert(sharedData);
+    ESAssert(first >= 0);
+    int numResults = std::min(count, _numMatchingCities - first);
+    if (numResults <= 0) {
+        textReturn->clear();
+        return 0;
+    }
+    std::vector<int> cityIndices(numResults);
+    for (int r = 0; r < numResults; r++) {
+        cityIndices[r] = _sortedSearchIndices[first + r].index;
+    }
+    sharedData->fillSearchResults(&cityIndices[0], numResults, resultsReturn, textReturn);
+    return numResults;
+}
+
@@ -7,13 +7,22 @@
 //
 
 #include "ESCalendar.hpp"  // For opaque ESTimeZone
+#include "ESFile.hpp"      // For ESFilePathType
 
 #include <string>
+#include <vector>
+
+#define ES_GEONAMES_NAME_BUFFER_SIZE 256       // Decoded compound name, plus slop for the decoder (see data/compressNames.pl)
+#define ES_GEONAMES_SYMBOL_TABLE_SIZE (256 * 9)  // Symbols and lengths at the start of loc-names-fsst.dat
 
 // Opaque types
 struct ESCityData;
+struct ESGeoNamesCellCache;
+struct ESGeoNamesGridVisitor;
+struct ESGeoNamesOverlay;
 struct ESGeoSortDescriptor;
 struct ESRegionDesc;
+struct ESWideRegionDesc;
 struct ESTimeZoneRange;
 template<class ElementType> class ESFileArray;
 
@@ -37,10 +46,65 @@ typedef struct _ESTZData {
     // NOTE: The following two fields are new June 2017, thus invalidating any old cached data.  But the current code never
     // attempts to read the cache, so all should be well.
     // NOTE FURTHER:  If we ever *do* cache this, these fields will *still* not be valid unless we are still before nextTransition.
+    // (In memory, ESGeoNamesData::ensureTZ recomputes any entry whose nextTransition has passed.)
     short                   currentOffset;
     ESTimeInterval          nextTransition;
 } ESTZData;
 
+// The arrays ESGeoNamesData loads lazily, each guarded by its own lock
+typedef enum _ESGeoNamesArray {
+    ESGeoNamesCityData,
+    ESGeoNamesCityNames,
+    ESGeoNamesNameIndices,
+    ESGeoNamesRegions,
+    ESGeoNamesRegionDescs,
+    ESGeoNamesCCNames,
+    ESGeoNamesCCCodes,
+    ESGeoNamesA1Names,
+    ESGeoNamesA2Names,
+    ESGeoNamesA1Codes,
+    ESGeoNamesTZ,                // tzIndices, tzNames, tzCache, tzSlotClasses
+    ESGeoNamesSlotCityBits,      // Must follow ESGeoNamesTZ (lock order)
+    ESGeoNamesPopulationOrder,   // populationOrder and logPopulations, derived from cityData
+    ESGeoNamesTZRaster,          // tzRaster
+    ESGeoNamesCCRaster,          // ccRaster
+    ESGeoNamesCityGrid,          // cityGridStarts and cityGridCities, derived from cityData
+    ESGeoNamesAirports,          // airports
+    ESGeoNamesNumArrays
+} ESGeoNamesArray;
+
+// The GeoNames city sets we can be built from (see data/buildLocData.cpp).  Each lives in its own directory of loc-*.dat
+// files under the eslocation resource directory, except the default one, which is the eslocation directory itself.
+typedef enum _ESGeoNamesDataset {
+    ESGeoNamesDatasetCities1000,     // The set we ship:  every city over 1000 people (roughly 90K)
+    ESGeoNamesDatasetCities500,      // eslocation/cities500
+    ESGeoNamesDatasetCities5000,     // eslocation/cities5000
+    ESGeoNamesDatasetCities15000,    // eslocation/cities15000, for the watch
+    ESGeoNamesDatasetAllCountries,   // eslocation/allCountries:  every populated place (millions), for servers
+    ESGeoNamesNumDatasets
+} ESGeoNamesDataset;
+
+// The state, country and country code given to ESGeoNames::searchForCity, resolved once for all the cities it matches
+struct ESGeoNamesRegionQuery {
+    const char              *state;
+    bool                    hasCountry;         // A code or country was given, so only cities in one of ccIndices can match
+    int                     ccIndices[2];       // Of the code, and of the country (a code, name or alias like "USA"); -1 if not given or not found
+    int                     stateA1Indices[2];  // Of the state as an admin1 code ("CA") in each of those countries, or -1
+};
+
+// One row of search results, as filled in by ESGeoNames::getSearchResults.  The strings are views into the text
+// vector passed with it, good until that vector is next changed; rows with the same region or zone share its string.
+struct ESGeoNamesSearchResult {
+    int                     cityIndex;          // As selectedCityIndex
+    const char              *name;              // As selectedCityName
+    const char              *regionName;        // As selectedCityRegionName
+    const char              *tzName;            // As selectedCityTZName
+    float                   latitude;
+    float                   longitude;
+    unsigned long           population;
+    char                    countryCode[3];     // As selectedCityCountryCode, null-terminated
+};
+
 // An object of this class is shared amongst all active ESGeoNames objects to save load time when multiple modules are started at once
 // that each use location
 class ESGeoNamesData {
@@ -60,21 +124,49 @@ class ESGeoNamesData {
     void                    ensureA2Names();
     void                    ensureA1Codes();
     void                    ensureTZ();
+    void                    ensurePopulationOrder();
+    void                    ensureTZRaster();
+    void                    ensureCCRaster();
+    void                    ensureCityGrid();
+    void                    ensureAirports();
+    void                    ensureArray(ESGeoNamesArray which);
 
-    const char              *cityNamesArray();
+    size_t                  bytesInUse();                       // approximate bytes held by loaded arrays
+    size_t                  trimToBudget(size_t budgetBytes);   // evict LRU evictable arrays; main thread only; returns bytesInUse()
+
+    const char              *decodeNameAtNameIndex(int  nameIndex,
+                                                   char *buffer);  // buffer must hold ES_GEONAMES_NAME_BUFFER_SIZE; returns buffer
     const ESINT32           *nameIndicesArray();
     const ESCityData        *cityDataArray();
+    const float             *logPopulationsArray();   // log(population), 1 per city; call ensurePopulationOrder first
     int                     numCities() { return _numCities; }
+    void                    findCitiesMatchingName(const char       *nameFragment,   // "" matches every city
+                                                   const ESUINT32   *onlyCityBits,   // if not NULL, consider only the cities whose bit is set
+                                                   std::vector<int> *matchesReturn); // in index order; call ensureCityNames and ensureNameIndices first
+    void                    findCitiesMatchingNameInRange(const char       *nameFragment,
+                                                          const ESUINT32   *onlyCityBits,
+                                                          int              firstCity,
+                                                          int              endCity,
+                                                          std::vector<int> *matchesReturn);  // one chunk of the above
 
+    int                     cityIndexForAirportCode(const char *fragment);  // the city an IATA code ("SFO", in any case) serves, or -1 if fragment isn't one we know
     int                     findClosestCityToLatitudeDegrees(float latitudeDegrees,
-                                                             float longitudeDegrees);
+                                                             float longitudeDegrees,
+                                                             float *stableRadiusKmReturn = NULL);
     int                     findBestMatchCityToLatitudeDegrees(float latitudeDegrees,
                                                                float longitudeDegrees);	// factors in population, too
     int                     findBestCityForTZName(const std::string &tzName);
+    int                     tzIndexForLatitudeDegrees(float latitudeDegrees,
+                                                      float longitudeDegrees);  // that of the closest city, from the raster where that's certain; -1 if no city
 
     std::string             cityNameForSelectedIndex(int indx);
     std::string             cityRegionNameForSelectedIndex(int indx);
     std::string             cityTZNameForSelectedIndex(int indx);
+    std::string             tzNameForTZIndex(int tzIndex);
+    std::string             rasterCountryCodeForLatitudeDegrees(float latitudeDegrees,
+                                                                float longitudeDegrees);  // "" where the raster isn't sure
+    std::string             countryCodeForLatitudeDegrees(float latitudeDegrees,
+                                                          float longitudeDegrees);  // that of the closest city
     float                   cityLatitudeForSelectedIndex(int indx);
     float                   cityLongitudeForSelectedIndex(int indx);
     unsigned long           cityPopulationForSelectedIndex(int indx);
@@ -82,15 +174,26 @@ class ESGeoNamesData {
                                                                          int offsetHours);   // returns true iff city can fit in slot for (offsetHours:offsetHours+1)
     ESSlotInclusionClass    inclusionClassForSlotAtOffsetHourForSelectedIndex(int indx,
                                                                               int offsetHours);	    // returns a code indicating why city is or isn't in this slot
+    void                    inclusionClassesForSlotAtOffsetHour(const int            *cityIndices,
+                                                                int                  numCityIndices,
+                                                                int                  offsetHours,
+                                                                ESSlotInclusionClass *classesReturn);  // batch form of the above
     std::string             cityCountryCodeForSelectedIndex(int indx);
+    void                    fillSearchResults(const int              *cityIndices,
+                                              int                    numCities,
+                                              ESGeoNamesSearchResult *resultsReturn,  // numCities of them
+                                              std::vector<char>      *textReturn);    // replaced with the strings they point to
     
     bool                    validCity(int cityIndex,
                                       int offsetHours);
+    const ESUINT32          *slotCityBitsForOffsetHour(int offsetHours);  // bitset, one bit per city, set iff validCity(city, offsetHours)
 
-    int                     regionMatchConfidenceForIndex(int         cityIndex,
-                                                          const char *state,
-                                                          const char *country,
-                                                          const char *code);
+    void                    resolveRegionQuery(const char            *state,
+                                               const char            *country,
+                                               const char            *code,
+                                               ESGeoNamesRegionQuery *queryReturn);
+    int                     regionMatchConfidenceForIndex(int                         cityIndex,
+                                                          const ESGeoNamesRegionQuery &query);
 
 // Use this to clear storage when exiting location picker or destroying the last ESGeoNames
     void                    clearStorage();
@@ -111,6 +214,38 @@ class ESGeoNamesData {
     void                    readA1Codes();
     void                    readTZ();
     void                    setupTimezoneRangeTable();
+    void                    refreshExpiredTimezones(ESTimeInterval now);
+    void                    setupSlotInclusionClassesForTZ(int tzIndex);
+    void                    setupSlotCityBits();
+    void                    ensureSlotCityBits();
+    void                    setupPopulationOrder();
+    void                    readTZRaster();
+    void                    readCCRaster();
+    void                    setupCityGrid();
+    void                    readAirports();
+    int                     ccIndexForCountry(const char *country);  // code, name or alias; call ensureCCCodes first
+    int                     a1IndexForCode(const char *a1Code);      // "CC.A1"; call ensureA1Codes first
+    int                     tzIndexForName(const char *tzName);      // call ensureTZ first
+    int                     regionIndexBytes();
+    ESGeoNamesOverlay       *overlay();
+    const ESUINT32          *suppressedCityBits();
+    int                     regionIndexForCity(int cityIndex);
+    std::string             regionNameForRegionDesc(const ESWideRegionDesc &regionDesc);  // "a2, a1, country", leaving out any that are empty
+    void                    regionDescAtIndex(int              regionIndex,
+                                              ESWideRegionDesc *descReturn);
+    int                     readRegionIndexFromFile(int cityIndex);         // as regionIndexForCity, without loading loc-region.dat
+    void                    readRegionDescFromFile(int              regionIndex,
+                                                   ESWideRegionDesc *descReturn);  // as regionDescAtIndex, without loading loc-regiondesc.dat
+    void                    visitCityGrid(float                 latitudeDegrees,
+                                          float                 longitudeDegrees,
+                                          ESGeoNamesGridVisitor *visitor);
+    void                    findCandidatesForCell(int              latCell,
+                                                  int              longCell,
+                                                  std::vector<int> *candidates,
+                                                  float            *nonCandidateMinKm);
+    void                    clearClosestCityCache();
+    void                    noteArrayUse(ESGeoNamesArray which);
+    void                    evictArray(ESGeoNamesArray which);
     bool                    cityAtIndexIsOlsonCity(int index);
     std::string             getDisplayNameAtNameIndex(int nameIndex);
 #ifndef NDEBUG
@@ -121,37 +256,79 @@ class ESGeoNamesData {
     ESFileStringArray       *tzNames();
 #endif
 
-    ESFileArray<char>       *_cityNames;         // String, 1 per city, delimited by NULL characters.  Each name has 1+ components separated
+    ESFileArray<unsigned char> *_cityNames;      // String, 1 per city, compressed (see decodeNameAtNameIndex).  Each name has 1+ components separated
                                                 //   by '+':  First the ascii search name, then any alternate names ("Munich"), then the display name in full UTF8 if it's different.
-                                                //   Loaded from loc-names.txt
-    ESFileArray<ESINT32>    *_nameIndices;       // Index,  1 per city, packed, indicating position of city within cityNames.  Loaded from loc-index.dat
+                                                //   Loaded from loc-names-fsst.dat, which data/compressNames.pl makes from loc-names.dat
+    ESFileArray<ESINT32>    *_nameIndices;       // Index,  1 per city, packed, indicating position of city within cityNames.  Loaded from loc-index-fsst.dat
     ESFileArray<ESCityData> *_cityData;          // Pop/lat/long, 1 per city, packed.  Loaded from loc-data.dat
-    ESFileArray<short>      *_cityRegions;       // Region index, 1 per city, packed.  Loaded from loc-region.dat
+    ESFileArray<short>      *_cityRegions;       // Region index, 1 per city, packed.  Loaded from loc-region.dat (32 bits each if _regionIndexBytes is 4)
     ESFileArray<ESRegionDesc> *_regionDescs;       // Region descriptors, one per unique region index, packed.  Loaded from loc-regionDesc.dat
+                                                //   (ESWideRegionDescs if _regionIndexBytes is 4)
+    int                     _regionIndexBytes;   // 2, or 4 for a dataset with too many regions for a short (see loc-regionIndexBytes.dat); 0 until read
     ESFileStringArray       *_ccNames;           // Country names based on ESRegionDesc cc index.  Loaded from loc-cc.dat
     ESFileArray<short>      *_ccCodes;           // Two-character country *codes* (e.g., US) based on ESRegionDesc cc index.  Loaded from loc-ccCodes.dat
+    bool                    _ccCodesHashed;      // _ccCodes is what ESGeoNamesHashTables.hpp was made from, so its tables can find codes, names and aliases
     ESFileStringArray       *_a1Names;           // Admin1 names based on ESRegionDesc a1 index.  Loaded from loc-a1.dat
     ESFileStringArray       *_a2Names;           // Admin2 names based on ESRegionDesc a2 index.  Loaded from loc-a2.dat
     ESFileStringArray       *_a1Codes;           // Admin1 *codes* (e.g., US.CA) based on ESRegionDesc a1 index.  Loaded from loc-a1Codes.dat
+    bool                    _a1CodesHashed;      // Likewise for _a1Codes
     ESFileArray<short>      *_tzIndices;         // Time zone index, 1 per city.  Loaded from loc-tz.dat
     ESFileStringArray       *_tzNames;           // Name of time zone, delimited by NULL, for each unique time zone index.  Loaded from loc-tzNames.dat
     unsigned int            _tzNamesChecksum;    // Checksum of tzNames array in use (can be used as version id)
+    bool                    _tzNamesHashed;      // Likewise for _tzNames (by its checksum)
     ESFileArray<ESTZData>   *_tzCache;           // Center of offset of time zone in minutes, for each unique time zone index.  Calculated by instantiating time zones.
+    ESFileArray<ESTZData>   *_tzCacheSpare;      // Previous copy of _tzCache, rewritten and swapped in by refreshExpiredTimezones
+    ESTimeInterval          _tzCacheExpiration;  // Earliest nextTransition in _tzCache (0 if no zone has one); entries past it are refreshed on next ensureTZ
+    unsigned char           *_tzSlotClasses;     // ESSlotInclusionClass for each (unique time zone index, slot hour 0-23) pair, 24 per zone.  Built with _tzCache.
+    ESUINT32                *_slotCityBits;      // 24 bitsets (one per nominal slot hour) of _numCities bits each, set iff the city fits the slot.  Derived from _tzCache.
+    ESUINT32                *_slotCityBitsSpare; // Previous _slotCityBits, kept until the next rebuild in case a search is still walking it
+    int                     _slotCityBitsWordsPerSlot;  // Number of ESUINT32 words in each of the 24 bitsets in _slotCityBits
+    int                     *_populationOrder;   // City indices in descending order of population (ties in index order)
+    float                   *_logPopulations;    // log(population), 1 per city
+    ESFileArray<unsigned short> *_tzRaster;      // Time zone index for each cell of a grid over the globe, in blocks.  Loaded from loc-tzRaster.dat
+                                                //   (see data/makeRasters.pl for the layout)
+    bool                    _tzRasterUsable;     // _tzRaster was read and was made from the tzNames we have
+    ESFileArray<unsigned char> *_ccRaster;       // Country for each cell of a grid over the globe, run-length encoded by row, with its own
+                                                //   table of country codes.  Loaded from loc-ccRaster.dat (see data/makeRasters.pl for the layout)
+    bool                    _ccRasterUsable;     // _ccRaster was read and its sizes are consistent
+    int                     *_cityGridStarts;    // For each cell of a grid over the globe, row by row from the south, the index in _cityGridCities
+                                                //   of its first city (plus one more entry, for the end of the last cell)
+    int                     *_cityGridCities;    // City indices, grouped by grid cell, in index order within each cell
+    float                   _cityGridDegrees;    // Size of a grid cell, chosen to leave only a handful of cities per cell
+    int                     _cityGridRows;
+    int                     _cityGridColumns;
+    ESFileArray<ESUINT32>   *_airports;          // Perfect-hash table from IATA airport code to the index of the city the airport serves.
+                                                //   Loaded from loc-airports.dat (see makeAirports in data/buildLocData.cpp for the layout)
+    bool                    _airportsUsable;     // _airports was read and was made for the cities we have
+    ESGeoNamesCellCache     *_closestCityCache;  // Candidate closest cities for recently queried grid cells; has its own lock
     int                     _numCities;          // Count of nameIndices, cityData, regionIndices, etc. arrays
     int                     _numRegionDescs;     // Count of regionDescs array
+    ESGeoNamesOverlay       *_overlay;           // Corrections to the dataset, applied to each per-city array as it's loaded; NULL if none.
+                                                //   Loaded from loc-overlay.dat, or the file given to ESGeoNames::setOverlayPath
+    bool                    _overlayRead;        // We've looked for the overlay (which happens on the first per-city array load)
+    size_t                  _arrayBytes[ESGeoNamesNumArrays];     // Approximate bytes held by each array (0 if not loaded)
+    unsigned int            _arrayLastUse[ESGeoNamesNumArrays];   // Value of _useTick when each array was last ensured
+    unsigned int            _useTick;            // Incremented on every ensureXXX, for LRU eviction
 };
 
 class ESGeoNames {
   public:
-                            ESGeoNames();
+                            ESGeoNames(bool prefetchInBackground = false);  // if true, start loading the search data on worker threads now
                             ~ESGeoNames();
 
 // Call findClosest first, then you can use the access methods to return the last found city
     void                    findClosestCityToLatitudeDegrees(float latitudeDegrees,
-                                                             float longitudeDegrees);
+                                                             float longitudeDegrees,
+                                                             float *stableRadiusKmReturn = NULL);  // how far the point can move and still have the same answer
     void                    findBestMatchCityToLatitudeDegrees(float latitudeDegrees,
                                                                float longitudeDegrees);	// factors in population, too
     bool                    findBestCityForTZName(const std::string tzName);
+    std::string             tzNameForLatitudeDegrees(float latitudeDegrees,
+                                                     float longitudeDegrees);  // time zone of the closest city, without a search in most places; doesn't change the selection
+    std::string             countryCodeForLatitudeDegrees(float latitudeDegrees,
+                                                          float longitudeDegrees);  // country code of the closest city, likewise
+    std::string             rasterCountryCodeForLatitudeDegrees(float latitudeDegrees,
+                                                                float longitudeDegrees);  // the same, but only loads loc-ccRaster.dat, and returns "" near borders
     std::string             selectedCityName();		// returns last found city
     std::string             selectedCityRegionName();	// returns last found city's region info
     std::string             selectedCityTZName();	// returns last found city tz name
@@ -160,9 +337,14 @@ class ESGeoNames {
     unsigned long           selectedCityPopulation();	// returns last found city's population
     bool                    selectedCityValidForSlotAtOffsetHour(int offsetHours);   // returns true iff last found city can fit in slot for (offsetHours:offsetHours+1)
     ESSlotInclusionClass    selectedCityInclusionClassForSlotAtOffsetHour(int offsetHours);	    // returns a code indicating why city is or isn't in this slot
+    void                    inclusionClassesForCitiesAtSlotOffsetHour(const int            *cityIndices,   // raw indices, as in selectCityWithIndex
+                                                                      int                  numCityIndices,
+                                                                      int                  offsetHours,
+                                                                      ESSlotInclusionClass *classesReturn);  // one class per city, as selectedCityInclusionClassForSlotAtOffsetHour
     std::string             selectedCityCountryCode();
     
-// Sort top N cities first, then retrieve each one's name
+// Sort top N cities first, then retrieve each one's name.  A fragment that is exactly an airport code we know ("SFO")
+// puts the airport's city first, ahead of the name matches.
     void                    searchForCityNameFragmentForNominalTZSlot(const char *cityNameFragment,
                                                                       int        offsetHours);
     void                    searchForCityNameFragment(const char *cityNameFragment,
@@ -172,24 +354,53 @@ class ESGeoNames {
                                           const char *country,
                                           const char *code);
     void                    selectCityWithIndex(int index);     // raw index, without search
+    int                     selectedCityIndex() { return _selectedCityIndex; }  // raw index, as passed to selectCityWithIndex
     std::string             topCityNameAtIndex(int index);	// after search
     void                    selectNthTopCity(int index);		// after search; then after calling this you can use *selected* methods above
     int                     numMatches();				// after search; number of matching city entries
     int                     numMatchesAtLevel(int level);		// after qualified search; number of matching city entries with confidence level
+    int                     getSearchResults(int                    first,
+                                             int                    count,
+                                             ESGeoNamesSearchResult *resultsReturn,  // count of them
+                                             std::vector<char>      *textReturn);    // after search; fills the rows for matches first to first + count - 1
+                                                                                     //   (or the last match), as selectNthTopCity and the selected* methods
+                                                                                     //   would give them, with the lookups they share done once.  Returns the
+                                                                                     //   number of rows filled; doesn't change the selection
 
 // revert to pre-search state
     void                    clearSelection();
 
+// Memory management for the shared data (main thread only).  Arrays evicted here are reloaded when next needed.  So,
+// since they read evictable arrays without holding their locks, the search methods and the selected* methods other
+// than selectedCityCountryCode are main thread only too; the *ForLatitudeDegrees lookups may be used from any thread.
+    static void             setMemoryBudget(size_t budgetBytes);    // 0 => no budget (the default); trims immediately
+    static size_t           trimToBudget();                          // call from low-memory callbacks; returns bytes still in use
+    static size_t           trimToBytes(size_t budgetBytes);         // one-off trim to the given size, e.g., 0 on a critical warning
+    static size_t           bytesInUse();
+
+// Which GeoNames set to load.  Main thread only, and only while there are no ESGeoNames objects.
+    static void             setDataset(ESGeoNamesDataset dataset);
+    static ESGeoNamesDataset dataset();
+
+// Corrections to apply to the dataset as it loads (see buildLocData -overlay), e.g., downloaded to the app support directory.
+// By default, the dataset's own loc-overlay.dat, if it has one; a NULL path restores that.  Likewise only while there are
+// no ESGeoNames objects.
+    static void             setOverlayPath(const char     *path,
+                                           ESFilePathType pathType);
+
     static bool             validTZ(ESTimeZone *tz,
                                     int        offsetHours);
     static bool             validTZCenteredAt(short tzCenter,
                                               int   offsetHours);
     static short            tzCenterForTZ(ESTimeZone *tz);
   private:
-    
+    void                    ensureSearchCapacity(int numMatches);
+    int                     pinAirportCity(int airportCity);
+
     int                     _selectedCityIndex;  // Index of city currently selected either by findClosestCityToLatitudeDegrees or selectNthTopCity
 
     ESGeoSortDescriptor     *_sortedSearchIndices;   // Sort descriptor (index + sort value) for each name matched by searchForCityNameFragment
+    int                     _sortedSearchCapacity;   // Number of descriptors allocated in _sortedSearchIndices; grows to the most matches seen
     int                     _numMatchingCities;      // Number of matching cities in sortedSearchIndices
     int			    _numMatchingAtLevel[3];	// Number of matching cities in sortedSearchIndices at each confidence level
 };
@@ -0,0 +1,4303 @@
+//
+//  ESGeoNamesHashTables.hpp
+//
+//  Generated by data/buildLocData -hashHeader from the loc-*.dat files; don't edit.
+//  Copyright Emerald Sequoia LLC 2011. All rights reserved.
+//
+
+// Minimal perfect-hash tables from key to index in the loc-*.dat files whose loc-tzNames.dat has the checksum
+// below (see makeHashHeader in data/buildLocData.cpp).  ESGeoNamesData checks each table against the files it
+// loads, and falls back to a linear scan for any that don't match.  Include only in ESGeoNames.cpp.
+
+#ifndef _ESGEONAMESHASHTABLES_HPP_
+#define _ESGEONAMESHASHTABLES_HPP_
+
+#define ES_GEONAMES_HASHED_TZ_NAMES_CHECKSUM 3961994294U
+#define ES_GEONAMES_HASHED_NUM_TZ_NAMES 360
+#define ES_GEONAMES_HASHED_NUM_CC_CODES 238
+#define ES_GEONAMES_HASHED_NUM_A1_CODES 3269
+
+struct ESGeoNamesHashEntry {
+    const char              *key;
+    int                     index;
+};
+
+struct ESGeoNamesHashTable {
+    int                     numEntries;
+    int                     numBuckets;
+    const unsigned short    *displacements;  // One per bucket
+    const ESGeoNamesHashEntry *entries;       // In slot order
+};
+
+// Country codes (loc-ccCodes.dat):  238
+static const unsigned short esGeoNamesCCCodeDisplacements[120] = {
+    1, 0, 1, 6, 4, 18, 7, 4, 1, 2, 8, 1, 19, 10, 2, 1,
+    4, 41, 1, 5, 7, 3, 2, 13, 2, 6, 8, 0, 1, 6, 19, 5,
+    3, 4, 1, 5, 15, 0, 2, 2, 15, 0, 2, 2, 16, 2, 4, 12,
+    2, 0, 2, 17, 4, 1, 32, 37, 6, 1, 13, 5, 33, 12, 67, 12,
+    30, 3, 2, 2, 37, 0, 4, 1, 22, 54, 0, 5, 2, 0, 0, 32,
+    24, 1, 13, 28, 1, 11, 8, 0, 5, 33, 0, 0, 0, 5, 11, 17,
+    18, 12, 65, 4, 65, 5, 32, 4, 1, 1, 29, 2, 36, 1, 12, 0,
+    66, 0, 9, 6, 39, 9, 5, 29,
+};
+static const ESGeoNamesHashEntry esGeoNamesCCCodeEntries[238] = {
+    { "DM", 55 },
+    { "TR", 214 },
+    { "PR", 174 },
+    { "TN", 212 },
+    { "SO", 198 },
+    { "CF", 37 },
+    { "ML", 138 },
+    { "VE", 226 },
+    { "GP", 82 },
+    { "MP", 142 },
+    { "CG", 38 },
+    { "HK", 90 },
+    { "SL", 195 },
+    { "MG", 135 },
+    { "GS", 85 },
+    { "KI", 111 },
+    { "HR", 92 },
+    { "DK", 54 },
+    { "TD", 205 },
+    { "GU", 87 },
+    { "AQ", 9 },
+    { "MV", 148 },
+    { "LT", 126 },
+    { "SK", 194 },
+    { "AS", 11 },
+    { "BN", 27 },
+    { "AE", 1 },
+    { "KG", 109 },
+    { "PF", 167 },
+    { "ST", 200 },
+    { "KH", 110 },
+    { "BA", 16 },
+    { "MW", 149 },
+    { "FK", 67 },
+    { "LR", 124 },
+    { "CU", 47 },
+    { "GD", 73 },
+    { "LU", 127 },
+    { "RW", 184 },
+    { "WF", 231 },
+    { "GT", 86 },
+    { "GQ", 83 },
+    { "EE", 59 },
+    { "RU", 183 },
+    { "CN", 44 },
+    { "LA", 119 },
+    { "KP", 114 },
+    { "EG", 60 },
+    { "GY", 89 },
+    { "NI", 158 },
+    { "IL", 97 },
+    { "CL", 42 },
+    { "DE", 52 },
+    { "NF", 156 },
+    { "US", 221 },
+    { "MA", 130 },
+    { "BO", 28 },
+    { "FJ", 66 },
+    { "HT", 93 },
+    { "ZW", 237 },
+    { "VA", 224 },
+    { "SJ", 193 },
+    { "PT", 176 },
+    { "MZ", 152 },
+    { "GI", 78 },
+    { "JE", 104 },
+    { "NZ", 163 },
+    { "VU", 230 },
+    { "YE", 233 },
+    { "LS", 125 },
+    { "JP", 107 },
+    { "FM", 68 },
+    { "PH", 169 },
+    { "AL", 5 },
+    { "UZ", 223 },
+    { "BE", 19 },
+    { "GF", 75 },
+    { "BY", 33 },
+    { "AM", 6 },
+    { "KR", 115 },
+    { "BZ", 34 },
+    { "GH", 77 },
+    { "KW", 116 },
+    { "PY", 178 },
+    { "MS", 145 },
+    { "MQ", 143 },
+    { "MX", 150 },
+    { "HN", 91 },
+    { "JO", 106 },
+    { "AG", 3 },
+    { "BT", 31 },
+    { "CV", 48 },
+    { "PE", 166 },
+    { "ME", 133 },
+    { "SB", 186 },
+    { "TW", 217 },
+    { "UY", 222 },
+    { "KY", 117 },
+    { "TC", 204 },
+    { "BH", 22 },
+    { "WS", 232 },
+    { "HU", 94 },
+    { "BR", 29 },
+    { "BS", 30 },
+    { "CR", 46 },
+    { "FI", 65 },
+    { "CZ", 51 },
+    { "LB", 120 },
+    { "MM", 139 },
+    { "GB", 72 },
+    { "GL", 79 },
+    { "JM", 105 },
+    { "PS", 175 },
+    { "TJ", 209 },
+    { "AO", 8 },
+    { "LI", 122 },
+    { "CM", 43 },
+    { "MT", 146 },
+    { "MY", 151 },
+    { "TM", 211 },
+    { "DJ", 53 },
+    { "NE", 155 },
+    { "ID", 95 },
+    { "GW", 88 },
+    { "AU", 13 },
+    { "NL", 159 },
+    { "IT", 103 },
+    { "MU", 147 },
+    { "LK", 123 },
+    { "AZ", 15 },
+    { "PA", 165 },
+    { "MH", 136 },
+    { "SC", 187 },
+    { "GE", 74 },
+    { "LC", 121 },
+    { "KZ", 118 },
+    { "UA", 219 },
+    { "NA", 153 },
+    { "PK", 170 },
+    { "PG", 168 },
+    { "TT", 215 },
+    { "MR", 144 },
+    { "TL", 210 },
+    { "FR", 70 },
+    { "TH", 208 },
+    { "NO", 160 },
+    { "MO", 141 },
+    { "OM", 164 },
+    { "EC", 58 },
+    { "NU", 162 },
+    { "BM", 26 },
+    { "IN", 99 },
+    { "NC", 154 },
+    { "FO", 69 },
+    { "LV", 128 },
+    { "NG", 157 },
+    { "CK", 41 },
+    { "BJ", 24 },
+    { "RO", 181 },
+    { "TO", 213 },
+    { "MD", 132 },
+    { "BG", 21 },
+    { "GG", 76 },
+    { "AT", 12 },
+    { "KE", 108 },
+    { "YT", 234 },
+    { "SN", 197 },
+    { "IQ", 100 },
+    { "GA", 71 },
+    { "CY", 50 },
+    { "QA", 179 },
+    { "TZ", 218 },
+    { "AI", 4 },
+    { "SI", 192 },
+    { "PL", 171 },
+    { "PM", 172 },
+    { "LY", 129 },
+    { "SG", 190 },
+    { "RE", 180 },
+    { "TF", 206 },
+    { "CX", 49 },
+    { "NP", 161 },
+    { "SR", 199 },
+    { "IR", 101 },
+    { "SY", 202 },
+    { "DZ", 57 },
+    { "SE", 189 },
+    { "ZM", 236 },
+    { "BF", 20 },
+    { "ES", 63 },
+    { "CH", 39 },
+    { "MK", 137 },
+    { "PN", 173 },
+    { "SV", 201 },
+    { "GN", 81 },
+    { "MC", 131 },
+    { "SM", 196 },
+    { "BB", 17 },
+    { "AR", 10 },
+    { "TG", 207 },
+    { "SA", 185 },
+    { "ET", 64 },
+    { "IM", 98 },
+    { "CA", 35 },
+    { "RS", 182 },
+    { "AF", 2 },
+    { "EH", 61 },
+    { "VG", 227 },
+    { "BL", 25 },
+    { "VN", 229 },
+    { "GM", 80 },
+    { "CI", 40 },
+    { "VC", 225 },
+    { "ZA", 235 },
+    { "KM", 112 },
+    { "AN", 7 },
+    { "AD", 0 },
+    { "ER", 62 },
+    { "BW", 32 },
+    { "IS", 102 },
+    { "CO", 45 },
+    { "VI", 228 },
+    { "BI", 23 },
+    { "AW", 14 },
+    { "SZ", 203 },
+    { "UG", 220 },
+    { "PW", 177 },
+    { "IE", 96 },
+    { "BD", 18 },
+    { "DO", 56 },
+    { "KN", 113 },
+    { "MN", 140 },
+    { "GR", 84 },
+    { "CD", 36 },
+    { "SH", 191 },
+    { "MF", 134 },
+    { "TV", 216 },
+    { "SD", 188 },
+};
+static const ESGeoNamesHashTable esGeoNamesCCCodeHash = { 238, 120, esGeoNamesCCCodeDisplacements, esGeoNamesCCCodeEntries };
+
+// Country names (loc-cc.dat) and aliases, to the index of the country's code:  245
+static const unsigned short esGeoNamesCCAliasDisplacements[123] = {
+    11, 36, 2, 12, 1, 3, 0, 14, 10, 19, 0, 1, 10, 12, 4, 11,
+    1, 17, 6, 2, 15, 6, 4, 45, 1, 0, 4, 2, 33, 11, 1, 3,
+    0, 4, 2, 0, 20, 1, 4, 2, 7, 2, 4, 2, 5, 3, 1, 0,
+    9, 0, 0, 1, 8, 0, 5, 2, 0, 5, 19, 4, 1, 2, 23, 3,
+    2, 2, 55, 0, 9, 0, 6, 6, 1, 7, 3, 17, 11, 0, 9, 4,
+    12, 18, 1, 2, 29, 2, 7, 5, 19, 70, 22, 1, 39, 13, 1, 7,
+    159, 0, 59, 0, 0, 0, 1, 2, 2, 23, 23, 3, 4, 19, 0, 0,
+    12, 1, 24, 137, 33, 279, 6, 6, 44, 0, 87,
+};
+static const ESGeoNamesHashEntry esGeoNamesCCAliasEntries[245] = {
+    { "Uganda", 220 },
+    { "Haiti", 93 },
+    { "Macao", 141 },
+    { "Christmas Island", 49 },
+    { "Benin", 24 },
+    { "Namibia", 153 },
+    { "North Korea", 114 },
+    { "Malaysia", 151 },
+    { "Denmark", 54 },
+    { "Bulgaria", 21 },
+    { "Armenia", 6 },
+    { "Costa Rica", 46 },
+    { "Belgium", 19 },
+    { "Slovakia", 194 },
+    { "Spain", 63 },
+    { "Czech Republic", 51 },
+    { "Argentina", 10 },
+    { "Morocco", 130 },
+    { "Zimbabwe", 237 },
+    { "Iceland", 102 },
+    { "Malta", 146 },
+    { "Antarctica", 9 },
+    { "Mongolia", 140 },
+    { "Senegal", 197 },
+    { "Belarus", 33 },
+    { "Saint Martin", 134 },
+    { "Kiribati", 111 },
+    { "Liechtenstein", 122 },
+    { "Zambia", 236 },
+    { "Sweden", 189 },
+    { "U.K.", 72 },
+    { "Nigeria", 157 },
+    { "Ethiopia", 64 },
+    { "Luxembourg", 127 },
+    { "Isle of Man", 98 },
+    { "Angola", 8 },
+    { "Fiji", 66 },
+    { "Greece", 84 },
+    { "Trinidad and Tobago", 215 },
+    { "Portugal", 176 },
+    { "Burkina Faso", 20 },
+    { "Germany", 52 },
+    { "Equatorial Guinea", 83 },
+    { "Togo", 207 },
+    { "Guernsey", 76 },
+    { "United Arab Emirates", 1 },
+    { "Netherlands", 159 },
+    { "Republic of the Congo", 38 },
+    { "Liberia", 124 },
+    { "Saint Kitts and Nevis", 113 },
+    { "Marshall Islands", 136 },
+    { "Australia", 13 },
+    { "Djibouti", 53 },
+    { "Kyrgyzstan", 109 },
+    { "Ivory Coast", 40 },
+    { "Ukraine", 219 },
+    { "Falkland Islands", 67 },
+    { "East Timor", 210 },
+    { "New Zealand", 163 },
+    { "Guyana", 89 },
+    { "Saint Helena", 191 },
+    { "Northern Mariana Islands", 142 },
+    { "Kuwait", 116 },
+    { "Bhutan", 31 },
+    { "Russia", 183 },
+    { "Grenada", 73 },
+    { "Nicaragua", 158 },
+    { "Montserrat", 145 },
+    { "Laos", 119 },
+    { "Sudan", 188 },
+    { "United States of America", 221 },
+    { "Martinique", 143 },
+    { "Hungary", 94 },
+    { "Jamaica", 105 },
+    { "Norway", 160 },
+    { "Montenegro", 133 },
+    { "Netherlands Antilles", 7 },
+    { "Barbados", 17 },
+    { "Japan", 107 },
+    { "Jordan", 106 },
+    { "China", 44 },
+    { "Turkey", 214 },
+    { "Singapore", 190 },
+    { "Tuvalu", 216 },
+    { "Lesotho", 125 },
+    { "Afghanistan", 2 },
+    { "Oman", 164 },
+    { "Bahamas", 30 },
+    { "Dominica", 55 },
+    { "Yemen", 233 },
+    { "Guinea", 81 },
+    { "Central African Republic", 37 },
+    { "USA", 221 },
+    { "Sao Tome and Principe", 200 },
+    { "Greenland", 79 },
+    { "U.S. Virgin Islands", 228 },
+    { "Malawi", 149 },
+    { "Guatemala", 86 },
+    { "Estonia", 59 },
+    { "Chad", 205 },
+    { "Iran", 101 },
+    { "Switzerland", 39 },
+    { "Vanuatu", 230 },
+    { "UK", 72 },
+    { "Bosnia and Herzegovina", 16 },
+    { "Monaco", 131 },
+    { "Mayotte", 234 },
+    { "Cape Verde", 48 },
+    { "Samoa", 232 },
+    { "Great Britain", 72 },
+    { "Saudi Arabia", 185 },
+    { "Algeria", 57 },
+    { "Thailand", 208 },
+    { "Tanzania", 218 },
+    { "Qatar", 179 },
+    { "Somalia", 198 },
+    { "French Polynesia", 167 },
+    { "Paraguay", 178 },
+    { "French Southern Territories", 206 },
+    { "Egypt", 60 },
+    { "Dominican Republic", 56 },
+    { "Myanmar", 139 },
+    { "U.S.", 221 },
+    { "Solomon Islands", 186 },
+    { "Peru", 166 },
+    { "Tunisia", 212 },
+    { "Cayman Islands", 117 },
+    { "Kenya", 108 },
+    { "French Guiana", 75 },
+    { "Comoros", 112 },
+    { "Sri Lanka", 123 },
+    { "Albania", 5 },
+    { "Bangladesh", 18 },
+    { "New Caledonia", 154 },
+    { "Niger", 155 },
+    { "Madagascar", 135 },
+    { "Israel", 97 },
+    { "Libya", 129 },
+    { "Bermuda", 26 },
+    { "Maldives", 148 },
+    { "South Africa", 235 },
+    { "Hong Kong", 90 },
+    { "Venezuela", 226 },
+    { "Ireland", 96 },
+    { "Colombia", 45 },
+    { "Botswana", 32 },
+    { "Cook Islands", 41 },
+    { "Gabon", 71 },
+    { "Guam", 87 },
+    { "Philippines", 169 },
+    { "Georgia", 74 },
+    { "Bahrain", 22 },
+    { "British Virgin Islands", 227 },
+    { "South Georgia and the South Sandwich Islands", 85 },
+    { "Turks and Caicos Islands", 204 },
+    { "Mozambique", 152 },
+    { "Guadeloupe", 82 },
+    { "Swaziland", 203 },
+    { "Sierra Leone", 195 },
+    { "Micronesia", 68 },
+    { "Anguilla", 4 },
+    { "Saint Barth\303\251lemy", 25 },
+    { "Gambia", 80 },
+    { "Niue", 162 },
+    { "Serbia", 182 },
+    { "Jersey", 104 },
+    { "France", 70 },
+    { "Palestinian Territory", 175 },
+    { "Vietnam", 229 },
+    { "Tajikistan", 209 },
+    { "Azerbaijan", 15 },
+    { "Honduras", 91 },
+    { "Canada", 35 },
+    { "Vatican", 224 },
+    { "U.S.A.", 221 },
+    { "Lithuania", 126 },
+    { "Saint Lucia", 121 },
+    { "Latvia", 128 },
+    { "Aruba", 14 },
+    { "Iraq", 100 },
+    { "Austria", 12 },
+    { "Bolivia", 28 },
+    { "Taiwan", 217 },
+    { "Mauritania", 144 },
+    { "Reunion", 180 },
+    { "Slovenia", 192 },
+    { "Papua New Guinea", 168 },
+    { "Tonga", 213 },
+    { "Saint Pierre and Miquelon", 172 },
+    { "Turkmenistan", 211 },
+    { "Western Sahara", 61 },
+    { "Eritrea", 62 },
+    { "Norfolk Island", 156 },
+    { "Guinea-Bissau", 88 },
+    { "Suriname", 199 },
+    { "Croatia", 92 },
+    { "Syria", 202 },
+    { "Puerto Rico", 174 },
+    { "Cuba", 47 },
+    { "El Salvador", 201 },
+    { "Belize", 34 },
+    { "Italy", 103 },
+    { "Uruguay", 222 },
+    { "American Samoa", 11 },
+    { "Ghana", 77 },
+    { "Palau", 177 },
+    { "Faroe Islands", 69 },
+    { "Saint Vincent and the Grenadines", 225 },
+    { "Nepal", 161 },
+    { "Brunei", 27 },
+    { "India", 99 },
+    { "Cyprus", 50 },
+    { "Andorra", 0 },
+    { "Svalbard and Jan Mayen", 193 },
+    { "Cameroon", 43 },
+    { "South Korea", 115 },
+    { "Finland", 65 },
+    { "Burundi", 23 },
+    { "Lebanon", 120 },
+    { "Poland", 171 },
+    { "Gibraltar", 78 },
+    { "Cambodia", 110 },
+    { "Mauritius", 147 },
+    { "United Kingdom", 72 },
+    { "Rwanda", 184 },
+    { "Wallis and Futuna", 231 },
+    { "Seychelles", 187 },
+    { "Uzbekistan", 223 },
+    { "Pakistan", 170 },
+    { "Brazil", 29 },
+    { "Antigua and Barbuda", 3 },
+    { "Romania", 181 },
+    { "Panama", 165 },
+    { "Indonesia", 95 },
+    { "Democratic Republic of the Congo", 36 },
+    { "Macedonia", 137 },
+    { "United States", 221 },
+    { "Chile", 42 },
+    { "Pitcairn", 173 },
+    { "Moldova", 132 },
+    { "Mexico", 150 },
+    { "San Marino", 196 },
+    { "Kazakhstan", 118 },
+    { "Mali", 138 },
+    { "Ecuador", 58 },
+};
+static const ESGeoNamesHashTable esGeoNamesCCAliasHash = { 245, 123, esGeoNamesCCAliasDisplacements, esGeoNamesCCAliasEntries };
+
+// Admin1 codes (loc-a1Codes.dat):  3269
+static const unsigned short esGeoNamesA1CodeDisplacements[1635] = {
+    5, 2, 6, 11, 4, 5, 1, 0, 4, 14, 2, 1, 4, 3, 1, 1,
+    2, 0, 0, 1, 4, 0, 12, 1, 4, 1, 5, 19, 2, 2, 24, 2,
+    1, 4, 6, 2, 1, 2, 0, 9, 2, 1, 20, 4, 15, 1, 6, 12,
+    8, 7, 0, 0, 2, 1, 25, 0, 3, 5, 7, 8, 3, 3, 3, 1,
+    4, 8, 2, 1, 1, 1, 2, 0, 0, 4, 1, 7, 3, 1, 0, 3,
+    4, 2, 12, 0, 4, 23, 0, 1, 16, 3, 1, 2, 2, 0, 0, 0,
+    0, 3, 1, 2, 9, 3, 1, 28, 2, 1, 2, 3, 2, 3, 5, 0,
+    2, 3, 0, 1, 1, 0, 28, 17, 24, 8, 1, 9, 3, 4, 9, 9,
+    3, 0, 13, 5, 1, 10, 2, 2, 9, 0, 11, 5, 7, 1, 12, 37,
+    2, 1, 2, 4, 0, 13, 0, 0, 7, 0, 1, 21, 3, 2, 2, 11,
+    3, 2, 21, 3, 3, 8, 1, 19, 10, 1, 1, 14, 10, 0, 3, 14,
+    6, 1, 1, 3, 1, 2, 3, 9, 9, 1, 11, 0, 2, 4, 1, 7,
+    0, 2, 1, 2, 4, 11, 10, 2, 1, 4, 0, 0, 1, 25, 25, 2,
+    4, 3, 0, 10, 22, 14, 4, 3, 13, 1, 2, 3, 0, 1, 8, 1,
+    10, 9, 9, 8, 8, 7, 2, 5, 13, 1, 1, 5, 3, 3, 0, 0,
+    7, 3, 0, 0, 1, 3, 1, 26, 27, 1, 5, 4, 4, 8, 4, 1,
+    2, 3, 1, 1, 4, 7, 11, 4, 2, 12, 0, 8, 5, 0, 2, 27,
+    9, 9, 3, 20, 10, 6, 18, 2, 20, 6, 15, 20, 5, 3, 19, 3,
+    7, 1, 1, 9, 4, 12, 14, 0, 5, 2, 11, 9, 0, 0, 2, 16,
+    12, 1, 3, 16, 18, 2, 2, 1, 4, 1, 2, 8, 3, 0, 8, 16,
+    12, 22, 0, 3, 10, 1, 12, 17, 21, 1, 3, 13, 14, 0, 0, 2,
+    2, 0, 1, 6, 10, 2, 1, 10, 6, 0, 5, 3, 0, 17, 7, 3,
+    13, 40, 0, 1, 4, 11, 0, 3, 1, 0, 16, 14, 5, 1, 19, 3,
+    0, 7, 1, 3, 0, 2, 2, 21, 7, 4, 34, 1, 15, 0, 2, 1,
+    1, 3, 5, 1, 7, 7, 1, 0, 1, 1, 9, 1, 0, 6, 5, 1,
+    0, 2, 2, 0, 1, 4, 19, 2, 1, 0, 6, 1, 4, 2, 0, 2,
+    0, 1, 3, 0, 5, 0, 6, 10, 2, 1, 0, 8, 3, 0, 7, 0,
+    4, 21, 3, 10, 0, 3, 1, 1, 4, 4, 15, 22, 1, 6, 1, 1,
+    1, 4, 0, 1, 7, 4, 0, 3, 0, 0, 1, 8, 3, 30, 6, 2,
+    8, 6, 1, 7, 1, 3, 0, 3, 13, 4, 0, 2, 1, 7, 6, 7,
+    13, 15, 0, 13, 15, 5, 0, 19, 2, 8, 0, 25, 1, 21, 2, 13,
+    1, 10, 1, 27, 0, 2, 4, 2, 8, 1, 5, 1, 2, 2, 26, 17,
+    8, 1, 7, 1, 5, 1, 3, 0, 2, 4, 6, 6, 3, 1, 2, 0,
+    1, 0, 6, 12, 1, 11, 0, 0, 13, 3, 0, 19, 0, 6, 5, 3,
+    0, 1, 3, 1, 5, 0, 24, 2, 4, 1, 1, 49, 2, 5, 36, 29,
+    7, 0, 19, 0, 3, 4, 23, 0, 0, 1, 7, 0, 3, 6, 2, 7,
+    35, 0, 16, 1, 5, 2, 14, 1, 0, 3, 11, 16, 19, 0, 2, 9,
+    1, 2, 4, 8, 10, 11, 3, 4, 4, 39, 1, 2, 2, 0, 0, 0,
+    28, 18, 0, 1, 1, 7, 3, 7, 9, 0, 11, 12, 1, 5, 1, 2,
+    1, 8, 3, 0, 12, 13, 11, 23, 3, 0, 1, 2, 3, 0, 0, 10,
+    29, 4, 9, 0, 9, 20, 24, 0, 32, 1, 2, 0, 4, 6, 4, 14,
+    11, 15, 0, 24, 13, 7, 3, 7, 3, 1, 7, 2, 7, 2, 1, 3,
+    0, 0, 5, 2, 8, 2, 31, 13, 0, 0, 10, 1, 7, 1, 12, 1,
+    5, 109, 1, 2, 1, 8, 13, 4, 2, 3, 8, 5, 4, 11, 23, 3,
+    4, 8, 6, 3, 5, 0, 9, 1, 26, 3, 2, 20, 0, 2, 20, 1,
+    6, 3, 15, 2, 2, 4, 8, 1, 20, 18, 3, 16, 3, 7, 4, 16,
+    10, 10, 1, 2, 9, 3, 1, 2, 28, 9, 10, 4, 1, 2, 5, 3,
+    0, 2, 6, 0, 62, 2, 18, 1, 31, 3, 11, 2, 0, 1, 21, 3,
+    13, 7, 17, 0, 28, 2, 9, 22, 2, 24, 1, 34, 8, 15, 10, 9,
+    0, 0, 10, 22, 8, 3, 5, 2, 11, 1, 1, 26, 5, 0, 6, 3,
+    1, 8, 55, 5, 11, 17, 1, 0, 5, 11, 55, 4, 17, 1, 4, 42,
+    8, 5, 18, 0, 13, 0, 1, 0, 1, 1, 2, 9, 1, 12, 1, 16,
+    3, 4, 7, 16, 0, 1, 28, 37, 1, 1, 5, 17, 0, 30, 10, 11,
+    36, 33, 5, 2, 0, 25, 19, 6, 5, 3, 16, 2, 5, 6, 0, 0,
+    0, 5, 27, 30, 0, 27, 2, 24, 0, 5, 24, 2, 22, 0, 6, 9,
+    5, 0, 7, 5, 1, 2, 2, 1, 4, 0, 0, 18, 10, 8, 3, 16,
+    10, 15, 1, 13, 19, 6, 11, 36, 1, 25, 0, 2, 41, 1, 25, 15,
+    9, 4, 13, 2, 1, 7, 96, 15, 1, 29, 1, 14, 18, 20, 1, 5,
+    0, 0, 33, 9, 9, 34, 6, 0, 1, 13, 0, 2, 3, 15, 24, 3,
+    3, 1, 0, 13, 34, 0, 9, 3, 6, 35, 0, 13, 4, 8, 9, 10,
+    6, 4, 3, 3, 7, 4, 0, 1, 1, 19, 0, 2, 4, 17, 67, 1,
+    11, 8, 2, 2, 5, 2, 5, 4, 11, 6, 25, 13, 20, 1, 1, 10,
+    17, 11, 5, 18, 4, 15, 45, 3, 0, 0, 3, 12, 13, 15, 1, 12,
+    15, 17, 0, 1, 2, 12, 5, 7, 19, 3, 5, 0, 10, 20, 28, 6,
+    27, 32, 28, 5, 4, 4, 11, 2, 5, 1, 6, 1, 8, 20, 41, 0,
+    13, 23, 7, 5, 15, 57, 10, 1, 5, 7, 3, 29, 26, 15, 14, 13,
+    17, 9, 0, 24, 7, 3, 3, 2, 1, 0, 1, 26, 0, 0, 125, 0,
+    5, 27, 1, 59, 0, 17, 1, 30, 14, 12, 2, 30, 26, 2, 4, 1,
+    37, 3, 1, 4, 19, 0, 29, 2, 1, 0, 0, 8, 9, 56, 10, 11,
+    52, 0, 48, 11, 5, 19, 1, 0, 1, 85, 10, 47, 0, 1, 6, 8,
+    1, 19, 48, 31, 29, 2, 13, 1, 0, 16, 15, 31, 17, 6, 24, 5,
+    5, 0, 27, 0, 2, 11, 0, 0, 12, 2, 0, 1, 39, 2, 2, 1,
+    20, 22, 5, 15, 34, 18, 7, 13, 0, 0, 0, 6, 40, 3, 5, 12,
+    1, 4, 54, 2, 8, 15, 18, 24, 4, 18, 0, 42, 110, 36, 0, 56,
+    1, 0, 13, 9, 0, 51, 20, 4, 1, 0, 9, 23, 4, 4, 22, 9,
+    47, 23, 9, 6, 24, 1, 3, 4, 14, 64, 5, 34, 19, 5, 22, 23,
+    29, 30, 50, 6, 1, 30, 25, 45, 8, 5, 2, 8, 2, 10, 24, 0,
+    6, 1, 11, 28, 19, 87, 5, 0, 0, 1, 12, 41, 6, 4, 2, 31,
+    3, 1, 15, 4, 32, 13, 1, 3, 3, 1, 7, 111, 3, 11, 7, 0,
+    2, 0, 25, 1, 0, 31, 2, 4, 3, 10, 24, 34, 1, 11, 16, 54,
+    12, 0, 56, 8, 8, 18, 20, 56, 9, 14, 2, 11, 5, 12, 49, 23,
+    1, 0, 0, 62, 4, 7, 8, 10, 1, 36, 14, 47, 3, 67, 36, 14,
+    85, 33, 12, 36, 2, 1, 45, 38, 41, 11, 1, 0, 3, 81, 1, 8,
+    71, 43, 44, 18, 0, 17, 4, 11, 140, 20, 21, 2, 4, 9, 14, 1,
+    11, 29, 39, 65, 26, 9, 4, 15, 42, 9, 3, 132, 4, 61, 3, 9,
+    41, 2, 0, 10, 1, 30, 13, 16, 1, 47, 99, 5, 99, 7, 2, 1,
+    16, 4, 32, 3, 41, 6, 16, 48, 15, 12, 9, 32, 11, 43, 9, 0,
+    52, 6, 329, 0, 15, 4, 21, 26, 5, 27, 46, 12, 13, 9, 1, 0,
+    17, 71, 47, 1, 26, 60, 12, 32, 1, 18, 2, 1, 28, 1, 0, 5,
+    6, 33, 3, 52, 59, 2, 0, 48, 1, 27, 13, 4, 1, 4, 7, 0,
+    5, 81, 1, 41, 20, 16, 8, 49, 35, 13, 0, 73, 172, 0, 5, 0,
+    94, 5, 19, 123, 1, 7, 0, 11, 7, 63, 7, 12, 54, 7, 22, 33,
+    5, 21, 10, 1, 0, 28, 5, 94, 27, 69, 1, 4, 61, 13, 14, 177,
+    2, 48, 3, 0, 27, 11, 47, 52, 11, 135, 2, 130, 6, 0, 28, 0,
+    0, 0, 3, 150, 0, 0, 166, 2, 0, 92, 36, 2, 84, 33, 0, 1,
+    128, 208, 2, 3, 4, 174, 3, 2, 100, 0, 43, 1, 27, 127, 45, 131,
+    2, 164, 15, 58, 1, 2, 18, 166, 8, 79, 1, 20, 37, 321, 41, 91,
+    47, 18, 67, 24, 12, 2, 0, 1, 12, 25, 2, 13, 0, 1, 1, 0,
+    77, 52, 0, 0, 73, 8, 17, 25, 501, 12, 232, 0, 0, 0, 22, 134,
+    551, 78, 10, 35, 188, 6, 104, 1, 214, 191, 3, 482, 48, 400, 12, 31,
+    21, 34, 3, 28, 435, 242, 36, 454, 82, 0, 356, 0, 189, 1, 0, 1,
+    27, 164, 0, 0, 0, 2, 119, 11, 0, 2113, 71, 8, 23, 2285, 57, 63,
+    2, 1651, 14,
+};
+static const ESGeoNamesHashEntry esGeoNamesA1CodeEntries[3269] = {
+    { "PH.D7", 2294 },
+    { "KP.13", 1454 },
+    { "LB.09", 1511 },
+    { "OM.06", 2125 },
+    { "IL.02", 1208 },
+    { "BR.11", 363 },
+    { "RU.13", 2453 },
+    { "TH.11", 2748 },
+    { "VN.69", 3164 },
+    { "MK.94", 1733 },
+    { "TH.70", 2759 },
+    { "IN.31", 1238 },
+    { "TG.18", 2715 },
+    { "TR.44", 2849 },
+    { "UZ.06", 3126 },
+    { "TT.05", 2925 },
+    { "MK.43", 1780 },
+    { "MK.80", 1747 },
+    { "KP.07", 1446 },
+    { "VE.11", 3150 },
+    { "EE.03", 797 },
+    { "ER.01", 839 },
+    { "CI.82", 501 },
+    { "US.MS", 3063 },
+    { "SY.04", 2690 },
+    { "KE.02", 1401 },
+    { "TN.29", 2816 },
+    { "BZ.04", 410 },
+    { "AD.08", 3 },
+    { "PG.15", 2171 },
+    { "DZ.36", 769 },
+    { "KZ.10", 1487 },
+    { "SA.05", 2537 },
+    { "ET.45", 877 },
+    { "BR.01", 366 },
+    { "MW.30", 1907 },
+    { "MK.93", 1734 },
+    { "PG.10", 2167 },
+    { "PH.G4", 2261 },
+    { "HN.04", 1088 },
+    { "GH.06", 968 },
+    { "SD.30", 2566 },
+    { "ID.32", 1163 },
+    { "GW.11", 1070 },
+    { "NI.08", 2063 },
+    { "LC.07", 1520 },
+    { "MK.86", 1741 },
+    { "TH.01", 2743 },
+    { "ID.17", 1167 },
+    { "AO.14", 76 },
+    { "KR.15", 1464 },
+    { "MM.02", 1848 },
+    { "DE.06", 680 },
+    { "SV.07", 2676 },
+    { "HT.12", 1120 },
+    { "AE.02", 14 },
+    { "VN.33", 3176 },
+    { "CO.29", 593 },
+    { "US.CT", 3070 },
+    { "CI.91", 533 },
+    { "PK.04", 2316 },
+    { "BG.62", 268 },
+    { "NA.31", 1991 },
+    { "JP.10", 1358 },
+    { "MK.25", 1796 },
+    { "IR.10", 1291 },
+    { "CN.11", 566 },
+    { "TH.40", 2801 },
+    { "TH.32", 2802 },
+    { "AZ.11", 194 },
+    { "AO.07", 85 },
+    { "MK.87", 1740 },
+    { "GS.00", 1038 },
+    { "MD.64", 1688 },
+    { "CM.05", 552 },
+    { "HR.06", 1113 },
+    { "ZW.10", 3265 },
+    { "IQ.17", 1266 },
+    { "UG.76", 2992 },
+    { "US.DC", 3059 },
+    { "CA.09", 416 },
+    { "SD.44", 2572 },
+    { "TM.00", 2811 },
+    { "EC.14", 778 },
+    { "ML.10", 1829 },
+    { "ID.03", 1177 },
+    { "CA.14", 423 },
+    { "AR.02", 113 },
+    { "HR.20", 1103 },
+    { "IE.21", 1187 },
+    { "NE.09", 2007 },
+    { "JP.01", 1378 },
+    { "KR.06", 1457 },
+    { "PH.F4", 2234 },
+    { "NG.41", 2037 },
+    { "US.HI", 3096 },
+    { "FR.B6", 912 },
+    { "KH.08", 1427 },
+    { "NO.13", 2098 },
+    { "IT.14", 1307 },
+    { "RU.87", 2506 },
+    { "UG.52", 3009 },
+    { "GM.04", 986 },
+    { "CH.SZ", 476 },
+    { "BR.26", 356 },
+    { "SJ.00", 2607 },
+    { "MR.09", 1875 },
+    { "SD.29", 2558 },
+    { "RW.04", 2528 },
+    { "RU.19", 2494 },
+    { "CD.10", 430 },
+    { "ML.04", 1826 },
+    { "VE.17", 3134 },
+    { "CL.12", 543 },
+    { "LA.15", 1502 },
+    { "IM.00", 1212 },
+    { "CI.63", 531 },
+    { "LR.09", 1546 },
+    { "BH.02", 299 },
+    { "GW.01", 1071 },
+    { "UA.10", 2968 },
+    { "AM.07", 70 },
+    { "MZ.10", 1988 },
+    { "TH.33", 2780 },
+    { "BH.06", 294 },
+    { "US.NM", 3088 },
+    { "RU.89", 2519 },
+    { "BA.BD", 203 },
+    { "MK.12", 1805 },
+    { "BG.59", 288 },
+    { "TH.74", 2789 },
+    { "DK.20", 694 },
+    { "IN.28", 1236 },
+    { "BG.43", 284 },
+    { "FI.01", 883 },
+    { "SK.", 2611 },
+    { "SD.45", 2551 },
+    { "US.ND", 3077 },
+    { "AF.06", 41 },
+    { "SD.39", 2576 },
+    { "MK.04", 1814 },
+    { "LU.01", 1582 },
+    { "RU.68", 2451 },
+    { "ES.00", 860 },
+    { "UY.06", 3103 },
+    { "NG.50", 2030 },
+    { "TT.02", 2920 },
+    { "PH.59", 2246 },
+    { "RO.43", 2420 },
+    { "LI.04", 1532 },
+    { "BG.48", 279 },
+    { "LR.01", 1556 },
+    { "BG.65", 271 },
+    { "BT.20", 379 },
+    { "CD.02", 434 },
+    { "AO.04", 87 },
+    { "TJ.00", 2807 },
+    { "PH.B4", 2258 },
+    { "EE.08", 799 },
+    { "LA.22", 1506 },
+    { "CG.11", 462 },
+    { "KG.00", 1409 },
+    { "SD.28", 2550 },
+    { "TG.26", 2720 },
+    { "PW.00", 2362 },
+    { "MY.03", 1969 },
+    { "VE.20", 3146 },
+    { "BF.68", 220 },
+    { "CR.03", 626 },
+    { "HR.14", 1109 },
+    { "EC.01", 785 },
+    { "ID.04", 1176 },
+    { "BT.12", 385 },
+    { "CO.09", 611 },
+    { "CZ.84", 658 },
+    { "LI.08", 1528 },
+    { "UA.20", 2985 },
+    { "IR.24", 1282 },
+    { "AL.46", 54 },
+    { "CN.08", 590 },
+    { "TO.03", 2841 },
+    { "TD.13", 2700 },
+    { "BY.", 406 },
+    { "AF.14", 19 },
+    { "BO.06", 341 },
+    { "JO.09", 1347 },
+    { "YE.25", 3231 },
+    { "TR.23", 2880 },
+    { "NZ.F4", 2120 },
+    { "UY.18", 3107 },
+    { "AR.20", 114 },
+    { "LV.16", 1591 },
+    { "US.ID", 3090 },
+    { "BF.18", 248 },
+    { "LS.12", 1566 },
+    { "TR.25", 2870 },
+    { "UY.05", 3099 },
+    { "RO.39", 2414 },
+    { "UG.90", 3001 },
+    { "AF.19", 24 },
+    { "GA.06", 928 },
+    { "VN.39", 3196 },
+    { "PH.A8", 2236 },
+    { "AZ.23", 177 },
+    { "PA.06", 2134 },
+    { "RU.09", 2472 },
+    { "UA.02", 2970 },
+    { "ET.44", 861 },
+    { "NL.16", 2079 },
+    { "BW.00", 388 },
+    { "BR.06", 346 },
+    { "PH.33", 2193 },
+    { "SM.07", 2623 },
+    { "TZ.11", 2958 },
+    { "FO.NO", 897 },
+    { "AR.16", 102 },
+    { "LY.58", 1637 },
+    { "UG.47", 2999 },
+    { "NA.34", 1994 },
+    { "PH.05", 2209 },
+    { "MD.79", 1664 },
+    { "BD.84", 214 },
+    { "TR.01", 2891 },
+    { "VE.05", 3136 },
+    { "NG.37", 2049 },
+    { "MK.77", 1818 },
+    { "CG.14", 465 },
+    { "DM.02", 700 },
+    { "BL.00", 329 },
+    { "AO.19", 82 },
+    { "TR.38", 2852 },
+    { "MX.10", 1956 },
+    { "SM.02", 2624 },
+    { "LY.24", 1639 },
+    { "GN.38", 997 },
+    { "PT.07", 2359 },
+    { "MK.95", 1732 },
+    { "BR.17", 345 },
+    { "LV.03", 1613 },
+    { "IN.25", 1214 },
+    { "CG.05", 456 },
+    { "VN.72", 3221 },
+    { "CH.VD", 475 },
+    { "BJ.15", 323 },
+    { "RU.00", 2440 },
+    { "MK.37", 1786 },
+    { "PH.69", 2275 },
+    { "DZ.22", 770 },
+    { "EG.23", 822 },
+    { "LA.27", 1491 },
+    { "AE.04", 12 },
+    { "PH.D8", 2293 },
+    { "DZ.51", 741 },
+    { "IR.26", 1273 },
+    { "AE.06", 10 },
+    { "RU.83", 2439 },
+    { "UY.04", 3106 },
+    { "CF.06", 446 },
+    { "NA.37", 2000 },
+    { "AZ.40", 178 },
+    { "PH.22", 2243 },
+    { "UA.08", 2979 },
+    { "EG.07", 831 },
+    { "HU.08", 1138 },
+    { "UG.70", 2990 },
+    { "AF.34", 42 },
+    { "RU.41", 2447 },
+    { "NG.49", 2043 },
+    { "ID.38", 1153 },
+    { "MM.10", 1843 },
+    { "DE.01", 674 },
+    { "LV.31", 1585 },
+    { "AO.18", 74 },
+    { "TR.92", 2900 },
+    { "LR.14", 1552 },
+    { "CI.41", 512 },
+    { "PH.01", 2255 },
+    { "VN.22", 3209 },
+    { "AM.05", 68 },
+    { "CL.09", 540 },
+    { "US.FL", 3050 },
+    { "TR.58", 2843 },
+    { "SV.08", 2673 },
+    { "MK.A2", 1726 },
+    { "LT.65", 1571 },
+    { "PH.G2", 2282 },
+    { "DO.28", 723 },
+    { "BF.72", 239 },
+    { "BF.63", 254 },
+    { "GE.45", 946 },
+    { "TD.03", 2710 },
+    { "PY.02", 2379 },
+    { "TJ.02", 2805 },
+    { "IT.08", 1316 },
+    { "US.IN", 3051 },
+    { "CO.15", 619 },
+    { "CU.11", 640 },
+    { "PH.11", 2216 },
+    { "AZ.52", 186 },
+    { "UY.12", 3097 },
+    { "HT.09", 1124 },
+    { "UA.23", 2972 },
+    { "AZ.21", 185 },
+    { "CY.00", 654 },
+    { "IR.40", 1277 },
+    { "LI.01", 1535 },
+    { "LR.19", 1545 },
+    { "PL.84", 2327 },
+    { "LK.", 1544 },
+    { "RO.05", 2400 },
+    { "RU.08", 2454 },
+    { "NZ.F8", 2113 },
+    { "AG.04", 44 },
+    { "RO.26", 2395 },
+    { "LU.03", 1584 },
+    { "MM.03", 1833 },
+    { "TR.63", 2859 },
+    { "MX.27", 1938 },
+    { "HU.10", 1131 },
+    { "VN.30", 3167 },
+    { "QA.08", 2383 },
+    { "LY.61", 1631 },
+    { "ZM.04", 3253 },
+    { "PH.30", 2182 },
+    { "PH.23", 2267 },
+    { "MK.A6", 1723 },
+    { "LV.30", 1593 },
+    { "CV.00", 646 },
+    { "RU.81", 2463 },
+    { "PH.64", 2214 },
+    { "VN.86", 3163 },
+    { "MX.06", 1950 },
+    { "BF.44", 238 },
+    { "FO.ST", 893 },
+    { "RE.RE", 2388 },
+    { "SR.11", 2658 },
+    { "TZ.14", 2957 },
+    { "LC.05", 1522 },
+    { "MY.04", 1971 },
+    { "KZ.00", 1474 },
+    { "IR.22", 1294 },
+    { "PE.16", 2138 },
+    { "EG.15", 832 },
+    { "TR.11", 2884 },
+    { "IR.16", 1288 },
+    { "YE.12", 3235 },
+    { "JP.21", 1364 },
+    { "LA.13", 1498 },
+    { "JP.13", 1353 },
+    { "AL.41", 53 },
+    { "FR.B8", 916 },
+    { "UA.25", 2982 },
+    { "DO.35", 727 },
+    { "IN.30", 1216 },
+    { "PH.03", 2215 },
+    { "LB.08", 1510 },
+    { "BG.40", 285 },
+    { "MK.15", 1803 },
+    { "VE.02", 3135 },
+    { "LV.32", 1590 },
+    { "NZ.G2", 2106 },
+    { "LR.13", 1554 },
+    { "GH.01", 976 },
+    { "SA.06", 2540 },
+    { "PE.06", 2145 },
+    { "RO.38", 2398 },
+    { "ID.05", 1166 },
+    { "IS.44", 1305 },
+    { "EC.20", 774 },
+    { "CO.36", 592 },
+    { "CN.10", 576 },
+    { "JP.46", 1375 },
+    { "AZ.38", 180 },
+    { "VN.77", 3214 },
+    { "IT.16", 1320 },
+    { "LI.02", 1534 },
+    { "IE.27", 1183 },
+    { "ET.03", 874 },
+    { "GA.05", 921 },
+    { "CN.21", 582 },
+    { "PL.85", 2325 },
+    { "CH.LU", 477 },
+    { "PT.03", 2344 },
+    { "MK.50", 1774 },
+    { "ID.22", 1175 },
+    { "TH.46", 2779 },
+    { "CH.NW", 487 },
+    { "DJ.06", 691 },
+    { "BG.64", 276 },
+    { "DZ.07", 766 },
+    { "KP.18", 1451 },
+    { "LY.56", 1634 },
+    { "PE.20", 2141 },
+    { "BF.69", 263 },
+    { "MK.06", 1812 },
+    { "TN.36", 2820 },
+    { "MK.B9", 1711 },
+    { "IE.23", 1185 },
+    { "HR.16", 1114 },
+    { "MD.88", 1672 },
+    { "MN.07", 1867 },
+    { "LV.05", 1607 },
+    { "PH.A9", 2306 },
+    { "GG.00", 965 },
+    { "CF.13", 450 },
+    { "AM.03", 65 },
+    { "TZ.05", 2937 },
+    { "TR.83", 2857 },
+    { "NG.36", 2051 },
+    { "GY.11", 1076 },
+    { "FJ.03", 887 },
+    { "RU.01", 2490 },
+    { "US.GA", 3060 },
+    { "LV.08", 1614 },
+    { "QA.00", 2381 },
+    { "CL.05", 539 },
+    { "MX.11", 1955 },
+    { "KR.21", 1462 },
+    { "AR.08", 98 },
+    { "MW.25", 1914 },
+    { "MR.11", 1881 },
+    { "GQ.09", 1028 },
+    { "PE.02", 2139 },
+    { "MD.84", 1677 },
+    { "CI.67", 517 },
+    { "UZ.14", 3127 },
+    { "IR.25", 1272 },
+    { "GW.00", 1063 },
+    { "BY.02", 399 },
+    { "CU.04", 645 },
+    { "VN.67", 3170 },
+    { "MK.B5", 1716 },
+    { "KR.12", 1469 },
+    { "NP.03", 2103 },
+    { "TR.81", 2882 },
+    { "TH.35", 2760 },
+    { "VN.81", 3198 },
+    { "VU.15", 3226 },
+    { "RW.08", 2530 },
+    { "SO.10", 2638 },
+    { "ET.13", 868 },
+    { "LY.52", 1643 },
+    { "MY.08", 1975 },
+    { "EC.17", 787 },
+    { "NO.11", 2088 },
+    { "LV.33", 1604 },
+    { "AO.17", 75 },
+    { "LU.02", 1583 },
+    { "RU.07", 2482 },
+    { "HU.04", 1133 },
+    { "VN.53", 3200 },
+    { "IN.12", 1213 },
+    { "PH.66", 2200 },
+    { "AW.00", 135 },
+    { "BF.70", 243 },
+    { "SL.01", 2620 },
+    { "EG.19", 833 },
+    { "LY.62", 1628 },
+    { "US.KY", 3053 },
+    { "KM.01", 1436 },
+    { "IQ.01", 1255 },
+    { "TH.38", 2796 },
+    { "HU.05", 1146 },
+    { "TD.11", 2701 },
+    { "SO.13", 2647 },
+    { "JP.43", 1351 },
+    { "RO.22", 2409 },
+    { "CF.09", 451 },
+    { "AD.03", 5 },
+    { "LA.00", 1508 },
+    { "RO.21", 2391 },
+    { "IR.02", 1281 },
+    { "LT.64", 1572 },
+    { "AG.05", 46 },
+    { "DO.31", 729 },
+    { "GN.29", 989 },
+    { "AZ.08", 149 },
+    { "YE.01", 3233 },
+    { "MK.55", 1769 },
+    { "AO.02", 91 },
+    { "RU.23", 2461 },
+    { "MM.17", 1837 },
+    { "RO.13", 2401 },
+    { "IR.11", 1289 },
+    { "HR.17", 1101 },
+    { "KG.06", 1413 },
+    { "MG.02", 1699 },
+    { "ZA.03", 3241 },
+    { "CN.16", 579 },
+    { "LY.11", 1623 },
+    { "DE.02", 673 },
+    { "SN.05", 2630 },
+    { "MD.58", 1669 },
+    { "IN.29", 1246 },
+    { "ID.08", 1156 },
+    { "PT.23", 2361 },
+    { "ID.18", 1154 },
+    { "AM.04", 67 },
+    { "GT.12", 1053 },
+    { "HN.16", 1090 },
+    { "LA.19", 1494 },
+    { "MF.00", 1697 },
+    { "SO.19", 2642 },
+    { "TN.19", 2838 },
+    { "ID.24", 1169 },
+    { "EC.03", 783 },
+    { "SG.00", 2603 },
+    { "GN.05", 1018 },
+    { "CH.ZG", 472 },
+    { "KG.01", 1416 },
+    { "AF.10", 22 },
+    { "ES.54", 844 },
+    { "AZ.42", 176 },
+    { "UG.86", 3011 },
+    { "BG.51", 287 },
+    { "CM.10", 556 },
+    { "ZA.02", 3247 },
+    { "JP.11", 1390 },
+    { "MD.57", 1667 },
+    { "AZ.25", 189 },
+    { "NG.26", 2036 },
+    { "KR.17", 1460 },
+    { "LA.26", 1505 },
+    { "CD.09", 429 },
+    { "UZ.13", 3129 },
+    { "NI.06", 2070 },
+    { "MW.12", 1918 },
+    { "MK.65", 1762 },
+    { "MK.23", 1797 },
+    { "MW.09", 1921 },
+    { "DO.15", 712 },
+    { "EG.26", 819 },
+    { "IR.08", 1279 },
+    { "AT.02", 123 },
+    { "AL.50", 58 },
+    { "RO.29", 2410 },
+    { "SA.17", 2542 },
+    { "MY.06", 1961 },
+    { "PH.37", 2210 },
+    { "LY.30", 1635 },
+    { "GN.09", 1014 },
+    { "NO.17", 2094 },
+    { "FR.B9", 910 },
+    { "PE.10", 2144 },
+    { "IS.38", 1300 },
+    { "BF.52", 255 },
+    { "TL.00", 2809 },
+    { "PH.C6", 2248 },
+    { "AT.04", 125 },
+    { "SD.59", 2581 },
+    { "CF.07", 448 },
+    { "GQ.08", 1033 },
+    { "JP.26", 1376 },
+    { "CO.16", 598 },
+    { "GA.02", 924 },
+    { "MD.66", 1692 },
+    { "DZ.29", 764 },
+    { "BF.64", 257 },
+    { "DO.03", 718 },
+    { "GW.12", 1062 },
+    { "BB.06", 208 },
+    { "BT.06", 382 },
+    { "IQ.07", 1260 },
+    { "HT.14", 1126 },
+    { "GM.01", 987 },
+    { "AZ.43", 144 },
+    { "MW.08", 1901 },
+    { "IN.39", 1230 },
+    { "TR.90", 2888 },
+    { "UA.09", 2981 },
+    { "HN.08", 1081 },
+    { "MR.03", 1879 },
+    { "US.AR", 3058 },
+    { "TR.73", 2887 },
+    { "TH.02", 2735 },
+    { "UG.74", 2994 },
+    { "MK.51", 1773 },
+    { "MX.17", 1936 },
+    { "VN.35", 3175 },
+    { "SE.27", 2584 },
+    { "CI.89", 516 },
+    { "BG.45", 289 },
+    { "LR.16", 1559 },
+    { "MA.45", 1659 },
+    { "SD.37", 2563 },
+    { "RU.49", 2468 },
+    { "CR.01", 624 },
+    { "CN.29", 572 },
+    { "CI.30", 508 },
+    { "CU.13", 644 },
+    { "BF.47", 242 },
+    { "RU.79", 2510 },
+    { "TT.11", 2922 },
+    { "RU.24", 2486 },
+    { "VN.49", 3186 },
+    { "MK.76", 1750 },
+    { "GH.11", 967 },
+    { "EC.04", 791 },
+    { "PY.23", 2380 },
+    { "SY.08", 2678 },
+    { "AZ.37", 181 },
+    { "AR.15", 115 },
+    { "LA.25", 1509 },
+    { "VE.07", 3142 },
+    { "DZ.38", 772 },
+    { "MY.15", 1967 },
+    { "ID.15", 1164 },
+    { "IQ.10", 1256 },
+    { "LB.05", 1514 },
+    { "NG.42", 2033 },
+    { "IT.12", 1319 },
+    { "PH.B5", 2304 },
+    { "AL.47", 56 },
+    { "JP.23", 1361 },
+    { "GI.00", 977 },
+    { "LV.27", 1598 },
+    { "TD.09", 2711 },
+    { "AL.51", 49 },
+    { "ES.58", 854 },
+    { "EC.18", 782 },
+    { "WS.00", 3228 },
+    { "PH.B7", 2260 },
+    { "DO.10", 725 },
+    { "LS.14", 1565 },
+    { "AL.48", 55 },
+    { "TZ.16", 2941 },
+    { "SE.05", 2585 },
+    { "BG.58", 267 },
+    { "PH.10", 2242 },
+    { "TR.40", 2889 },
+    { "KZ.03", 1481 },
+    { "TH.66", 2793 },
+    { "LA.24", 1499 },
+    { "JP.19", 1352 },
+    { "PY.17", 2368 },
+    { "AD.02", 6 },
+    { "AZ.19", 192 },
+    { "BS.33", 370 },
+    { "CI.80", 497 },
+    { "NE.02", 2010 },
+    { "US.RI", 3080 },
+    { "PH.02", 2244 },
+    { "UG.82", 3026 },
+    { "AL.40", 52 },
+    { "SD.38", 2554 },
+    { "LV.09", 1611 },
+    { "TG.05", 2722 },
+    { "MK.45", 1779 },
+    { "SD.31", 2553 },
+    { "BH.05", 296 },
+    { "PH.55", 2191 },
+    { "CM.11", 549 },
+    { "CZ.87", 665 },
+    { "MK.58", 1766 },
+    { "VN.66", 3199 },
+    { "MM.06", 1846 },
+    { "BR.22", 350 },
+    { "GN.17", 1006 },
+    { "NI.14", 2067 },
+    { "BG.56", 280 },
+    { "MD.92", 1668 },
+    { "IE.07", 1192 },
+    { "BI.18", 313 },
+    { "KH.20", 1424 },
+    { "PT.16", 2348 },
+    { "PH.47", 2208 },
+    { "LI.05", 1531 },
+    { "BF.48", 252 },
+    { "NI.11", 2060 },
+    { "CU.09", 632 },
+    { "PG.11", 2163 },
+    { "BF.54", 264 },
+    { "SC.00", 2547 },
+    { "US.IL", 3061 },
+    { "LB.06", 1512 },
+    { "US.PA", 3067 },
+    { "TR.55", 2886 },
+    { "AF.23", 36 },
+    { "ET.09", 869 },
+    { "LR.10", 1555 },
+    { "KP.12", 1445 },
+    { "VE.01", 3151 },
+    { "DM.04", 703 },
+    { "PH.18", 2249 },
+    { "UA.19", 2975 },
+    { "NL.04", 2077 },
+    { "DE.10", 682 },
+    { "JP.27", 1385 },
+    { "CO.23", 617 },
+    { "TR.80", 2866 },
+    { "RU.63", 2515 },
+    { "LR.20", 1547 },
+    { "TH.50", 2732 },
+    { "GY.13", 1073 },
+    { "KZ.04", 1476 },
+    { "UZ.15", 3117 },
+    { "VN.65", 3181 },
+    { "RO.30", 2415 },
+    { "MD.73", 1663 },
+    { "UG.61", 2996 },
+    { "IR.34", 1296 },
+    { "MW.03", 1924 },
+    { "RU.05", 2516 },
+    { "TN.35", 2823 },
+    { "CO.21", 603 },
+    { "DK.15", 699 },
+    { "TH.54", 2785 },
+    { "RU.72", 2450 },
+    { "BJ.17", 319 },
+    { "MV.00", 1898 },
+    { "PT.06", 2351 },
+    { "ZA.", 3249 },
+    { "AR.18", 112 },
+    { "CI.78", 509 },
+    { "PH.A1", 2278 },
+    { "MX.16", 1946 },
+    { "NL.10", 2081 },
+    { "BF.50", 249 },
+    { "PH.43", 2206 },
+    { "SD.42", 2580 },
+    { "PG.05", 2174 },
+    { "MC.00", 1660 },
+    { "IS.39", 1304 },
+    { "PH.46", 2184 },
+    { "IE.10", 1186 },
+    { "IN.11", 1219 },
+    { "DZ.10", 762 },
+    { "PT.20", 2357 },
+    { "TR.72", 2847 },
+    { "SE.06", 2593 },
+    { "RO.07", 2428 },
+    { "UA.05", 2961 },
+    { "TR.52", 2904 },
+    { "PL.", 2336 },
+    { "FO.OS", 898 },
+    { "FR.A3", 904 },
+    { "ES.55", 853 },
+    { "MK.C5", 1706 },
+    { "MX.23", 1940 },
+    { "PG.12", 2175 },
+    { "CN.18", 563 },
+    { "BY.05", 405 },
+    { "MR.12", 1885 },
+    { "CA.04", 422 },
+    { "MD.71", 1689 },
+    { "IR.35", 1275 },
+    { "NA.28", 1989 },
+    { "PG.08", 2177 },
+    { "CZ.81", 661 },
+    { "TT.08", 2919 },
+    { "SV.06", 2665 },
+    { "BR.28", 353 },
+    { "LI.09", 1527 },
+    { "CI.84", 513 },
+    { "CG.04", 458 },
+    { "MK.78", 1749 },
+    { "TR.02", 2867 },
+    { "DO.29", 730 },
+    { "DO.26", 728 },
+    { "UY.01", 3104 },
+    { "GE.27", 953 },
+    { "AZ.36", 146 },
+    { "BD.00", 209 },
+    { "SO.18", 2650 },
+    { "TH.48", 2772 },
+    { "MK.B1", 1722 },
+    { "HR.04", 1107 },
+    { "UY.10", 3110 },
+    { "MW.18", 1911 },
+    { "CY.02", 655 },
+    { "CO.01", 618 },
+    { "SR.19", 2660 },
+    { "MD.68", 1691 },
+    { "VN.05", 3212 },
+    { "QA.01", 2387 },
+    { "HU.11", 1130 },
+    { "PH.68", 2280 },
+    { "PY.12", 2370 },
+    { "KH.16", 1419 },
+    { "FM.04", 889 },
+    { "NG.48", 2052 },
+    { "BR.29", 360 },
+    { "NZ.E8", 2118 },
+    { "BF.51", 260 },
+    { "TN.02", 2825 },
+    { "CI.70", 526 },
+    { "DE.08", 675 },
+    { "US.MA", 3072 },
+    { "NG.23", 2042 },
+    { "FR.A1", 918 },
+    { "MM.00", 1847 },
+    { "UG.42", 3021 },
+    { "GE.61", 941 },
+    { "VE.12", 3137 },
+    { "MK.B4", 1821 },
+    { "PH.H2", 2225 },
+    { "SD.58", 2560 },
+    { "JM.02", 1333 },
+    { "PG.13", 2176 },
+    { "NG.28", 2032 },
+    { "CA.10", 414 },
+    { "NC.00", 2004 },
+    { "UG.18", 3014 },
+    { "SK.05", 2608 },
+    { "EC.24", 794 },
+    { "TO.01", 2840 },
+    { "LR.21", 1558 },
+    { "PH.E3", 2286 },
+    { "SV.12", 2675 },
+    { "TD.07", 2712 },
+    { "KR.10", 1466 },
+    { "PE.08", 2150 },
+    { "PH.G6", 2307 },
+    { "DZ.18", 745 },
+    { "US.MN", 3076 },
+    { "GT.06", 1054 },
+    { "RU.75", 2498 },
+    { "AZ.32", 147 },
+    { "CD.12", 427 },
+    { "KE.08", 1405 },
+    { "BY.04", 404 },
+    { "PE.14", 2143 },
+    { "KP.06", 1443 },
+    { "TH.71", 2752 },
+    { "MK.10", 1808 },
+    { "UG.34", 3031 },
+    { "PH.B2", 2251 },
+    { "MK.42", 1781 },
+    { "IQ.12", 1258 },
+    { "PH.61", 2226 },
+    { "ZA.07", 3242 },
+    { "MG.01", 1703 },
+    { "CO.37", 600 },
+    { "ID.36", 1168 },
+    { "TD.12", 2699 },
+    { "AZ.03", 157 },
+    { "PY.24", 2378 },
+    { "TH.51", 2777 },
+    { "SE.15", 2602 },
+    { "MD.75", 1682 },
+    { "CN.24", 578 },
+    { "CF.03", 442 },
+    { "DZ.31", 751 },
+    { "SA.15", 2544 },
+    { "HN.13", 1092 },
+    { "ET.05", 871 },
+    { "CI.00", 498 },
+    { "KP.14", 1441 },
+    { "LV.10", 1588 },
+    { "MG.04", 1698 },
+    { "AG.06", 45 },
+    { "PH.35", 2196 },
+    { "MK.34", 1788 },
+    { "CI.79", 506 },
+    { "SY.07", 2684 },
+    { "BF.59", 234 },
+    { "AE.01", 13 },
+    { "MA.49", 1650 },
+    { "GT.17", 1049 },
+    { "DO.08", 719 },
+    { "RU.04", 2501 },
+    { "IL.05", 1210 },
+    { "RS.02", 2434 },
+    { "KP.00", 1448 },
+    { "NG.57", 2025 },
+    { "SD.54", 2556 },
+    { "AF.35", 33 },
+    { "RO.32", 2413 },
+    { "UG.78", 3033 },
+    { "US.VT", 3082 },
+    { "TG.02", 2723 },
+    { "BB.01", 205 },
+    { "MA.51", 1648 },
+    { "AF.22", 38 },
+    { "SK.08", 2612 },
+    { "PY.08", 2372 },
+    { "RS.00", 2432 },
+    { "RU.32", 2502 },
+    { "TC.00", 2697 },
+    { "LR.22", 1549 },
+    { "SO.22", 2653 },
+    { "AO.03", 83 },
+    { "MW.05", 1904 },
+    { "GD.02", 937 },
+    { "TH.58", 2746 },
+    { "SK.07", 2613 },
+    { "UA.01", 2965 },
+    { "CO.19", 601 },
+    { "CL.11", 542 },
+    { "FJ.05", 886 },
+    { "LY.34", 1645 },
+    { "TZ.15", 2936 },
+    { "TR.12", 2856 },
+    { "TM.05", 2815 },
+    { "BI.13", 305 },
+    { "VN.47", 3188 },
+    { "MK.97", 1730 },
+    { "HU.02", 1141 },
+    { "HU.20", 1128 },
+    { "PL.74", 2323 },
+    { "IN.22", 1243 },
+    { "NO.19", 2085 },
+    { "KZ.17", 1485 },
+    { "CZ.78", 660 },
+    { "TH.07", 2744 },
+    { "PS.WE", 2341 },
+    { "TR.78", 2892 },
+    { "PA.07", 2132 },
+    { "SO.03", 2641 },
+    { "US.WV", 3069 },
+    { "CN.12", 574 },
+    { "MN.24", 1865 },
+    { "LV.04", 1589 },
+    { "SY.12", 2686 },
+    { "NI.18", 2069 },
+    { "MN.09", 1849 },
+    { "SI.00", 2605 },
+    { "PA.01", 2136 },
+    { "AZ.18", 152 },
+    { "KH.03", 1431 },
+    { "PE.19", 2151 },
+    { "EG.02", 825 },
+    { "GN.23", 999 },
+    { "MX.08", 1957 },
+    { "BS.25", 369 },
+    { "TR.69", 2915 },
+    { "IE.04", 1179 },
+    { "LT.59", 1577 },
+    { "PH.27", 2297 },
+    { "IR.09", 1269 },
+    { "YE.23", 3234 },
+    { "PA.08", 2130 },
+    { "KP.15", 1447 },
+    { "RU.69", 2481 },
+    { "PR.00", 2339 },
+    { "AD.07", 7 },
+    { "KR.16", 1456 },
+    { "DZ.15", 743 },
+    { "LY.05", 1629 },
+    { "GM.07", 983 },
+    { "BW.08", 397 },
+    { "BR.20", 348 },
+    { "MW.29", 1915 },
+    { "UG.67", 3036 },
+    { "ES.", 849 },
+    { "GT.13", 1040 },
+    { "RU.", 2496 },
+    { "CG.06", 463 },
+    { "AD.04", 4 },
+    { "JM.09", 1334 },
+    { "LC.08", 1519 },
+    { "TR.28", 2908 },
+    { "BJ.10", 321 },
+    { "MK.B6", 1714 },
+    { "AF.09", 21 },
+    { "CI.11", 525 },
+    { "IS.40", 1298 },
+    { "MW.00", 1916 },
+    { "MK.35", 1787 },
+    { "BR.25", 368 },
+    { "FI.06", 881 },
+    { "GN.35", 1023 },
+    { "RU.73", 2467 },
+    { "RU.67", 2480 },
+    { "GD.04", 939 },
+    { "JP.22", 1363 },
+    { "GN.08", 991 },
+    { "RU.18", 2513 },
+    { "CH.TG", 488 },
+    { "CA.07", 418 },
+    { "NA.13", 1997 },
+    { "UZ.05", 3128 },
+    { "AU.03", 128 },
+    { "DZ.13", 754 },
+    { "SE.08", 2588 },
+    { "RO.08", 2427 },
+    { "PY.15", 2367 },
+    { "NG.05", 2038 },
+    { "HR.08", 1116 },
+    { "PH.E2", 2257 },
+    { "YE.13", 3230 },
+    { "TH.14", 2761 },
+    { "GA.08", 922 },
+    { "GT.22", 1044 },
+    { "SH.", 2604 },
+    { "SN.07", 2629 },
+    { "EG.24", 815 },
+    { "UG.58", 3002 },
+    { "NG.32", 2045 },
+    { "AO.05", 79 },
+    { "MR.02", 1882 },
+    { "VN.71", 3220 },
+    { "US.NC", 3064 },
+    { "CI.16", 510 },
+    { "US.LA", 3054 },
+    { "BO.05", 338 },
+    { "CH.GE", 483 },
+    { "NE.08", 2009 },
+    { "NL.02", 2074 },
+    { "DZ.39", 763 },
+    { "NI.03", 2064 },
+    { "BF.36", 230 },
+    { "ET.11", 862 },
+    { "SY.06", 2683 },
+    { "SD.40", 2574 },
+    { "TH.04", 2797 },
+    { "BY.03", 402 },
+    { "NZ.F7", 2109 },
+    { "TH.16", 2745 },
+    { "SN.09", 2631 },
+    { "TM.04", 2814 },
+    { "IE.15", 1197 },
+    { "GT.03", 1041 },
+    { "KH.01", 1433 },
+    { "LC.06", 1521 },
+    { "MK.A3", 1819 },
+    { "VN.32", 3180 },
+    { "LR.15", 1548 },
+    { "PT.14", 2345 },
+    { "RU.14", 2514 },
+    { "CN.15", 561 },
+    { "GN.06", 1017 },
+    { "IR.32", 1290 },
+    { "AL.49", 57 },
+    { "LS.15", 1564 },
+    { "AL.44", 60 },
+    { "DZ.06", 767 },
+    { "JP.05", 1394 },
+    { "IR.04", 1297 },
+    { "TH.75", 2762 },
+    { "RO.33", 2411 },
+    { "ZW.03", 3260 },
+    { "US.NH", 3079 },
+    { "SZ.00", 2692 },
+    { "CN.20", 585 },
+    { "MA.57", 1651 },
+    { "HU.14", 1145 },
+    { "RW.05", 2534 },
+    { "LY.54", 1617 },
+    { "MY.11", 1974 },
+    { "DZ.53", 750 },
+    { "JP.02", 1387 },
+    { "UG.29", 3037 },
+    { "RS.01", 2433 },
+    { "GL.02", 979 },
+    { "JP.45", 1368 },
+    { "CF.18", 455 },
+    { "UY.19", 3098 },
+    { "IE.22", 1200 },
+    { "MK.49", 1775 },
+    { "US.DE", 3049 },
+    { "MW.13", 1917 },
+    { "JM.12", 1340 },
+    { "ZW.05", 3264 },
+    { "BI.02", 304 },
+    { "LV.17", 1601 },
+    { "IN.05", 1248 },
+    { "IN.21", 1234 },
+    { "TR.62", 2869 },
+    { "UA.18", 2984 },
+    { "KR.20", 1461 },
+    { "RU.86", 2438 },
+    { "NI.01", 2061 },
+    { "FR.B4", 901 },
+    { "KH.02", 1432 },
+    { "CR.06", 628 },
+    { "BJ.07", 324 },
+    { "TT.10", 2926 },
+    { "SA.00", 2538 },
+    { "DO.27", 736 },
+    { "RO.27", 2404 },
+    { "LC.09", 1518 },
+    { "CM.12", 551 },
+    { "PH.C3", 2197 },
+    { "AZ.29", 153 },
+    { "YE.20", 3237 },
+    { "ZW.08", 3262 },
+    { "JP.00", 1392 },
+    { "PE.01", 2147 },
+    { "TH.18", 2764 },
+    { "HU.01", 1134 },
+    { "VE.14", 3152 },
+    { "BF.45", 258 },
+    { "MY.09", 1972 },
+    { "NZ.G1", 2107 },
+    { "AU.05", 127 },
+    { "TF.00", 2713 },
+    { "EE.19", 801 },
+    { "MX.32", 1949 },
+    { "JP.04", 1388 },
+    { "AZ.35", 143 },
+    { "MW.26", 1927 },
+    { "TR.46", 2885 },
+    { "SV.14", 2667 },
+    { "LK.33", 1541 },
+    { "PH.E4", 2217 },
+    { "RU.36", 2524 },
+    { "UZ.16", 3125 },
+    { "GH.02", 972 },
+    { "MY.13", 1965 },
+    { "NG.31", 2015 },
+    { "CF.00", 438 },
+    { "BJ.00", 316 },
+    { "IN.10", 1222 },
+    { "IR.33", 1292 },
+    { "AF.28", 27 },
+    { "KR.11", 1465 },
+    { "MD.89", 1673 },
+    { "FR.A4", 913 },
+    { "UY.02", 3105 },
+    { "UZ.00", 3123 },
+    { "GT.01", 1046 },
+    { "SY.03", 2691 },
+    { "AM.01", 66 },
+    { "GT.18", 1050 },
+    { "RW.02", 2535 },
+    { "ZM.07", 3251 },
+    { "NZ.F2", 2111 },
+    { "TZ.17", 2939 },
+    { "PS.GZ", 2340 },
+    { "ML.06", 1824 },
+    { "JP.09", 1384 },
+    { "JP.29", 1359 },
+    { "PT.02", 2358 },
+    { "DK.13", 698 },
+    { "NI.15", 2059 },
+    { "EG.11", 830 },
+    { "UG.33", 3032 },
+    { "FI.14", 882 },
+    { "BG.60", 282 },
+    { "JP.41", 1360 },
+    { "PH.E1", 2290 },
+    { "PH.71", 2207 },
+    { "SN.01", 2633 },
+    { "MH.00", 1704 },
+    { "PT.19", 2350 },
+    { "MU.00", 1897 },
+    { "RO.03", 2416 },
+    { "PL.75", 2321 },
+    { "TR.87", 2918 },
+    { "TR.09", 2854 },
+    { "AU.08", 129 },
+    { "ID.14", 1161 },
+    { "PH.G1", 2283 },
+    { "HR.09", 1111 },
+    { "GE.", 962 },
+    { "EE.14", 808 },
+    { "CU.12", 641 },
+    { "SV.11", 2669 },
+    { "CI.90", 505 },
+    { "KG.07", 1410 },
+    { "AO.06", 84 },
+    { "VN.51", 3179 },
+    { "CF.01", 440 },
+    { "MX.04", 1943 },
+    { "AU.01", 134 },
+    { "VN.62", 3207 },
+    { "DZ.00", 739 },
+    { "MX.18", 1954 },
+    { "AR.14", 97 },
+    { "PG.07", 2170 },
+    { "BR.30", 343 },
+    { "FR.A5", 902 },
+    { "UZ.08", 3118 },
+    { "BF.33", 246 },
+    { "KG.03", 1412 },
+    { "BJ.11", 318 },
+    { "BW.09", 394 },
+    { "CN.33", 580 },
+    { "BY.07", 403 },
+    { "CI.51", 504 },
+    { "GH.04", 975 },
+    { "CM.14", 558 },
+    { "LT.58", 1578 },
+    { "BT.18", 387 },
+    { "IR.13", 1270 },
+    { "KZ.01", 1488 },
+    { "MK.73", 1753 },
+    { "CA.08", 419 },
+    { "ID.41", 1174 },
+    { "CN.04", 573 },
+    { "RU.47", 2444 },
+    { "ES.31", 845 },
+    { "KP.17", 1452 },
+    { "AT.09", 124 },
+    { "PH.E7", 2256 },
+    { "ST.02", 2663 },
+    { "CO.03", 613 },
+    { "GT.02", 1058 },
+    { "MX.13", 1935 },
+    { "AZ.58", 166 },
+    { "PY.05", 2363 },
+    { "GF.GF", 963 },
+    { "MK.89", 1738 },
+    { "KR.03", 1467 },
+    { "NI.02", 2065 },
+    { "BR.04", 349 },
+    { "VN.82", 3192 },
+    { "OM.07", 2126 },
+    { "CO.04", 609 },
+    { "UY.15", 3114 },
+    { "AR.09", 99 },
+    { "MK.52", 1772 },
+    { "PT.22", 2354 },
+    { "AF.03", 28 },
+    { "CL.02", 547 },
+    { "BW.11", 393 },
+    { "HR.21", 1104 },
+    { "BR.27", 355 },
+    { "AR.24", 110 },
+    { "BJ.12", 325 },
+    { "EG.18", 816 },
+    { "VN.09", 3182 },
+    { "NZ.00", 2105 },
+    { "CN.25", 564 },
+    { "SE.21", 2596 },
+    { "CN.03", 583 },
+    { "CD.00", 426 },
+    { "AZ.01", 170 },
+    { "SV.13", 2672 },
+    { "HR.", 1117 },
+    { "IT.11", 1323 },
+    { "MC.", 1661 },
+    { "MS.01", 1886 },
+    { "LR.12", 1550 },
+    { "NE.01", 2012 },
+    { "TN.32", 2831 },
+    { "JP.", 1399 },
+    { "BG.53", 278 },
+    { "PH.F1", 2281 },
+    { "SE.09", 2587 },
+    { "MD.90", 1671 },
+    { "BG.52", 270 },
+    { "CO.35", 596 },
+    { "IE.29", 1199 },
+    { "KE.03", 1402 },
+    { "CY.05", 650 },
+    { "CI.18", 514 },
+    { "RO.04", 2430 },
+    { "ZA.11", 3248 },
+    { "KR.18", 1468 },
+    { "PH.C1", 2287 },
+    { "AZ.57", 167 },
+    { "JM.10", 1331 },
+    { "CN.09", 568 },
+    { "HU.", 1147 },
+    { "PH.B8", 2262 },
+    { "PY.03", 2376 },
+    { "MA.52", 1653 },
+    { "KH.06", 1426 },
+    { "PH.39", 2221 },
+    { "VN.83", 3166 },
+    { "PY.11", 2371 },
+    { "GQ.05", 1032 },
+    { "MK.30", 1792 },
+    { "RU.88", 2487 },
+    { "LY.13", 1641 },
+    { "UA.11", 2960 },
+    { "US.AK", 3091 },
+    { "NU.00", 2104 },
+    { "DZ.21", 752 },
+    { "NG.00", 2016 },
+    { "PH.26", 2253 },
+    { "TH.76", 2768 },
+    { "BI.05", 303 },
+    { "RW.01", 2536 },
+    { "PH.F3", 2276 },
+    { "PK.08", 2318 },
+    { "CD.04", 428 },
+    { "SV.02", 2666 },
+    { "GB.NIR", 933 },
+    { "LK.34", 1537 },
+    { "PH.E5", 2285 },
+    { "LV.02", 1615 },
+    { "TR.61", 2898 },
+    { "LS.19", 1569 },
+    { "GL.03", 978 },
+    { "GA.09", 923 },
+    { "TH.28", 2783 },
+    { "TR.22", 2903 },
+    { "TW.04", 2929 },
+    { "VG.00", 3158 },
+    { "TR.07", 2842 },
+    { "AZ.60", 162 },
+    { "LV.14", 1608 },
+    { "GR.ESYE21", 1037 },
+    { "LV.23", 1600 },
+    { "UG.31", 3020 },
+    { "CY.03", 652 },
+    { "RU.66", 2466 },
+    { "US.NV", 3089 },
+    { "MA.50", 1654 },
+    { "MR.08", 1878 },
+    { "TN.06", 2819 },
+    { "UG.30", 3034 },
+    { "MN.12", 1852 },
+    { "US.OH", 3056 },
+    { "HR.03", 1098 },
+    { "ID.37", 1162 },
+    { "LY.50", 1644 },
+    { "JO.16", 1350 },
+    { "RO.00", 2389 },
+    { "GT.07", 1045 },
+    { "VN.56", 3195 },
+    { "MK.09", 1809 },
+    { "IL.04", 1209 },
+    { "RU.CI", 2449 },
+    { "UG.56", 3005 },
+    { "VE.22", 3138 },
+    { "TH.08", 2733 },
+    { "MN.18", 1862 },
+    { "US.CA", 3085 },
+    { "DO.09", 734 },
+    { "BG.46", 274 },
+    { "TH.63", 2747 },
+    { "PA.02", 2128 },
+    { "GN.30", 1019 },
+    { "ES.56", 855 },
+    { "AF.36", 40 },
+    { "DE.13", 671 },
+    { "CG.12", 466 },
+    { "MX.30", 1931 },
+    { "MM.11", 1841 },
+    { "DZ.01", 740 },
+    { "KW.02", 1472 },
+    { "PH.56", 2224 },
+    { "DZ.09", 757 },
+    { "MQ.00", 1874 },
+    { "NG.44", 2029 },
+    { "BA.00", 202 },
+    { "ML.08", 1823 },
+    { "UG.87", 3010 },
+    { "AT.08", 122 },
+    { "JP.06", 1380 },
+    { "IR.38", 1280 },
+    { "JO.18", 1341 },
+    { "PT.05", 2360 },
+    { "VN.74", 3218 },
+    { "ZA.09", 3246 },
+    { "BF.60", 256 },
+    { "IR.30", 1278 },
+    { "HU.03", 1129 },
+    { "IQ.13", 1257 },
+    { "MK.03", 1815 },
+    { "ZW.00", 3259 },
+    { "IR.23", 1271 },
+    { "CZ.83", 666 },
+    { "SD.48", 2578 },
+    { "IE.", 1188 },
+    { "RU.33", 2445 },
+    { "KI.00", 1434 },
+    { "ID.11", 1170 },
+    { "SM.09", 2622 },
+    { "ES.39", 859 },
+    { "AZ.62", 163 },
+    { "CI.20", 511 },
+    { "RU.74", 2512 },
+    { "SY.11", 2682 },
+    { "HT.03", 1125 },
+    { "BI.17", 301 },
+    { "JP.42", 1365 },
+    { "NE.03", 2011 },
+    { "MW.22", 1905 },
+    { "PE.23", 2154 },
+    { "IQ.04", 1264 },
+    { "IT.20", 1311 },
+    { "AZ.65", 139 },
+    { "TN.37", 2818 },
+    { "SD.35", 2567 },
+    { "BO.07", 336 },
+    { "PY.04", 2365 },
+    { "MX.12", 1930 },
+    { "CO.02", 594 },
+    { "HR.10", 1106 },
+    { "EC.15", 780 },
+    { "VE.21", 3141 },
+    { "PH.67", 2201 },
+    { "HR.01", 1100 },
+    { "MK.07", 1811 },
+    { "VE.19", 3154 },
+    { "VE.09", 3144 },
+    { "MN.08", 1859 },
+    { "ML.00", 1822 },
+    { "LT.60", 1576 },
+    { "VN.85", 3174 },
+    { "MU.17", 1889 },
+    { "BY.00", 400 },
+    { "HK.00", 1077 },
+    { "KH.10", 1420 },
+    { "TR.86", 2914 },
+    { "CI.76", 503 },
+    { "GD.05", 934 },
+    { "FR.97", 900 },
+    { "CF.08", 444 },
+    { "IQ.09", 1265 },
+    { "JO.12", 1348 },
+    { "PH.06", 2220 },
+    { "CI.69", 519 },
+    { "PY.19", 2366 },
+    { "DE.03", 684 },
+    { "BE.BRU", 218 },
+    { "GB.WLS", 930 },
+    { "HU.16", 1135 },
+    { "GN.12", 1012 },
+    { "LV.19", 1586 },
+    { "TV.00", 2928 },
+    { "CH.GR", 485 },
+    { "CY.01", 649 },
+    { "MK.31", 1791 },
+    { "TR.70", 2894 },
+    { "CN.14", 560 },
+    { "BJ.13", 326 },
+    { "BF.57", 233 },
+    { "BT.00", 384 },
+    { "UY.14", 3101 },
+    { "RW.07", 2531 },
+    { "GR.ESYE43", 1034 },
+    { "HN.01", 1091 },
+    { "SO.04", 2652 },
+    { "NI.07", 2066 },
+    { "ZA.05", 3243 },
+    { "GE.28", 945 },
+    { "BE.WAL", 217 },
+    { "RU.21", 2471 },
+    { "MM.16", 1836 },
+    { "DO.02", 715 },
+    { "VN.54", 3191 },
+    { "JP.12", 1397 },
+    { "IE.12", 1194 },
+    { "PH.C4", 2302 },
+    { "UZ.03", 3121 },
+    { "RU.17", 2476 },
+    { "MK.48", 1776 },
+    { "IN.02", 1218 },
+    { "PH.51", 2183 },
+    { "LC.01", 1524 },
+    { "BB.08", 207 },
+    { "LY.42", 1616 },
+    { "TR.54", 2911 },
+    { "TH.30", 2778 },
+    { "BF.71", 250 },
+    { "MA.54", 1646 },
+    { "EC.07", 781 },
+    { "MK.C1", 1710 },
+    { "GH.03", 969 },
+    { "SY.10", 2679 },
+    { "PH.58", 2272 },
+    { "PH.C7", 2289 },
+    { "ER.06", 838 },
+    { "GN.02", 1021 },
+    { "CA.12", 425 },
+    { "DZ.30", 758 },
+    { "UG.83", 3022 },
+    { "BO.04", 335 },
+    { "KZ.05", 1489 },
+    { "PG.09", 2180 },
+    { "AZ.14", 154 },
+    { "BT.21", 378 },
+    { "NF.00", 2013 },
+    { "BT.13", 383 },
+    { "IT.13", 1310 },
+    { "NO.02", 2095 },
+    { "US.MI", 3074 },
+    { "UG.79", 3035 },
+    { "PH.F8", 2259 },
+    { "BF.46", 226 },
+    { "JP.03", 1398 },
+    { "VN.20", 3172 },
+    { "SR.16", 2656 },
+    { "MX.07", 1952 },
+    { "LS.13", 1567 },
+    { "NG.30", 2041 },
+    { "CO.17", 604 },
+    { "US.OR", 3094 },
+    { "PT.09", 2343 },
+    { "UG.77", 3040 },
+    { "IQ.16", 1262 },
+    { "TR.48", 2858 },
+    { "MK.54", 1770 },
+    { "GN.32", 1010 },
+    { "CH.", 468 },
+    { "CN.22", 587 },
+    { "US.SD", 3081 },
+    { "TR.74", 2881 },
+    { "LV.26", 1592 },
+    { "GQ.07", 1030 },
+    { "TR.35", 2864 },
+    { "AR.21", 96 },
+    { "AZ.04", 197 },
+    { "HN.17", 1095 },
+    { "RO.23", 2421 },
+    { "VE.26", 3153 },
+    { "MW.23", 1903 },
+    { "PK.02", 2314 },
+    { "IN.33", 1240 },
+    { "NG.53", 2053 },
+    { "MA.58", 1649 },
+    { "US.SC", 3057 },
+    { "AZ.47", 193 },
+    { "JO.23", 1346 },
+    { "TN.03", 2836 },
+    { "CZ.52", 669 },
+    { "RU.31", 2508 },
+    { "NZ.E7", 2108 },
+    { "IE.14", 1204 },
+    { "PL.80", 2326 },
+    { "TZ.12", 2943 },
+    { "CN.05", 589 },
+    { "JM.16", 1338 },
+    { "KR.01", 1470 },
+    { "ZM.09", 3258 },
+    { "TH.29", 2776 },
+    { "MW.04", 1902 },
+    { "TO.02", 2839 },
+    { "GP.GP", 1024 },
+    { "YE.16", 3232 },
+    { "MD.86", 1676 },
+    { "AL.45", 50 },
+    { "MK.14", 1804 },
+    { "LR.17", 1553 },
+    { "HR.11", 1115 },
+    { "JM.13", 1336 },
+    { "DO.12", 737 },
+    { "PY.06", 2364 },
+    { "PM.975", 2337 },
+    { "AO.13", 86 },
+    { "IN.", 1249 },
+    { "BI.14", 308 },
+    { "MY.07", 1968 },
+    { "TN.14", 2826 },
+    { "CO.32", 597 },
+    { "CU.03", 636 },
+    { "AF.29", 17 },
+    { "CN.32", 565 },
+    { "RU.27", 2469 },
+    { "ET.48", 876 },
+    { "MK.63", 1806 },
+    { "UA.03", 2977 },
+    { "EE.04", 804 },
+    { "IQ.11", 1254 },
+    { "TH.34", 2800 },
+    { "NG.25", 2050 },
+    { "AR.05", 101 },
+    { "TZ.10", 2946 },
+    { "EG.21", 818 },
+    { "SD.47", 2577 },
+    { "DZ.55", 765 },
+    { "UY.13", 3100 },
+    { "CU.08", 642 },
+    { "MK.62", 1784 },
+    { "CO.31", 620 },
+    { "GB.ENG", 931 },
+    { "AZ.67", 199 },
+    { "SD.34", 2557 },
+    { "GN.03", 995 },
+    { "VN.43", 3216 },
+    { "AR.22", 106 },
+    { "LS.10", 1560 },
+    { "FR.B3", 917 },
+    { "HU.17", 1139 },
+    { "ZM.06", 3256 },
+    { "AE.05", 9 },
+    { "MR.06", 1877 },
+    { "GN.14", 992 },
+    { "LI.11", 1525 },
+    { "BS.28", 375 },
+    { "FM.01", 891 },
+    { "SA.20", 2545 },
+    { "TH.15", 2731 },
+    { "UA.13", 2974 },
+    { "UG.97", 2989 },
+    { "PH.C8", 2288 },
+    { "EG.09", 814 },
+    { "IE.02", 1203 },
+    { "GE.10", 958 },
+    { "BW.04", 389 },
+    { "EE.11", 795 },
+    { "ET.07", 873 },
+    { "IE.31", 1180 },
+    { "PH.21", 2218 },
+    { "IE.19", 1202 },
+    { "MW.16", 1909 },
+    { "SE.16", 2595 },
+    { "JP.20", 1391 },
+    { "CL.07", 538 },
+    { "MK.88", 1739 },
+    { "LC.10", 1517 },
+    { "OM.08", 2124 },
+    { "IT.06", 1314 },
+    { "TD.04", 2704 },
+    { "GQ.00", 1026 },
+    { "NG.43", 2044 },
+    { "TZ.18", 2938 },
+    { "BN.00", 332 },
+    { "MK.67", 1760 },
+    { "UG.69", 3023 },
+    { "SE.14", 2583 },
+    { "MK.38", 1785 },
+    { "CN.01", 581 },
+    { "CH.BL", 467 },
+    { "BG.57", 266 },
+    { "IR.15", 1284 },
+    { "RU.03", 2509 },
+    { "TR.10", 2876 },
+    { "ML.09", 1827 },
+    { "LY.41", 1630 },
+    { "NG.21", 2023 },
+    { "RU.JA", 2526 },
+    { "AF.39", 32 },
+    { "PH.G7", 2185 },
+    { "KM.00", 1438 },
+    { "VN.61", 3168 },
+    { "AZ.49", 142 },
+    { "MK.71", 1755 },
+    { "RU.65", 2457 },
+    { "VN.63", 3185 },
+    { "MD.61", 1694 },
+    { "MX.15", 1929 },
+    { "VN.07", 3215 },
+    { "VN.58", 3165 },
+    { "PA.04", 2135 },
+    { "GN.36", 1002 },
+    { "MV.26", 1900 },
+    { "BF.58", 237 },
+    { "AI.00", 48 },
+    { "TH.20", 2781 },
+    { "MK.B2", 1718 },
+    { "AZ.71", 159 },
+    { "TD.02", 2698 },
+    { "ID.30", 1165 },
+    { "IL.06", 1205 },
+    { "NO.16", 2096 },
+    { "IT.05", 1312 },
+    { "PH.65", 2250 },
+    { "TD.06", 2705 },
+    { "IN.17", 1223 },
+    { "MD.51", 1665 },
+    { "ZW.02", 3266 },
+    { "HU.21", 1136 },
+    { "OM.04", 2121 },
+    { "DZ.26", 755 },
+    { "AU.02", 131 },
+    { "JM.14", 1327 },
+    { "MK.72", 1754 },
+    { "AZ.56", 141 },
+    { "PH.F9", 2271 },
+    { "GH.08", 974 },
+    { "CH.TI", 482 },
+    { "IN.01", 1242 },
+    { "MD.59", 1680 },
+    { "DZ.25", 768 },
+    { "MA.56", 1658 },
+    { "IE.11", 1189 },
+    { "SD.53", 2561 },
+    { "TH.77", 2803 },
+    { "NO.15", 2100 },
+    { "GH.10", 971 },
+    { "AZ.15", 136 },
+    { "CI.17", 518 },
+    { "GY.18", 1075 },
+    { "VN.03", 3217 },
+    { "TZ.00", 2935 },
+    { "AU.04", 130 },
+    { "PL.77", 2324 },
+    { "AM.09", 72 },
+    { "PY.16", 2374 },
+    { "TN.30", 2833 },
+    { "HN.03", 1080 },
+    { "JP.31", 1377 },
+    { "CN.07", 567 },
+    { "TZ.04", 2951 },
+    { "FO.SU", 894 },
+    { "KZ.12", 1482 },
+    { "LV.20", 1606 },
+    { "BT.10", 386 },
+    { "ES.34", 856 },
+    { "SK.04", 2615 },
+    { "TR.04", 2874 },
+    { "HU.24", 1140 },
+    { "AR.07", 100 },
+    { "BF.19", 232 },
+    { "ER.03", 840 },
+    { "TJ.01", 2808 },
+    { "BF.21", 259 },
+    { "GT.10", 1057 },
+    { "MK.40", 1782 },
+    { "TH.17", 2773 },
+    { "LS.18", 1561 },
+    { "BR.31", 364 },
+    { "BF.66", 223 },
+    { "DE.14", 678 },
+    { "CD.11", 433 },
+    { "BR.05", 351 },
+    { "PH.41", 2213 },
+    { "US.NE", 3078 },
+    { "GM.03", 985 },
+    { "VN.64", 3208 },
+    { "AN.00", 73 },
+    { "NZ.F5", 2110 },
+    { "DZ.50", 742 },
+    { "VN.78", 3210 },
+    { "IS.45", 1302 },
+    { "BI.12", 310 },
+    { "CN.31", 586 },
+    { "LT.56", 1580 },
+    { "BZ.03", 412 },
+    { "DO.20", 724 },
+    { "MM.13", 1839 },
+    { "CN.02", 569 },
+    { "TZ.20", 2954 },
+    { "WF.00", 3227 },
+    { "PG.03", 2181 },
+    { "LV.06", 1612 },
+    { "TH.67", 2782 },
+    { "AO.01", 90 },
+    { "MK.92", 1735 },
+    { "TH.56", 2726 },
+    { "AZ.10", 195 },
+    { "BF.55", 262 },
+    { "PK.06", 2313 },
+    { "PG.18", 2166 },
+    { "UG.94", 3045 },
+    { "YT.00", 3239 },
+    { "KZ.13", 1483 },
+    { "MM.15", 1832 },
+    { "BJ.16", 320 },
+    { "RO.09", 2426 },
+    { "AZ.69", 137 },
+    { "EG.05", 810 },
+    { "RO.11", 2425 },
+    { "TG.23", 2719 },
+    { "MR.05", 1884 },
+    { "CI.47", 528 },
+    { "FM.03", 890 },
+    { "GE.40", 942 },
+    { "CU.14", 631 },
+    { "DZ.37", 760 },
+    { "MM.12", 1840 },
+    { "NA.29", 1992 },
+    { "BZ.02", 408 },
+    { "IT.19", 1324 },
+    { "DO.18", 716 },
+    { "PE.07", 2161 },
+    { "AF.01", 35 },
+    { "CO.24", 615 },
+    { "AZ.13", 155 },
+    { "SE.12", 2589 },
+    { "EC.19", 789 },
+    { "IN.32", 1247 },
+    { "TR.53", 2913 },
+    { "TD.01", 2703 },
+    { "DZ.04", 748 },
+    { "TH.69", 2758 },
+    { "QA.06", 2384 },
+    { "BF.74", 244 },
+    { "HT.11", 1122 },
+    { "FR.B1", 899 },
+    { "RU.48", 2465 },
+    { "AF.17", 29 },
+    { "AU.07", 132 },
+    { "ZW.06", 3263 },
+    { "SK.06", 2614 },
+    { "MN.17", 1870 },
+    { "TT.06", 2923 },
+    { "BO.01", 340 },
+    { "KN.10", 1439 },
+    { "PH.17", 2186 },
+    { "DO.14", 731 },
+    { "PE.17", 2157 },
+    { "TR.77", 2917 },
+    { "PH.60", 2270 },
+    { "MX.22", 1942 },
+    { "TM.01", 2812 },
+    { "US.OK", 3066 },
+    { "TR.03", 2878 },
+    { "CR.04", 630 },
+    { "CH.GL", 492 },
+    { "LA.23", 1501 },
+    { "IT.07", 1318 },
+    { "QA.04", 2386 },
+    { "LS.16", 1563 },
+    { "JE.00", 1326 },
+    { "PH.B6", 2303 },
+    { "SL.04", 2621 },
+    { "BG.50", 291 },
+    { "LY.53", 1633 },
+    { "YE.02", 3238 },
+    { "FR.A2", 907 },
+    { "UA.21", 2962 },
+    { "DE.04", 685 },
+    { "KM.03", 1435 },
+    { "TN.34", 2824 },
+    { "ID.12", 1173 },
+    { "IT.15", 1308 },
+    { "MM.09", 1835 },
+    { "TM.03", 2813 },
+    { "SI.61", 2606 },
+    { "KE.06", 1403 },
+    { "BO.03", 337 },
+    { "SY.13", 2688 },
+    { "VN.70", 3161 },
+    { "LV.22", 1602 },
+    { "PH.72", 2237 },
+    { "AO.12", 80 },
+    { "IQ.18", 1251 },
+    { "TR.34", 2901 },
+    { "KZ.15", 1479 },
+    { "IT.18", 1325 },
+    { "FR.B5", 906 },
+    { "CA.02", 413 },
+    { "PH.A4", 2310 },
+    { "EE.21", 796 },
+    { "TH.55", 2786 },
+    { "TD.05", 2707 },
+    { "PH.H3", 2199 },
+    { "ES.32", 857 },
+    { "CL.08", 544 },
+    { "NL.07", 2080 },
+    { "MD.80", 1681 },
+    { "GN.13", 1011 },
+    { "AS.00", 117 },
+    { "ZW.04", 3261 },
+    { "MZ.00", 1983 },
+    { "NA.36", 2002 },
+    { "NO.06", 2093 },
+    { "TH.49", 2769 },
+    { "AU.06", 133 },
+    { "EG.27", 835 },
+    { "DZ.48", 756 },
+    { "MZ.01", 1981 },
+    { "DO.04", 733 },
+    { "PE.13", 2140 },
+    { "CH.SO", 473 },
+    { "AF.13", 31 },
+    { "NA.21", 1990 },
+    { "CI.75", 499 },
+    { "MK.26", 1795 },
+    { "BG.47", 273 },
+    { "NA.06", 2001 },
+    { "HT.10", 1119 },
+    { "CD.08", 435 },
+    { "BD.82", 215 },
+    { "NG.10", 2047 },
+    { "DJ.01", 690 },
+    { "PL.73", 2329 },
+    { "MK.64", 1763 },
+    { "TR.16", 2855 },
+    { "MZ.07", 1987 },
+    { "SO.01", 2637 },
+    { "LI.06", 1530 },
+    { "BR.08", 358 },
+    { "SY.02", 2687 },
+    { "UZ.10", 3119 },
+    { "SD.51", 2573 },
+    { "RU.59", 2517 },
+    { "CO.27", 612 },
+    { "SK.02", 2616 },
+    { "ES.27", 858 },
+    { "UG.26", 3041 },
+    { "CI.74", 529 },
+    { "PH.40", 2195 },
+    { "NG.16", 2027 },
+    { "US.TN", 3068 },
+    { "EC.09", 777 },
+    { "RU.06", 2479 },
+    { "HU.06", 1132 },
+    { "UZ.01", 3130 },
+    { "NG.22", 2048 },
+    { "RU.28", 2489 },
+    { "CH.AI", 491 },
+    { "TH.61", 2740 },
+    { "AM.11", 69 },
+    { "LK.31", 1539 },
+    { "CI.07", 527 },
+    { "US.MO", 3062 },
+    { "TN.22", 2828 },
+    { "TR.05", 2910 },
+    { "KH.00", 1417 },
+    { "DZ.20", 753 },
+    { "UY.17", 3108 },
+    { "LA.01", 1507 },
+    { "PE.22", 2142 },
+    { "BJ.18", 328 },
+    { "TH.73", 2770 },
+    { "IE.13", 1191 },
+    { "DO.21", 738 },
+    { "GT.08", 1048 },
+    { "DK.17", 697 },
+    { "MK.B3", 1717 },
+    { "IS.42", 1301 },
+    { "RO.01", 2431 },
+    { "NL.03", 2073 },
+    { "GM.02", 984 },
+    { "GE.31", 951 },
+    { "UG.40", 3024 },
+    { "GE.04", 948 },
+    { "LY.27", 1638 },
+    { "BR.07", 365 },
+    { "AR.10", 108 },
+    { "GE.22", 943 },
+    { "AF.07", 43 },
+    { "MK.91", 1736 },
+    { "CY.04", 651 },
+    { "LK.32", 1542 },
+    { "TG.22", 2716 },
+    { "RU.34", 2458 },
+    { "RU.30", 2518 },
+    { "RU.78", 2504 },
+    { "UA.12", 2987 },
+    { "BG.38", 272 },
+    { "MK.84", 1743 },
+    { "CI.61", 515 },
+    { "GN.18", 988 },
+    { "NL.06", 2075 },
+    { "EG.17", 826 },
+    { "US.UT", 3086 },
+    { "BA.01", 201 },
+    { "CD.05", 432 },
+    { "BF.78", 245 },
+    { "SV.04", 2670 },
+    { "AM.02", 62 },
+    { "BF.42", 253 },
+    { "RU.37", 2492 },
+    { "NO.20", 2097 },
+    { "SO.08", 2640 },
+    { "VN.55", 3197 },
+    { "RU.70", 2460 },
+    { "CO.12", 608 },
+    { "MG.06", 1701 },
+    { "RO.20", 2419 },
+    { "GW.04", 1064 },
+    { "CI.83", 495 },
+    { "IR.07", 1285 },
+    { "HN.09", 1087 },
+    { "UG.84", 3018 },
+    { "VU.10", 3225 },
+    { "IL.01", 1207 },
+    { "BW.05", 392 },
+    { "KY.00", 1473 },
+    { "BF.65", 231 },
+    { "GN.33", 1005 },
+    { "MW.24", 1926 },
+    { "GN.10", 1013 },
+    { "AG.00", 47 },
+    { "GE.15", 952 },
+    { "VN.79", 3204 },
+    { "TR.65", 2861 },
+    { "PH.A3", 2311 },
+    { "JM.11", 1332 },
+    { "HT.07", 1121 },
+    { "DM.05", 704 },
+    { "ET.01", 867 },
+    { "CI.85", 532 },
+    { "GT.11", 1042 },
+    { "VA.", 3131 },
+    { "MV.40", 1899 },
+    { "MG.03", 1702 },
+    { "UA.16", 2983 },
+    { "LI.07", 1529 },
+    { "AZ.44", 171 },
+    { "MD.83", 1678 },
+    { "DO.01", 709 },
+    { "RU.43", 2474 },
+    { "TH.80", 2788 },
+    { "CO.20", 599 },
+    { "BG.29", 292 },
+    { "HN.18", 1083 },
+    { "DO.19", 713 },
+    { "SD.52", 2569 },
+    { "KZ.16", 1486 },
+    { "NA.32", 1996 },
+    { "HN.07", 1082 },
+    { "SE.25", 2591 },
+    { "SV.05", 2664 },
+    { "JP.33", 1373 },
+    { "SY.05", 2685 },
+    { "AM.10", 61 },
+    { "BG.55", 281 },
+    { "LA.17", 1503 },
+    { "TZ.08", 2944 },
+    { "DE.12", 676 },
+    { "TH.64", 2729 },
+    { "EG.06", 834 },
+    { "TZ.07", 2959 },
+    { "MN.01", 1855 },
+    { "SN.11", 2627 },
+    { "DJ.08", 692 },
+    { "MD.62", 1693 },
+    { "EG.16", 828 },
+    { "IT.01", 1321 },
+    { "DO.11", 732 },
+    { "RU.20", 2505 },
+    { "LY.29", 1636 },
+    { "SN.13", 2635 },
+    { "GE.38", 949 },
+    { "MP.00", 1872 },
+    { "RO.31", 2392 },
+    { "TR.19", 2905 },
+    { "EE.05", 807 },
+    { "PA.10", 2133 },
+    { "SE.03", 2601 },
+    { "CV.17", 647 },
+    { "VE.18", 3140 },
+    { "PH.08", 2309 },
+    { "EH.00", 836 },
+    { "RU.64", 2493 },
+    { "LV.07", 1610 },
+    { "CR.02", 625 },
+    { "TH.44", 2794 },
+    { "BF.76", 235 },
+    { "IR.37", 1293 },
+    { "AZ.26", 188 },
+    { "IN.38", 1237 },
+    { "TG.00", 2721 },
+    { "NI.17", 2056 },
+    { "MG.05", 1700 },
+    { "NL.01", 2076 },
+    { "UY.09", 3113 },
+    { "KH.05", 1429 },
+    { "GA.01", 925 },
+    { "SR.13", 2659 },
+    { "BT.19", 380 },
+    { "IT.10", 1322 },
+    { "PH.C9", 2230 },
+    { "US.TX", 3047 },
+    { "PL.83", 2328 },
+    { "PH.B9", 2305 },
+    { "SZ.01", 2694 },
+    { "LA.18", 1495 },
+    { "GN.39", 994 },
+    { "PH.49", 2238 },
+    { "DM.07", 705 },
+    { "BR.03", 352 },
+    { "LA.03", 1492 },
+    { "TZ.27", 2955 },
+    { "UG.93", 2995 },
+    { "IN.16", 1220 },
+    { "PA.03", 2129 },
+    { "CO.08", 606 },
+    { "ID.31", 1158 },
+    { "MK.20", 1800 },
+    { "GN.04", 1020 },
+    { "MK.85", 1742 },
+    { "MK.C3", 1708 },
+    { "TJ.03", 2806 },
+    { "JP.07", 1355 },
+    { "FR.C1", 903 },
+    { "CG.01", 461 },
+    { "BF.56", 247 },
+    { "SZ.04", 2696 },
+    { "KE.09", 1400 },
+    { "CI.12", 524 },
+    { "TR.45", 2868 },
+    { "LK.29", 1540 },
+    { "OM.02", 2122 },
+    { "CU.10", 643 },
+    { "RO.19", 2405 },
+    { "TH.78", 2799 },
+    { "PA.09", 2131 },
+    { "SE.07", 2599 },
+    { "IN.13", 1229 },
+    { "IN.14", 1245 },
+    { "PG.20", 2168 },
+    { "MK.C2", 1709 },
+    { "MK.79", 1748 },
+    { "YE.08", 3229 },
+    { "TH.59", 2737 },
+    { "NO.07", 2086 },
+    { "BH.08", 297 },
+    { "AR.13", 109 },
+    { "DO.33", 711 },
+    { "AM.00", 64 },
+    { "LY.55", 1619 },
+    { "UA.06", 2978 },
+    { "DZ.14", 744 },
+    { "PH.09", 2194 },
+    { "PH.62", 2229 },
+    { "BW.01", 390 },
+    { "MM.04", 1845 },
+    { "CH.JU", 490 },
+    { "UZ.09", 3116 },
+    { "PK.03", 2315 },
+    { "KZ.06", 1478 },
+    { "DO.30", 721 },
+    { "AZ.51", 172 },
+    { "GT.14", 1043 },
+    { "UA.17", 2976 },
+    { "TR.41", 2896 },
+    { "GN.01", 1022 },
+    { "RO.34", 2407 },
+    { "BS.29", 373 },
+    { "RU.71", 2483 },
+    { "SR.14", 2654 },
+    { "US.WI", 3083 },
+    { "ES.29", 852 },
+    { "CO.22", 605 },
+    { "MN.21", 1868 },
+    { "LT.", 1581 },
+    { "AZ.20", 191 },
+    { "JM.08", 1330 },
+    { "MD.69", 1662 },
+    { "CF.17", 453 },
+    { "FM.02", 892 },
+    { "FO.VG", 895 },
+    { "TZ.25", 2933 },
+    { "RU.51", 2470 },
+    { "UA.24", 2971 },
+    { "MK.A4", 1725 },
+    { "MX.14", 1947 },
+    { "HU.22", 1143 },
+    { "UG.66", 3039 },
+    { "CI.62", 523 },
+    { "IR.05", 1295 },
+    { "MW.19", 1910 },
+    { "ET.53", 870 },
+    { "VN.80", 3187 },
+    { "TH.13", 2771 },
+    { "SE.23", 2582 },
+    { "HU.09", 1144 },
+    { "LV.25", 1599 },
+    { "MK.60", 1790 },
+    { "LB.07", 1515 },
+    { "RO.40", 2422 },
+    { "RU.10", 2452 },
+    { "MK.A7", 1721 },
+    { "CH.VS", 480 },
+    { "CO.11", 610 },
+    { "CM.09", 555 },
+    { "UG.85", 3015 },
+    { "TZ.03", 2952 },
+    { "MK.24", 1759 },
+    { "JP.44", 1354 },
+    { "PH.", 2263 },
+    { "NG.56", 2035 },
+    { "KW.00", 1471 },
+    { "IE.24", 1195 },
+    { "AZ.46", 175 },
+    { "LY.02", 1625 },
+    { "RW.09", 2529 },
+    { "JP.36", 1366 },
+    { "SD.56", 2575 },
+    { "MD.76", 1686 },
+    { "PK.05", 2312 },
+    { "GE.09", 959 },
+    { "IT.03", 1306 },
+    { "MN.20", 1854 },
+    { "BE.VLG", 216 },
+    { "BJ.08", 317 },
+    { "RO.37", 2402 },
+    { "LB.11", 1516 },
+    { "TH.37", 2784 },
+    { "MN.13", 1858 },
+    { "BI.10", 302 },
+    { "OM.00", 2123 },
+    { "CD.03", 431 },
+    { "PH.38", 2188 },
+    { "VN.52", 3201 },
+    { "JM.04", 1328 },
+    { "RO.12", 2390 },
+    { "CF.16", 447 },
+    { "SO.20", 2649 },
+    { "SE.22", 2597 },
+    { "TZ.21", 2949 },
+    { "NG.29", 2040 },
+    { "FK.00", 888 },
+    { "SV.01", 2671 },
+    { "MK.22", 1798 },
+    { "TN.17", 2837 },
+    { "IN.34", 1226 },
+    { "JP.25", 1381 },
+    { "MM.07", 1838 },
+    { "FO.SA", 896 },
+    { "RU.60", 2491 },
+    { "JP.30", 1372 },
+    { "EE.13", 805 },
+    { "AZ.70", 160 },
+    { "DZ.03", 749 },
+    { "BF.49", 225 },
+    { "TR.59", 2909 },
+    { "GT.20", 1039 },
+    { "KH.07", 1418 },
+    { "MK.56", 1768 },
+    { "MX.24", 1937 },
+    { "CH.OW", 489 },
+    { "TM.02", 2810 },
+    { "GW.02", 1068 },
+    { "TZ.06", 2945 },
+    { "LY.25", 1618 },
+    { "CZ.82", 656 },
+    { "IN.20", 1215 },
+    { "GE.36", 950 },
+    { "HN.06", 1078 },
+    { "PT.08", 2342 },
+    { "SR.12", 2655 },
+    { "ET.54", 865 },
+    { "RU.61", 2442 },
+    { "TD.14", 2709 },
+    { "KM.02", 1437 },
+    { "NA.35", 2003 },
+    { "CY.06", 653 },
+    { "VE.25", 3155 },
+    { "MU.15", 1888 },
+    { "HU.23", 1137 },
+    { "RU.46", 2441 },
+    { "RO.16", 2406 },
+    { "SE.10", 2594 },
+    { "ID.29", 1159 },
+    { "IE.16", 1196 },
+    { "PL.78", 2320 },
+    { "RO.25", 2408 },
+    { "PG.06", 2173 },
+    { "MZ.05", 1978 },
+    { "AM.08", 63 },
+    { "TH.47", 2749 },
+    { "PH.G8", 2273 },
+    { "ID.26", 1149 },
+    { "ML.07", 1828 },
+    { "CH.AR", 479 },
+    { "CU.07", 635 },
+    { "PH.D5", 2266 },
+    { "MK.66", 1761 },
+    { "TZ.19", 2942 },
+    { "FR.99", 919 },
+    { "IE.30", 1181 },
+    { "EC.23", 779 },
+    { "PH.D1", 2299 },
+    { "PH.13", 2223 },
+    { "AF.37", 34 },
+    { "AR.06", 94 },
+    { "GT.21", 1047 },
+    { "EE.20", 798 },
+    { "VU.07", 3222 },
+    { "UG.00", 2998 },
+    { "CH.UR", 494 },
+    { "MX.01", 1959 },
+    { "UG.50", 3012 },
+    { "GN.07", 1016 },
+    { "ES.59", 850 },
+    { "LV.29", 1609 },
+    { "AZ.50", 173 },
+    { "CM.13", 557 },
+    { "VN.50", 3205 },
+    { "DJ.07", 689 },
+    { "TR.33", 2853 },
+    { "SD.49", 2565 },
+    { "PA.05", 2127 },
+    { "CU.16", 637 },
+    { "BY.06", 398 },
+    { "MW.17", 1912 },
+    { "PL.76", 2333 },
+    { "CN.19", 571 },
+    { "AO.16", 78 },
+    { "SV.03", 2677 },
+    { "SO.06", 2644 },
+    { "SO.09", 2646 },
+    { "GL.01", 980 },
+    { "BD.83", 213 },
+    { "BW.06", 391 },
+    { "BR.13", 342 },
+    { "CN.13", 562 },
+    { "RU.54", 2507 },
+    { "PT.18", 2349 },
+    { "BM.03", 331 },
+    { "SK.00", 2609 },
+    { "MA.53", 1652 },
+    { "TW.", 2932 },
+    { "UG.80", 3030 },
+    { "BT.08", 381 },
+    { "AZ.09", 158 },
+    { "NO.14", 2090 },
+    { "FR.A7", 908 },
+    { "GT.04", 1059 },
+    { "EC.06", 786 },
+    { "IT.17", 1317 },
+    { "HR.18", 1097 },
+    { "JM.01", 1335 },
+    { "IQ.05", 1259 },
+    { "KP.03", 1449 },
+    { "US.CO", 3087 },
+    { "CG.08", 464 },
+    { "VN.37", 3193 },
+    { "VE.15", 3147 },
+    { "AO.08", 89 },
+    { "LV.15", 1597 },
+    { "UZ.12", 3120 },
+    { "GT.19", 1052 },
+    { "JP.47", 1383 },
+    { "TH.65", 2728 },
+    { "MQ.MQ", 1873 },
+    { "ID.28", 1157 },
+    { "FR.B7", 909 },
+    { "BF.28", 240 },
+    { "RU.39", 2499 },
+    { "IT.02", 1309 },
+    { "PH.07", 2277 },
+    { "PY.07", 2377 },
+    { "PG.04", 2169 },
+    { "MN.19", 1850 },
+    { "MK.61", 1764 },
+    { "MK.59", 1765 },
+    { "SM.01", 2625 },
+    { "CO.33", 591 },
+    { "GE.59", 961 },
+    { "TH.36", 2765 },
+    { "BD.81", 210 },
+    { "IR.29", 1276 },
+    { "PH.16", 2247 },
+    { "MZ.08", 1979 },
+    { "TR.43", 2871 },
+    { "AF.05", 30 },
+    { "IR.36", 1274 },
+    { "SN.15", 2636 },
+    { "SD.55", 2579 },
+    { "MK.28", 1793 },
+    { "MK.39", 1783 },
+    { "NZ.E9", 2114 },
+    { "ID.02", 1155 },
+    { "ER.00", 837 },
+    { "EE.07", 802 },
+    { "SD.26", 2568 },
+    { "TR.84", 2912 },
+    { "TD.15", 2708 },
+    { "BD.86", 211 },
+    { "NA.33", 1999 },
+    { "IN.26", 1233 },
+    { "BR.23", 361 },
+    { "MD.82", 1679 },
+    { "MK.27", 1794 },
+    { "TR.14", 2899 },
+    { "MK.16", 1802 },
+    { "PY.10", 2369 },
+    { "PE.24", 2137 },
+    { "VE.08", 3145 },
+    { "CO.30", 621 },
+    { "HN.02", 1094 },
+    { "KP.01", 1453 },
+    { "CN.28", 570 },
+    { "CX.00", 648 },
+    { "PK.07", 2319 },
+    { "UY.07", 3102 },
+    { "TH.19", 2751 },
+    { "PH.14", 2232 },
+    { "TH.57", 2725 },
+    { "ES.52", 851 },
+    { "ID.06", 1160 },
+    { "GH.00", 966 },
+    { "RO.14", 2424 },
+    { "CF.05", 439 },
+    { "JO.02", 1342 },
+    { "UG.59", 3000 },
+    { "VN.48", 3213 },
+    { "TN.31", 2832 },
+    { "MZ.06", 1982 },
+    { "TN.23", 2827 },
+    { "VE.04", 3139 },
+    { "LV.01", 1603 },
+    { "JP.37", 1369 },
+    { "RU.38", 2477 },
+    { "GE.25", 954 },
+    { "EC.22", 792 },
+    { "NG.52", 2020 },
+    { "DE.05", 672 },
+    { "BS.23", 371 },
+    { "LY.18", 1642 },
+    { "MW.07", 1922 },
+    { "ET.02", 863 },
+    { "IR.01", 1283 },
+    { "CD.06", 436 },
+    { "AF.11", 15 },
+    { "RU.85", 2446 },
+    { "UG.45", 3017 },
+    { "SD.27", 2555 },
+    { "CH.FR", 481 },
+    { "NO.01", 2091 },
+    { "KH.15", 1425 },
+    { "CH.NE", 486 },
+    { "IE.18", 1201 },
+    { "GD.06", 935 },
+    { "CR.07", 629 },
+    { "RU.44", 2523 },
+    { "CO.10", 607 },
+    { "DM.03", 708 },
+    { "PH.F7", 2279 },
+    { "NI.10", 2058 },
+    { "SZ.03", 2695 },
+    { "DO.25", 717 },
+    { "PL.87", 2332 },
+    { "SR.10", 2662 },
+    { "MK.A5", 1724 },
+    { "UA.14", 2980 },
+    { "TG.17", 2717 },
+    { "UG.28", 3038 },
+    { "KN.03", 1440 },
+    { "RU.62", 2437 },
+    { "KR.05", 1458 },
+    { "UG.60", 2997 },
+    { "SY.14", 2680 },
+    { "MN.14", 1864 },
+    { "MK.C4", 1707 },
+    { "SL.03", 2618 },
+    { "EC.02", 793 },
+    { "SD.43", 2548 },
+    { "GQ.03", 1027 },
+    { "CF.12", 452 },
+    { "MX.21", 1932 },
+    { "BF.20", 219 },
+    { "BG.44", 293 },
+    { "AZ.22", 190 },
+    { "TR.32", 2875 },
+    { "AE.07", 8 },
+    { "UG.38", 3028 },
+    { "ET.06", 875 },
+    { "AZ.34", 182 },
+    { "HR.13", 1102 },
+    { "TR.08", 2897 },
+    { "US.ME", 3073 },
+    { "ET.08", 866 },
+    { "US.AL", 3046 },
+    { "CA.11", 420 },
+    { "PH.42", 2228 },
+    { "BS.26", 377 },
+    { "IE.20", 1182 },
+    { "EE.12", 806 },
+    { "FI.08", 880 },
+    { "TZ.02", 2950 },
+    { "CL.01", 536 },
+    { "BM.06", 330 },
+    { "CF.04", 454 },
+    { "IE.25", 1193 },
+    { "VN.34", 3173 },
+    { "KG.04", 1415 },
+    { "AR.23", 103 },
+    { "GA.07", 929 },
+    { "VN.73", 3219 },
+    { "AO.15", 77 },
+    { "LR.18", 1551 },
+    { "EG.03", 821 },
+    { "GB.SCT", 932 },
+    { "GW.05", 1069 },
+    { "TR.13", 2873 },
+    { "TN.00", 2817 },
+    { "TN.38", 2822 },
+    { "ML.03", 1830 },
+    { "CK.00", 534 },
+    { "MZ.04", 1985 },
+    { "CF.14", 443 },
+    { "NG.51", 2022 },
+    { "CA.05", 421 },
+    { "RS.", 2435 },
+    { "MA.47", 1657 },
+    { "DZ.40", 747 },
+    { "CO.28", 602 },
+    { "TR.49", 2860 },
+    { "IS.43", 1303 },
+    { "PH.50", 2198 },
+    { "TH.60", 2724 },
+    { "HN.05", 1089 },
+    { "UZ.07", 3124 },
+    { "IN.24", 1224 },
+    { "MU.16", 1890 },
+    { "TH.06", 2730 },
+    { "PE.25", 2146 },
+    { "LV.18", 1596 },
+    { "UA.00", 2986 },
+    { "MY.14", 1973 },
+    { "GN.11", 1008 },
+    { "AZ.39", 179 },
+    { "MK.B8", 1712 },
+    { "PH.D6", 2264 },
+    { "RU.52", 2473 },
+    { "PH.57", 2222 },
+    { "TZ.13", 2934 },
+    { "NZ.F1", 2116 },
+    { "SD.46", 2552 },
+    { "UG.92", 3044 },
+    { "UY.11", 3112 },
+    { "JO.13", 1349 },
+    { "MK.99", 1728 },
+    { "HR.02", 1108 },
+    { "LA.16", 1504 },
+    { "NG.45", 2024 },
+    { "ML.01", 1831 },
+    { "VU.13", 3224 },
+    { "PT.04", 2356 },
+    { "KR.14", 1455 },
+    { "DM.06", 702 },
+    { "FJ.01", 885 },
+    { "VN.59", 3190 },
+    { "VE.13", 3149 },
+    { "MA.46", 1655 },
+    { "TD.08", 2706 },
+    { "IR.03", 1286 },
+    { "RO.42", 2396 },
+    { "TN.18", 2835 },
+    { "LT.00", 1570 },
+    { "EE.01", 800 },
+    { "BO.02", 339 },
+    { "BR.15", 359 },
+    { "NL.11", 2072 },
+    { "GN.15", 1009 },
+    { "IN.09", 1228 },
+    { "AM.06", 71 },
+    { "PL.72", 2331 },
+    { "TR.24", 2862 },
+    { "BY.01", 401 },
+    { "AL.42", 59 },
+    { "QA.10", 2385 },
+    { "BF.53", 236 },
+    { "PH.A2", 2291 },
+    { "CI.88", 520 },
+    { "LY.51", 1626 },
+    { "GU.00", 1061 },
+    { "MN.02", 1869 },
+    { "AF.33", 16 },
+    { "TH.22", 2791 },
+    { "GN.25", 996 },
+    { "MK.81", 1746 },
+    { "SR.15", 2657 },
+    { "IQ.02", 1261 },
+    { "ID.21", 1172 },
+    { "PH.32", 2268 },
+    { "MN.03", 1851 },
+    { "CZ.86", 668 },
+    { "PH.C5", 2301 },
+    { "PH.24", 2241 },
+    { "BI.11", 307 },
+    { "AF.26", 18 },
+    { "UG.39", 3025 },
+    { "CM.07", 553 },
+    { "RU.11", 2511 },
+    { "VN.26", 3160 },
+    { "BR.14", 354 },
+    { "DE.16", 686 },
+    { "NZ.B3", 2117 },
+    { "KH.04", 1430 },
+    { "EG.04", 812 },
+    { "MR.07", 1883 },
+    { "ES.07", 848 },
+    { "US.MD", 3055 },
+    { "ZM.01", 3252 },
+    { "CO.25", 616 },
+    { "CM.08", 559 },
+    { "IS.41", 1299 },
+    { "RO.41", 2399 },
+    { "ZM.02", 3257 },
+    { "SO.07", 2648 },
+    { "YE.04", 3236 },
+    { "LY.06", 1627 },
+    { "CH.AG", 470 },
+    { "AT.03", 118 },
+    { "GR.", 1035 },
+    { "CN.06", 584 },
+    { "UG.91", 3043 },
+    { "PH.53", 2254 },
+    { "TN.33", 2830 },
+    { "IQ.14", 1267 },
+    { "AF.30", 25 },
+    { "DE.07", 677 },
+    { "SE.28", 2592 },
+    { "AT.06", 120 },
+    { "PT.10", 2346 },
+    { "TH.39", 2795 },
+    { "CF.15", 449 },
+    { "EG.14", 824 },
+    { "VN.68", 3169 },
+    { "CG.13", 459 },
+    { "RU.16", 2488 },
+    { "HU.18", 1127 },
+    { "LA.07", 1497 },
+    { "PL.86", 2330 },
+    { "MK.57", 1767 },
+    { "VN.76", 3206 },
+    { "TH.24", 2763 },
+    { "EC.10", 775 },
+    { "MD.78", 1685 },
+    { "UG.73", 3003 },
+    { "PE.09", 2160 },
+    { "MK.02", 1816 },
+    { "CI.14", 522 },
+    { "MW.21", 1906 },
+    { "TR.76", 2848 },
+    { "CZ.00", 667 },
+    { "PE.03", 2159 },
+    { "ZA.08", 3245 },
+    { "MD.74", 1687 },
+    { "PE.15", 2153 },
+    { "MY.05", 1970 },
+    { "BB.04", 206 },
+    { "SE.18", 2586 },
+    { "DK.21", 695 },
+    { "MK.53", 1771 },
+    { "PE.11", 2152 },
+    { "MY.12", 1963 },
+    { "VN.46", 3184 },
+    { "GH.05", 973 },
+    { "AO.10", 81 },
+    { "DO.23", 720 },
+    { "NO.09", 2099 },
+    { "KH.12", 1421 },
+    { "RU.25", 2455 },
+    { "MN.25", 1861 },
+    { "DO.32", 710 },
+    { "AT.05", 121 },
+    { "LI.10", 1526 },
+    { "MU.18", 1896 },
+    { "JP.39", 1371 },
+    { "MK.00", 1715 },
+    { "LV.28", 1594 },
+    { "NG.24", 2017 },
+    { "DM.10", 706 },
+    { "TH.26", 2790 },
+    { "BF.15", 241 },
+    { "VN.01", 3194 },
+    { "PE.21", 2149 },
+    { "AZ.02", 198 },
+    { "LS.11", 1568 },
+    { "GD.01", 938 },
+    { "AO.09", 88 },
+    { "TR.26", 2879 },
+    { "MK.05", 1813 },
+    { "HT.13", 1123 },
+    { "AZ.59", 165 },
+    { "IE.26", 1190 },
+    { "PG.14", 2164 },
+    { "AR.12", 116 },
+    { "AZ.68", 161 },
+    { "MU.12", 1892 },
+    { "RU.29", 2497 },
+    { "PH.04", 2227 },
+    { "PH.20", 2239 },
+    { "AT.07", 119 },
+    { "MK.98", 1729 },
+    { "SB.00", 2546 },
+    { "CN.23", 588 },
+    { "DZ.41", 759 },
+    { "VN.45", 3162 },
+    { "MX.25", 1951 },
+    { "PT.11", 2352 },
+    { "PH.B1", 2252 },
+    { "NO.08", 2087 },
+    { "DZ.12", 761 },
+    { "MD.65", 1666 },
+    { "CZ.88", 657 },
+    { "JP.15", 1379 },
+    { "RU.82", 2520 },
+    { "IN.37", 1231 },
+    { "LT.61", 1575 },
+    { "MX.03", 1958 },
+    { "GN.21", 1001 },
+    { "PY.13", 2375 },
+    { "IQ.00", 1268 },
+    { "TH.45", 2766 },
+    { "MN.16", 1856 },
+    { "MK.46", 1778 },
+    { "BH.01", 300 },
+    { "TH.53", 2787 },
+    { "NG.47", 2046 },
+    { "RU.42", 2484 },
+    { "SN.14", 2632 },
+    { "SN.03", 2628 },
+    { "LC.03", 1523 },
+    { "EG.10", 820 },
+    { "ID.07", 1152 },
+    { "CL.04", 537 },
+    { "BF.61", 227 },
+    { "TR.75", 2895 },
+    { "LV.24", 1587 },
+    { "MK.70", 1756 },
+    { "MK.74", 1752 },
+    { "TR.93", 2916 },
+    { "MR.04", 1880 },
+    { "VN.84", 3178 },
+    { "MW.02", 1925 },
+    { "PH.63", 2211 },
+    { "GF.00", 964 },
+    { "BI.19", 311 },
+    { "MK.11", 1807 },
+    { "SD.36", 2562 },
+    { "CH.SG", 469 },
+    { "NG.18", 2026 },
+    { "AF.32", 23 },
+    { "TH.05", 2741 },
+    { "UG.72", 3007 },
+    { "BF.34", 221 },
+    { "TN.16", 2821 },
+    { "SZ.02", 2693 },
+    { "BR.16", 344 },
+    { "PH.12", 2219 },
+    { "JP.28", 1386 },
+    { "KH.13", 1423 },
+    { "NZ.", 2112 },
+    { "CF.11", 445 },
+    { "PE.12", 2156 },
+    { "RO.36", 2393 },
+    { "HN.14", 1085 },
+    { "KP.11", 1442 },
+    { "US.MT", 3093 },
+    { "GW.06", 1067 },
+    { "MN.15", 1860 },
+    { "BS.31", 372 },
+    { "KE.07", 1406 },
+    { "TZ.24", 2940 },
+    { "CZ.79", 662 },
+    { "ZW.07", 3267 },
+    { "CA.01", 415 },
+    { "ES.57", 843 },
+    { "GA.03", 927 },
+    { "PN.", 2338 },
+    { "NI.05", 2068 },
+    { "GA.04", 926 },
+    { "PY.01", 2373 },
+    { "MO.00", 1871 },
+    { "AZ.54", 168 },
+    { "KG.08", 1414 },
+    { "SA.10", 2543 },
+    { "IL.03", 1206 },
+    { "NO.04", 2089 },
+    { "CZ.90", 659 },
+    { "MW.11", 1920 },
+    { "FI.13", 878 },
+    { "US.WY", 3095 },
+    { "IN.18", 1235 },
+    { "UG.96", 2991 },
+    { "MD.85", 1674 },
+    { "TR.39", 2902 },
+    { "BF.62", 224 },
+    { "NO.10", 2092 },
+    { "JP.35", 1362 },
+    { "ID.13", 1171 },
+    { "SO.05", 2651 },
+    { "US.KS", 3052 },
+    { "BF.77", 229 },
+    { "IQ.03", 1263 },
+    { "TH.62", 2738 },
+    { "UG.41", 3004 },
+    { "SV.09", 2674 },
+    { "HN.10", 1086 },
+    { "KP.09", 1444 },
+    { "NG.54", 2034 },
+    { "CO.38", 614 },
+    { "NG.40", 2014 },
+    { "KZ.14", 1480 },
+    { "MX.29", 1941 },
+    { "TH.72", 2757 },
+    { "RO.18", 2403 },
+    { "NO.18", 2084 },
+    { "SD.41", 2564 },
+    { "PH.70", 2189 },
+    { "EC.13", 776 },
+    { "BG.61", 265 },
+    { "BF.40", 251 },
+    { "DM.09", 707 },
+    { "TH.23", 2750 },
+    { "LY.09", 1624 },
+    { "PH.44", 2205 },
+    { "GN.27", 993 },
+    { "CO.26", 595 },
+    { "US.AZ", 3084 },
+    { "EC.05", 784 },
+    { "DO.34", 722 },
+    { "NI.04", 2057 },
+    { "KR.13", 1459 },
+    { "AZ.12", 145 },
+    { "MX.31", 1939 },
+    { "MX.09", 1945 },
+    { "CI.87", 500 },
+    { "VC.01", 3133 },
+    { "CI.86", 521 },
+    { "TZ.22", 2947 },
+    { "TH.43", 2798 },
+    { "AZ.31", 148 },
+    { "AZ.33", 183 },
+    { "GM.05", 982 },
+    { "VN.21", 3183 },
+    { "BG.54", 275 },
+    { "JP.38", 1370 },
+    { "UG.95", 2993 },
+    { "GY.15", 1074 },
+    { "MY.02", 1960 },
+    { "MX.19", 1944 },
+    { "AF.18", 37 },
+    { "PH.E6", 2269 },
+    { "MK.36", 1820 },
+    { "PH.45", 2187 },
+    { "ZA.10", 3240 },
+    { "TH.25", 2775 },
+    { "AD.05", 2 },
+    { "CO.14", 622 },
+    { "BJ.14", 327 },
+    { "RO.17", 2423 },
+    { "TH.68", 2753 },
+    { "EG.01", 813 },
+    { "GT.15", 1055 },
+    { "MZ.03", 1984 },
+    { "MK.B7", 1713 },
+    { "TD.10", 2702 },
+    { "PH.E8", 2284 },
+    { "MM.01", 1842 },
+    { "SE.02", 2600 },
+    { "LA.14", 1500 },
+    { "CO.34", 623 },
+    { "BO.09", 334 },
+    { "RO.02", 2394 },
+    { "RU.02", 2521 },
+    { "ZW.09", 3268 },
+    { "KR.19", 1463 },
+    { "TT.12", 2924 },
+    { "HR.05", 1112 },
+    { "LV.21", 1605 },
+    { "PH.C2", 2300 },
+    { "NP.00", 2102 },
+    { "AZ.48", 174 },
+    { "MD.67", 1684 },
+    { "SR.17", 2661 },
+    { "RU.22", 2459 },
+    { "SD.57", 2570 },
+    { "SA.14", 2539 },
+    { "MX.02", 1953 },
+    { "CL.06", 535 },
+    { "US.WA", 3092 },
+    { "LY.08", 1621 },
+    { "HT.06", 1118 },
+    { "NZ.F9", 2115 },
+    { "UG.46", 3016 },
+    { "PH.G3", 2265 },
+    { "CI.05", 530 },
+    { "TR.00", 2844 },
+    { "MK.96", 1731 },
+    { "BI.20", 315 },
+    { "CH.BS", 493 },
+    { "UG.65", 3042 },
+    { "EG.12", 811 },
+    { "MK.A8", 1720 },
+    { "HN.15", 1079 },
+    { "VN.13", 3203 },
+    { "IN.00", 1227 },
+    { "VC.04", 3132 },
+    { "FI.", 884 },
+    { "VE.06", 3143 },
+    { "EC.11", 788 },
+    { "AR.01", 93 },
+    { "GN.22", 1000 },
+    { "LY.47", 1620 },
+    { "PL.79", 2334 },
+    { "KE.05", 1407 },
+    { "BG.39", 286 },
+    { "KG.02", 1411 },
+    { "GH.09", 970 },
+    { "TH.31", 2774 },
+    { "ID.01", 1150 },
+    { "IT.09", 1315 },
+    { "SD.50", 2571 },
+    { "GQ.04", 1031 },
+    { "CM.04", 550 },
+    { "LK.36", 1536 },
+    { "RW.10", 2527 },
+    { "NA.30", 1995 },
+    { "TH.52", 2736 },
+    { "MK.19", 1801 },
+    { "SE.26", 2590 },
+    { "NA.39", 1998 },
+    { "MT.00", 1887 },
+    { "RU.56", 2448 },
+    { "GE.00", 940 },
+    { "BI.09", 309 },
+    { "AF.08", 39 },
+    { "LY.57", 1640 },
+    { "AZ.16", 164 },
+    { "SA.19", 2541 },
+    { "IQ.15", 1252 },
+    { "TH.42", 2755 },
+    { "IQ.06", 1253 },
+    { "PG.02", 2179 },
+    { "LT.63", 1573 },
+    { "IN.19", 1221 },
+    { "UY.03", 3115 },
+    { "KZ.11", 1484 },
+    { "PK.01", 2317 },
+    { "VN.75", 3171 },
+    { "DJ.05", 687 },
+    { "BB.09", 204 },
+    { "SD.32", 2559 },
+    { "IN.03", 1232 },
+    { "MM.08", 1834 },
+    { "UA.", 2988 },
+    { "SN.12", 2626 },
+    { "US.VA", 3048 },
+    { "TR.57", 2906 },
+    { "BS.15", 376 },
+    { "DM.08", 701 },
+    { "MK.90", 1737 },
+    { "MA.55", 1647 },
+    { "MD.91", 1670 },
+    { "TR.31", 2851 },
+    { "PH.A7", 2308 },
+    { "GE.24", 955 },
+    { "UA.04", 2973 },
+    { "CU.15", 639 },
+    { "RU.76", 2462 },
+    { "TR.50", 2865 },
+    { "MK.82", 1745 },
+    { "SO.12", 2645 },
+    { "RU.50", 2495 },
+    { "ZM.08", 3250 },
+    { "SL.02", 2619 },
+    { "UG.43", 3019 },
+    { "NI.13", 2055 },
+    { "PL.82", 2335 },
+    { "PH.D4", 2295 },
+    { "TG.25", 2718 },
+    { "LB.04", 1513 },
+    { "UA.22", 2966 },
+    { "GE.13", 944 },
+    { "IN.23", 1239 },
+    { "BJ.09", 322 },
+    { "GN.31", 1015 },
+    { "BH.12", 295 },
+    { "RU.90", 2475 },
+    { "TR.66", 2846 },
+    { "ZM.05", 3255 },
+    { "KG.09", 1408 },
+    { "LY.60", 1632 },
+    { "NZ.F6", 2119 },
+    { "EE.02", 809 },
+    { "TR.68", 2883 },
+    { "MY.17", 1976 },
+    { "RU.15", 2525 },
+    { "BS.22", 374 },
+    { "VI.00", 3159 },
+    { "UG.36", 3029 },
+    { "IE.06", 1178 },
+    { "JP.16", 1396 },
+    { "JM.07", 1339 },
+    { "IR.28", 1287 },
+    { "ER.02", 841 },
+    { "LR.11", 1557 },
+    { "CL.13", 546 },
+    { "MW.20", 1908 },
+    { "TR.21", 2845 },
+    { "SN.10", 2634 },
+    { "UA.07", 2967 },
+    { "TH.27", 2754 },
+    { "GN.19", 1004 },
+    { "VN.24", 3177 },
+    { "CI.81", 496 },
+    { "CI.77", 507 },
+    { "BZ.05", 411 },
+    { "US.NJ", 3065 },
+    { "JP.18", 1389 },
+    { "JM.17", 1337 },
+    { "CH.BE", 474 },
+    { "CH.SH", 478 },
+    { "TR.15", 2850 },
+    { "UA.15", 2963 },
+    { "AR.19", 111 },
+    { "AR.11", 107 },
+    { "CU.05", 634 },
+    { "EC.08", 773 },
+    { "PT.21", 2355 },
+    { "HN.11", 1093 },
+    { "GN.28", 990 },
+    { "TT.09", 2921 },
+    { "SO.14", 2639 },
+    { "MX.26", 1948 },
+    { "TR.71", 2890 },
+    { "ES.51", 842 },
+    { "TG.24", 2714 },
+    { "GT.05", 1056 },
+    { "JP.32", 1367 },
+    { "CZ.89", 663 },
+    { "AL.43", 51 },
+    { "IL.00", 1211 },
+    { "TZ.09", 2948 },
+    { "VE.16", 3156 },
+    { "LT.57", 1579 },
+    { "MX.20", 1934 },
+    { "PH.D3", 2296 },
+    { "ID.10", 1151 },
+    { "TZ.23", 2953 },
+    { "KP.08", 1450 },
+    { "MM.05", 1844 },
+    { "MK.A1", 1727 },
+    { "CL.", 548 },
+    { "TH.79", 2756 },
+    { "DO.24", 726 },
+    { "MY.01", 1962 },
+    { "LI.03", 1533 },
+    { "NE.06", 2005 },
+    { "BR.02", 347 },
+    { "DO.16", 735 },
+    { "PH.15", 2203 },
+    { "AR.03", 95 },
+    { "BI.15", 312 },
+    { "ME.00", 1696 },
+    { "BR.24", 367 },
+    { "AR.17", 105 },
+    { "IN.06", 1241 },
+    { "AE.03", 11 },
+    { "DZ.42", 771 },
+    { "SY.09", 2681 },
+    { "BW.03", 396 },
+    { "AT.01", 126 },
+    { "VN.60", 3189 },
+    { "MX.28", 1928 },
+    { "EC.12", 790 },
+    { "FI.15", 879 },
+    { "ES.53", 847 },
+    { "CL.10", 545 },
+    { "MW.15", 1913 },
+    { "CG.07", 460 },
+    { "NO.12", 2101 },
+    { "PG.17", 2178 },
+    { "GR.ESYE25", 1036 },
+    { "ET.14", 864 },
+    { "BF.67", 261 },
+    { "DK.19", 693 },
+    { "LS.17", 1562 },
+    { "NG.39", 2028 },
+    { "ET.52", 872 },
+    { "HR.07", 1099 },
+    { "PT.13", 2347 },
+    { "IN.36", 1217 },
+    { "TH.03", 2742 },
+    { "NI.09", 2054 },
+    { "ZA.06", 3244 },
+    { "CD.01", 437 },
+    { "PH.28", 2204 },
+    { "PH.29", 2212 },
+    { "MN.06", 1866 },
+    { "EG.20", 829 },
+    { "AZ.63", 169 },
+    { "PG.19", 2165 },
+    { "CN.26", 577 },
+    { "MN.10", 1853 },
+    { "LA.20", 1493 },
+    { "PE.05", 2158 },
+    { "EG.22", 817 },
+    { "GE.08", 960 },
+    { "JP.14", 1356 },
+    { "CZ.80", 664 },
+    { "MY.16", 1966 },
+    { "BA.02", 200 },
+    { "DJ.04", 688 },
+    { "KZ.02", 1490 },
+    { "MU.13", 1894 },
+    { "LV.00", 1595 },
+    { "UA.27", 2969 },
+    { "TR.60", 2877 },
+    { "UG.81", 3027 },
+    { "GW.10", 1065 },
+    { "PH.34", 2235 },
+    { "ID.00", 1148 },
+    { "NO.05", 2083 },
+    { "KH.19", 1422 },
+    { "MR.10", 1876 },
+    { "BG.42", 290 },
+    { "BG.41", 283 },
+    { "BG.49", 269 },
+    { "MK.69", 1757 },
+    { "NG.27", 2021 },
+    { "RU.26", 2522 },
+    { "CA.03", 417 },
+    { "AZ.24", 151 },
+    { "RO.10", 2418 },
+    { "MD.77", 1683 },
+    { "NI.12", 2062 },
+    { "NL.15", 2071 },
+    { "MN.23", 1863 },
+    { "PT.17", 2353 },
+    { "ES.60", 846 },
+    { "BG.63", 277 },
+    { "MW.28", 1919 },
+    { "GM.00", 981 },
+    { "AR.04", 104 },
+    { "JP.17", 1382 },
+    { "TW.03", 2930 },
+    { "GN.16", 1007 },
+    { "MD.70", 1690 },
+    { "BH.03", 298 },
+    { "TH.09", 2734 },
+    { "JO.10", 1345 },
+    { "RO.28", 2417 },
+    { "CM.00", 554 },
+    { "IE.03", 1198 },
+    { "GD.03", 936 },
+    { "MK.C6", 1705 },
+    { "TW.02", 2931 },
+    { "VU.08", 3223 },
+    { "TH.41", 2739 },
+    { "CG.10", 457 },
+    { "PH.B3", 2245 },
+    { "NL.09", 2078 },
+    { "AZ.07", 156 },
+    { "MN.11", 1857 },
+    { "GP.00", 1025 },
+    { "DE.09", 683 },
+    { "PH.D2", 2298 },
+    { "UG.71", 3013 },
+    { "IN.35", 1225 },
+    { "TH.12", 2792 },
+    { "RU.80", 2478 },
+    { "RW.03", 2533 },
+    { "DE.15", 681 },
+    { "CR.08", 627 },
+    { "RU.40", 2500 },
+    { "BF.75", 228 },
+    { "AZ.05", 187 },
+    { "AZ.41", 184 },
+    { "JO.11", 1344 },
+    { "BI.16", 314 },
+    { "EG.08", 827 },
+    { "RW.06", 2532 },
+    { "NA.38", 1993 },
+    { "MK.A9", 1719 },
+    { "MZ.02", 1977 },
+    { "GN.37", 998 },
+    { "QA.03", 2382 },
+    { "LK.35", 1538 },
+    { "LY.43", 1622 },
+    { "NE.04", 2008 },
+    { "EG.13", 823 },
+    { "JP.40", 1374 },
+    { "MW.06", 1923 },
+    { "PE.04", 2148 },
+    { "CH.ZH", 471 },
+    { "MZ.09", 1980 },
+    { "BO.08", 333 },
+    { "CH.00", 484 },
+    { "MZ.11", 1986 },
+    { "FR.A9", 920 },
+    { "MD.87", 1675 },
+    { "JP.24", 1395 },
+    { "AZ.66", 138 },
+    { "NG.55", 2031 },
+    { "IT.04", 1313 },
+    { "JM.15", 1329 },
+    { "UZ.02", 3122 },
+    { "PH.G5", 2231 },
+    { "LK.30", 1543 },
+    { "UG.88", 3008 },
+    { "GY.12", 1072 },
+    { "AZ.06", 196 },
+    { "SK.03", 2610 },
+    { "GW.07", 1066 },
+    { "GT.16", 1051 },
+    { "RU.45", 2443 },
+    { "PH.D9", 2292 },
+    { "VE.03", 3157 },
+    { "SK.01", 2617 },
+    { "MK.08", 1810 },
+    { "FR.A6", 915 },
+    { "PH.36", 2274 },
+    { "MK.83", 1744 },
+    { "TR.37", 2907 },
+    { "CZ.85", 670 },
+    { "EE.18", 803 },
+    { "MU.19", 1891 },
+    { "CU.02", 638 },
+    { "RO.35", 2397 },
+    { "GQ.06", 1029 },
+    { "RO.06", 2429 },
+    { "BZ.06", 409 },
+    { "LT.62", 1574 },
+    { "UY.08", 3109 },
+    { "GE.02", 956 },
+    { "KE.01", 1404 },
+    { "PF.00", 2162 },
+    { "BW.10", 395 },
+    { "RO.15", 2412 },
+    { "FR.B2", 911 },
+    { "GN.34", 1003 },
+    { "HR.12", 1110 },
+    { "BR.18", 362 },
+    { "BD.85", 212 },
+    { "JP.34", 1357 },
+    { "IN.07", 1244 },
+    { "NE.07", 2006 },
+    { "TZ.26", 2956 },
+    { "BR.21", 357 },
+    { "PH.54", 2240 },
+    { "TH.", 2804 },
+    { "PH.31", 2190 },
+    { "ZM.03", 3254 },
+    { "PH.19", 2202 },
+    { "UA.26", 2964 },
+    { "CF.02", 441 },
+    { "MU.14", 1895 },
+    { "KZ.09", 1475 },
+    { "KH.09", 1428 },
+    { "AD.06", 0 },
+    { "NL.05", 2082 },
+    { "FR.A8", 914 },
+    { "CL.03", 541 },
+    { "IQ.08", 1250 },
+    { "TR.17", 2893 },
+    { "UG.89", 3006 },
+    { "SO.02", 2643 },
+    { "PH.25", 2192 },
+    { "RU.55", 2485 },
+    { "KZ.07", 1477 },
+    { "SD.33", 2549 },
+    { "PG.16", 2172 },
+    { "GE.39", 947 },
+    { "MK.47", 1777 },
+    { "VN.23", 3211 },
+    { "MX.05", 1933 },
+    { "US.NY", 3075 },
+    { "VN.44", 3202 },
+    { "GT.09", 1060 },
+    { "AF.31", 20 },
+    { "HR.15", 1096 },
+    { "AZ.45", 140 },
+    { "AZ.64", 150 },
+    { "UY.16", 3111 },
+    { "CI.92", 502 },
+    { "AD.00", 1 },
+    { "MA.48", 1656 },
+    { "VE.23", 3148 },
+    { "MK.01", 1817 },
+    { "NG.46", 2018 },
+    { "BI.21", 306 },
+    { "JP.08", 1393 },
+    { "PH.48", 2233 },
+    { "SV.10", 2668 },
+    { "MY.00", 1964 },
+    { "BZ.01", 407 },
+    { "SY.01", 2689 },
+    { "MK.33", 1789 },
+    { "RU.77", 2436 },
+    { "JO.19", 1343 },
+    { "MD.60", 1695 },
+    { "DE.11", 679 },
+    { "TN.15", 2829 },
+    { "RU.53", 2503 },
+    { "TN.28", 2834 },
+    { "MK.68", 1758 },
+    { "ML.05", 1825 },
+    { "CA.13", 424 },
+    { "NG.35", 2019 },
+    { "HN.12", 1084 },
+    { "MK.21", 1799 },
+    { "IE.01", 1184 },
+    { "DO.06", 714 },
+    { "TR.20", 2872 },
+    { "PE.18", 2155 },
+    { "LA.02", 1496 },
+    { "RU.57", 2464 },
+    { "TR.64", 2863 },
+    { "HU.12", 1142 },
+    { "PL.81", 2322 },
+    { "TH.10", 2767 },
+    { "BF.73", 222 },
+    { "CN.30", 575 },
+    { "RU.84", 2456 },
+    { "NG.11", 2039 },
+    { "MU.20", 1893 },
+    { "TH.00", 2727 },
+    { "FR.98", 905 },
+    { "SE.24", 2598 },
+    { "HR.19", 1105 },
+    { "AQ.", 92 },
+    { "US.IA", 3071 },
+    { "DZ.35", 746 },
+    { "AF.24", 26 },
+    { "DK.18", 696 },
+    { "CU.01", 633 },
+    { "GE.14", 957 },
+    { "MK.75", 1751 },
+    { "TT.01", 2927 },
+};
+static const ESGeoNamesHashTable esGeoNamesA1CodeHash = { 3269, 1635, esGeoNamesA1CodeDisplacements, esGeoNamesA1CodeEntries };
+
+// Olson zone names (loc-tzNames.dat):  360
+static const unsigned short esGeoNamesTZNameDisplacements[181] = {
+    0, 2, 10, 6, 1, 1, 20, 1, 6, 6, 0, 1, 31, 4, 1, 8,
+    1, 3, 2, 8, 21, 1, 1, 3, 0, 0, 3, 1, 18, 14, 5, 0,
+    0, 5, 2, 4, 3, 13, 7, 1, 2, 11, 1, 0, 4, 12, 2, 1,
+    10, 2, 14, 6, 2, 6, 5, 6, 5, 4, 2, 0, 13, 1, 1, 4,
+    2, 1, 1, 9, 7, 1, 6, 7, 1, 9, 10, 13, 11, 12, 3, 2,
+    10, 4, 20, 1, 3, 0, 1, 9, 0, 7, 8, 0, 31, 14, 16, 3,
+    18, 7, 5, 8, 1, 1, 6, 4, 1, 4, 15, 0, 9, 6, 11, 44,
+    7, 6, 5, 110, 6, 44, 2, 10, 12, 3, 17, 68, 1, 10, 15, 11,
+    1, 7, 3, 19, 24, 76, 5, 47, 13, 17, 21, 32, 31, 5, 0, 7,
+    38, 24, 27, 1, 3, 7, 0, 61, 0, 23, 18, 0, 66, 0, 8, 4,
+    0, 3, 2, 0, 7, 114, 98, 82, 53, 119, 51, 164, 56, 297, 11, 443,
+    0, 1, 7, 0, 7,
+};
+static const ESGeoNamesHashEntry esGeoNamesTZNameEntries[360] = {
+    { "Africa/El_Aaiun", 123 },
+    { "America/Indiana/Petersburg", 326 },
+    { "Asia/Shanghai", 104 },
+    { "Australia/Hobart", 30 },
+    { "Europe/Moscow", 265 },
+    { "Asia/Kolkata", 167 },
+    { "America/Guayaquil", 119 },
+    { "Europe/Madrid", 125 },
+    { "America/La_Paz", 46 },
+    { "Pacific/Chatham", 358 },
+    { "Europe/Jersey", 172 },
+    { "Atlantic/Reykjavik", 170 },
+    { "America/Maceio", 50 },
+    { "Asia/Macau", 212 },
+    { "Pacific/Rarotonga", 97 },
+    { "Africa/Mogadishu", 294 },
+    { "America/Los_Angeles", 333 },
+    { "Asia/Pyongyang", 182 },
+    { "America/St_Lucia", 193 },
+    { "Asia/Hong_Kong", 154 },
+    { "America/St_Thomas", 348 },
+    { "Asia/Vladivostok", 275 },
+    { "Asia/Aqtobe", 188 },
+    { "America/Caracas", 346 },
+    { "Asia/Aden", 353 },
+    { "America/Resolute", 81 },
+    { "America/Edmonton", 69 },
+    { "Pacific/Tarawa", 179 },
+    { "Africa/Bissau", 152 },
+    { "Asia/Karachi", 251 },
+    { "Asia/Tokyo", 175 },
+    { "America/Argentina/San_Juan", 19 },
+    { "Africa/Cairo", 122 },
+    { "America/Adak", 359 },
+    { "Africa/Bangui", 92 },
+    { "Europe/Chisinau", 204 },
+    { "Pacific/Ponape", 132 },
+    { "Antarctica/McMurdo", 9 },
+    { "Atlantic/Faroe", 134 },
+    { "Pacific/Pago_Pago", 22 },
+    { "Pacific/Palau", 260 },
+    { "Europe/Copenhagen", 115 },
+    { "Australia/Darwin", 25 },
+    { "Africa/Casablanca", 202 },
+    { "America/Havana", 108 },
+    { "America/Nipigon", 85 },
+    { "Pacific/Funafuti", 312 },
+    { "Europe/Oslo", 240 },
+    { "America/New_York", 321 },
+    { "Asia/Omsk", 271 },
+    { "America/Winnipeg", 71 },
+    { "Europe/Tallinn", 121 },
+    { "Africa/Gaborone", 64 },
+    { "America/Guatemala", 150 },
+    { "America/Tijuana", 228 },
+    { "America/Puerto_Rico", 255 },
+    { "America/Kentucky/Monticello", 328 },
+    { "America/Argentina/Rio_Gallegos", 20 },
+    { "Asia/Harbin", 105 },
+    { "America/Inuvik", 80 },
+    { "Africa/Monrovia", 196 },
+    { "Europe/Luxembourg", 199 },
+    { "America/Barbados", 35 },
+    { "Pacific/Tahiti", 248 },
+    { "America/Cayman", 185 },
+    { "Asia/Qatar", 262 },
+    { "Pacific/Honolulu", 338 },
+    { "Asia/Kathmandu", 241 },
+    { "Europe/Andorra", 0 },
+    { "Pacific/Kosrae", 133 },
+    { "America/Antigua", 3 },
+    { "America/Iqaluit", 86 },
+    { "America/Dawson_Creek", 77 },
+    { "Atlantic/Canary", 126 },
+    { "Indian/Mauritius", 218 },
+    { "America/Manaus", 51 },
+    { "America/Vancouver", 67 },
+    { "America/Goose_Bay", 84 },
+    { "Pacific/Guam", 151 },
+    { "America/Merida", 223 },
+    { "America/Thunder_Bay", 88 },
+    { "Africa/Maputo", 232 },
+    { "Asia/Tehran", 169 },
+    { "Europe/Vatican", 344 },
+    { "America/Curacao", 7 },
+    { "Australia/Perth", 26 },
+    { "Africa/Libreville", 135 },
+    { "Asia/Yerevan", 6 },
+    { "America/Godthab", 143 },
+    { "America/Montevideo", 341 },
+    { "Europe/Lisbon", 257 },
+    { "America/Argentina/San_Luis", 18 },
+    { "Asia/Damascus", 298 },
+    { "Asia/Vientiane", 191 },
+    { "Africa/Khartoum", 284 },
+    { "Asia/Sakhalin", 276 },
+    { "America/Argentina/Ushuaia", 13 },
+    { "America/Montreal", 68 },
+    { "Africa/Douala", 100 },
+    { "America/Cancun", 224 },
+    { "America/Miquelon", 253 },
+    { "Asia/Oral", 186 },
+    { "Asia/Gaza", 256 },
+    { "Europe/Gibraltar", 142 },
+    { "Asia/Thimphu", 63 },
+    { "Europe/Helsinki", 129 },
+    { "Asia/Kashgar", 102 },
+    { "Europe/Rome", 171 },
+    { "America/Porto_Velho", 60 },
+    { "Africa/Banjul", 145 },
+    { "Europe/Belgrade", 264 },
+    { "Asia/Dushanbe", 305 },
+    { "Asia/Chongqing", 103 },
+    { "Africa/Lagos", 237 },
+    { "Indian/Comoro", 180 },
+    { "Europe/Istanbul", 310 },
+    { "Africa/Tripoli", 201 },
+    { "Europe/Uzhgorod", 318 },
+    { "Africa/Harare", 357 },
+    { "Asia/Magadan", 278 },
+    { "America/Chihuahua", 227 },
+    { "Europe/Athens", 148 },
+    { "Pacific/Easter", 99 },
+    { "Asia/Urumqi", 101 },
+    { "Asia/Brunei", 45 },
+    { "Pacific/Saipan", 213 },
+    { "America/Belize", 66 },
+    { "Africa/Bamako", 209 },
+    { "Asia/Krasnoyarsk", 270 },
+    { "Asia/Novosibirsk", 272 },
+    { "Asia/Tbilisi", 138 },
+    { "Asia/Jakarta", 161 },
+    { "Pacific/Majuro", 207 },
+    { "Africa/Djibouti", 114 },
+    { "Africa/Kinshasa", 91 },
+    { "Africa/Lusaka", 356 },
+    { "America/Detroit", 329 },
+    { "America/Araguaina", 53 },
+    { "Europe/Stockholm", 285 },
+    { "Europe/Riga", 200 },
+    { "America/Grand_Turk", 300 },
+    { "Europe/Isle_of_Man", 166 },
+    { "Africa/Dar_es_Salaam", 314 },
+    { "America/Argentina/Mendoza", 16 },
+    { "Europe/Zagreb", 156 },
+    { "America/Boise", 336 },
+    { "America/Monterrey", 221 },
+    { "Pacific/Apia", 352 },
+    { "Europe/Zurich", 94 },
+    { "America/Boa_Vista", 61 },
+    { "Asia/Dili", 306 },
+    { "Asia/Aqtau", 187 },
+    { "Asia/Irkutsk", 273 },
+    { "Africa/Bujumbura", 41 },
+    { "America/Indiana/Tell_City", 324 },
+    { "America/Bahia", 52 },
+    { "Asia/Taipei", 313 },
+    { "America/Martinique", 214 },
+    { "Europe/Kaliningrad", 269 },
+    { "Europe/Paris", 95 },
+    { "Asia/Colombo", 195 },
+    { "Atlantic/Bermuda", 44 },
+    { "America/Paramaribo", 295 },
+    { "America/Indiana/Vincennes", 323 },
+    { "Asia/Kuwait", 184 },
+    { "Asia/Amman", 174 },
+    { "Africa/Tunis", 308 },
+    { "America/Blanc-Sablon", 87 },
+    { "Australia/Adelaide", 24 },
+    { "America/St_Johns", 75 },
+    { "Africa/Lubumbashi", 90 },
+    { "Europe/Guernsey", 140 },
+    { "Pacific/Port_Moresby", 249 },
+    { "Asia/Ashgabat", 307 },
+    { "Asia/Ho_Chi_Minh", 349 },
+    { "Pacific/Efate", 350 },
+    { "Africa/Nairobi", 176 },
+    { "America/Chicago", 320 },
+    { "America/Fortaleza", 47 },
+    { "America/Montserrat", 216 },
+    { "Europe/Warsaw", 252 },
+    { "America/Argentina/Catamarca", 14 },
+    { "America/Santo_Domingo", 117 },
+    { "Europe/Sofia", 39 },
+    { "Europe/Malta", 217 },
+    { "Asia/Nicosia", 111 },
+    { "America/Argentina/Tucuman", 17 },
+    { "Asia/Kuala_Lumpur", 230 },
+    { "Africa/Porto-Novo", 42 },
+    { "America/Yellowknife", 89 },
+    { "America/Bogota", 106 },
+    { "Europe/San_Marino", 292 },
+    { "America/Aruba", 32 },
+    { "America/Noronha", 55 },
+    { "Pacific/Galapagos", 120 },
+    { "Asia/Baku", 33 },
+    { "Indian/Christmas", 110 },
+    { "America/Glace_Bay", 82 },
+    { "America/Cuiaba", 56 },
+    { "Australia/Sydney", 28 },
+    { "Europe/Vaduz", 194 },
+    { "America/Indiana/Winamac", 331 },
+    { "America/Lima", 246 },
+    { "America/Rainy_River", 79 },
+    { "America/El_Salvador", 297 },
+    { "America/Campo_Grande", 58 },
+    { "Pacific/Tongatapu", 309 },
+    { "Asia/Pontianak", 160 },
+    { "Africa/Dakar", 293 },
+    { "Europe/Volgograd", 267 },
+    { "America/North_Dakota/New_Salem", 337 },
+    { "America/Tegucigalpa", 155 },
+    { "America/Sao_Paulo", 57 },
+    { "Europe/Tirane", 5 },
+    { "Africa/Freetown", 291 },
+    { "Pacific/Pitcairn", 254 },
+    { "Australia/Broken_Hill", 31 },
+    { "Europe/Prague", 112 },
+    { "Asia/Seoul", 183 },
+    { "Indian/Antananarivo", 206 },
+    { "Australia/Melbourne", 29 },
+    { "America/Mazatlan", 225 },
+    { "America/Anguilla", 4 },
+    { "Asia/Jerusalem", 165 },
+    { "Atlantic/Cape_Verde", 109 },
+    { "Asia/Phnom_Penh", 178 },
+    { "Africa/Abidjan", 96 },
+    { "America/Argentina/Cordoba", 11 },
+    { "Africa/Kigali", 280 },
+    { "Asia/Bahrain", 40 },
+    { "Pacific/Gambier", 247 },
+    { "Asia/Qyzylorda", 190 },
+    { "America/Moncton", 70 },
+    { "Atlantic/St_Helena", 287 },
+    { "Asia/Samarkand", 342 },
+    { "Africa/Asmara", 124 },
+    { "Indian/Reunion", 263 },
+    { "Europe/London", 136 },
+    { "America/Argentina/Salta", 12 },
+    { "Europe/Simferopol", 315 },
+    { "Africa/Brazzaville", 93 },
+    { "Pacific/Wallis", 351 },
+    { "Asia/Tashkent", 343 },
+    { "America/Cayenne", 139 },
+    { "America/Regina", 74 },
+    { "Europe/Monaco", 203 },
+    { "Asia/Almaty", 189 },
+    { "Australia/Brisbane", 27 },
+    { "America/Port-au-Prince", 157 },
+    { "America/Thule", 144 },
+    { "Africa/Ndjamena", 301 },
+    { "America/Costa_Rica", 107 },
+    { "Asia/Bangkok", 304 },
+    { "Europe/Vilnius", 198 },
+    { "America/Recife", 48 },
+    { "America/Phoenix", 229 },
+    { "Asia/Makassar", 162 },
+    { "Europe/Bucharest", 159 },
+    { "Europe/Budapest", 158 },
+    { "America/St_Vincent", 345 },
+    { "Asia/Dhaka", 36 },
+    { "Arctic/Longyearbyen", 289 },
+    { "America/Grenada", 137 },
+    { "America/Asuncion", 261 },
+    { "America/Kentucky/Louisville", 325 },
+    { "America/Guadeloupe", 43 },
+    { "Europe/Minsk", 65 },
+    { "America/Whitehorse", 83 },
+    { "America/Santiago", 98 },
+    { "America/St_Kitts", 181 },
+    { "Atlantic/Azores", 259 },
+    { "Africa/Malabo", 147 },
+    { "America/Mexico_City", 222 },
+    { "Pacific/Auckland", 243 },
+    { "Europe/Amsterdam", 239 },
+    { "America/Jamaica", 173 },
+    { "Europe/Berlin", 113 },
+    { "Asia/Beirut", 192 },
+    { "Africa/Niamey", 235 },
+    { "America/Santarem", 49 },
+    { "America/Argentina/Jujuy", 15 },
+    { "Asia/Kamchatka", 277 },
+    { "Africa/Accra", 141 },
+    { "America/Rio_Branco", 59 },
+    { "Africa/Lome", 303 },
+    { "America/Managua", 238 },
+    { "America/Argentina/Buenos_Aires", 10 },
+    { "Africa/Ceuta", 127 },
+    { "America/Toronto", 72 },
+    { "Asia/Manila", 250 },
+    { "Europe/Vienna", 23 },
+    { "Europe/Zaporozhye", 316 },
+    { "Asia/Riyadh", 281 },
+    { "Europe/Sarajevo", 34 },
+    { "Africa/Conakry", 146 },
+    { "America/Tortola", 347 },
+    { "Africa/Windhoek", 233 },
+    { "America/Nome", 340 },
+    { "Atlantic/South_Georgia", 149 },
+    { "America/Pangnirtung", 78 },
+    { "Indian/Mahe", 283 },
+    { "America/Guyana", 153 },
+    { "Africa/Maseru", 197 },
+    { "Asia/Bishkek", 177 },
+    { "Pacific/Fiji", 130 },
+    { "America/Swift_Current", 76 },
+    { "Europe/Bratislava", 290 },
+    { "Europe/Dublin", 164 },
+    { "Africa/Kampala", 319 },
+    { "Pacific/Guadalcanal", 282 },
+    { "Africa/Ouagadougou", 38 },
+    { "Europe/Ljubljana", 288 },
+    { "Asia/Yekaterinburg", 266 },
+    { "America/Port_of_Spain", 311 },
+    { "Asia/Singapore", 286 },
+    { "Asia/Ulaanbaatar", 211 },
+    { "Africa/Johannesburg", 355 },
+    { "America/Nassau", 62 },
+    { "Atlantic/Madeira", 258 },
+    { "America/Indiana/Vevay", 327 },
+    { "Africa/Sao_Tome", 296 },
+    { "America/Indiana/Knox", 330 },
+    { "Asia/Kabul", 2 },
+    { "Indian/Mayotte", 354 },
+    { "Europe/Samara", 268 },
+    { "Asia/Anadyr", 279 },
+    { "America/Juneau", 335 },
+    { "Asia/Yakutsk", 274 },
+    { "Asia/Kuching", 231 },
+    { "America/Panama", 245 },
+    { "America/Dominica", 116 },
+    { "America/Indiana/Indianapolis", 322 },
+    { "Asia/Baghdad", 168 },
+    { "America/Argentina/La_Rioja", 21 },
+    { "Europe/Kiev", 317 },
+    { "Europe/Skopje", 208 },
+    { "Pacific/Noumea", 234 },
+    { "America/Hermosillo", 226 },
+    { "Africa/Mbabane", 299 },
+    { "Asia/Dubai", 1 },
+    { "Asia/Jayapura", 163 },
+    { "Indian/Kerguelen", 302 },
+    { "Africa/Blantyre", 220 },
+    { "Pacific/Norfolk", 236 },
+    { "Africa/Luanda", 8 },
+    { "Asia/Rangoon", 210 },
+    { "Indian/Maldives", 219 },
+    { "Europe/Podgorica", 205 },
+    { "Pacific/Niue", 242 },
+    { "Africa/Algiers", 118 },
+    { "America/Menominee", 332 },
+    { "Africa/Addis_Ababa", 128 },
+    { "America/Belem", 54 },
+    { "Atlantic/Stanley", 131 },
+    { "Asia/Muscat", 244 },
+    { "Africa/Nouakchott", 215 },
+    { "America/Denver", 334 },
+    { "America/Halifax", 73 },
+    { "America/Anchorage", 339 },
+    { "Europe/Brussels", 37 },
+};
+static const ESGeoNamesHashTable esGeoNamesTZNameHash = { 360, 181, esGeoNamesTZNameDisplacements, esGeoNamesTZNameEntries };
+
+#endif  // _ESGEONAMESHASHTABLES_HPP_
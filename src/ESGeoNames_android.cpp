@@ -11,7 +11,10 @@
 #include "ESJNI.hpp"
 #include "ESJNIDefs.hpp"
 
+#include <algorithm>
 #include <map>
+#include <string>
+#include <vector>
 
 #include "com_emeraldsequoia_eslocation_GeoNames.h"
 
@@ -341,6 +344,76 @@ JNIEXPORT jboolean JNICALL Java_com_emeraldsequoia_eslocation_GeoNames_findBestC
     }
 }
 
+/*
+ * Class:     com_emeraldsequoia_eslocation_GeoNames
+ * Method:    getSearchResults
+ * Signature: (III[I[F[F[J)[B
+ */
+// A page of search results in one call, for the list in LocationSelectActivity.  The numbers go into the arrays passed in,
+// one entry per row; the strings come back as one buffer of UTF-8, four null-terminated strings per row (name, region
+// name, country code, tz name), which GeoNames.java splits.  slotMasks has bit h set iff the city is valid for the slot at
+// offset hour h, as selectedCityValidForSlotAtOffsetHour(h).  Returns null if there are no rows.
+JNIEXPORT jbyteArray JNICALL Java_com_emeraldsequoia_eslocation_GeoNames_getSearchResults
+(JNIEnv *jniEnv, jobject javaObject, jint jSerialNumber, jint first, jint count,
+ jintArray jSlotMasks, jfloatArray jLatitudes, jfloatArray jLongitudes, jlongArray jPopulations) {
+    ESGeoNames *geoNames = findGeoNames((int)jSerialNumber);
+    if (!geoNames) {
+        ESErrorReporter::logError("ESGeoNames_getSearchResults", "Didn't find geoNames with serialNumber %d", (int)jSerialNumber);
+        return NULL;
+    }
+    int maxRows = (int)count;
+    maxRows = std::min(maxRows, (int)jniEnv->GetArrayLength(jSlotMasks));
+    maxRows = std::min(maxRows, (int)jniEnv->GetArrayLength(jLatitudes));
+    maxRows = std::min(maxRows, (int)jniEnv->GetArrayLength(jLongitudes));
+    maxRows = std::min(maxRows, (int)jniEnv->GetArrayLength(jPopulations));
+    if (first < 0 || maxRows <= 0) {
+        return NULL;
+    }
+    std::vector<ESGeoNamesSearchResult> results(maxRows);
+    std::vector<char> text;
+    int numRows = geoNames->getSearchResults((int)first, maxRows, &results[0], &text);
+    if (numRows <= 0) {
+        return NULL;
+    }
+
+    std::vector<int> cityIndices(numRows);
+    std::vector<jint> slotMasks(numRows, 0);
+    std::vector<jfloat> latitudes(numRows);
+    std::vector<jfloat> longitudes(numRows);
+    std::vector<jlong> populations(numRows);
+    std::string packed;
+    for (int r = 0; r < numRows; r++) {
+        const ESGeoNamesSearchResult &result = results[r];
+        cityIndices[r] = result.cityIndex;
+        latitudes[r] = (jfloat)result.latitude;
+        longitudes[r] = (jfloat)result.longitude;
+        populations[r] = (jlong)result.population;
+        packed.append(result.name).push_back('\0');
+        packed.append(result.regionName).push_back('\0');
+        packed.append(result.countryCode).push_back('\0');
+        packed.append(result.tzName).push_back('\0');
+    }
+    std::vector<ESSlotInclusionClass> classes(numRows);
+    for (int h = 0; h < 24; h++) {
+        geoNames->inclusionClassesForCitiesAtSlotOffsetHour(&cityIndices[0], numRows, h, &classes[0]);
+        for (int r = 0; r < numRows; r++) {
+            if (classes[r] != notIncluded) {
+                slotMasks[r] |= (1 << h);
+            }
+        }
+    }
+
+    jniEnv->SetIntArrayRegion(jSlotMasks, 0, numRows, &slotMasks[0]);
+    jniEnv->SetFloatArrayRegion(jLatitudes, 0, numRows, &latitudes[0]);
+    jniEnv->SetFloatArrayRegion(jLongitudes, 0, numRows, &longitudes[0]);
+    jniEnv->SetLongArrayRegion(jPopulations, 0, numRows, &populations[0]);
+    jbyteArray jText = jniEnv->NewByteArray((jsize)packed.size());
+    if (jText) {
+        jniEnv->SetByteArrayRegion(jText, 0, (jsize)packed.size(), (const jbyte *)packed.data());
+    }
+    return jText;
+}
+
 /*
  * Class:     com_emeraldsequoia_eslocation_GeoNames
  * Method:    onCreate
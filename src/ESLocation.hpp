@@ -13,10 +13,11 @@
 #include <math.h>
 
 #include <string>
-#include <list>
+#include <vector>
 
 // Forward decl
 class ESLocation;
+struct ESLocationDelivery;
 
 /*! This class is used by clients to know when their location has been changed. */
 class ESLocationObserver {
@@ -46,6 +47,13 @@ typedef enum ESLocState {
     ESLocManual = 5
 } ESLocState;
 
+// How the batch distance methods measure; all return km.  Chord and equirectangular are cheaper, for callers that only rank.
+typedef enum ESLocationDistanceMode {
+    ESLocationDistanceGreatCircle = 0,    // Haversine, as kmBetweenLatLong
+    ESLocationDistanceChord = 1,          // Straight line through the earth; same ordering as great circle, and within 0.1% of it under 1000 km
+    ESLocationDistanceEquirectangular = 2 // Flat projection at the mean latitude; cheapest, within 0.4% under 1000 km below 60 degrees latitude (but 3% by 80 degrees), and not across a pole
+} ESLocationDistanceMode;
+
 /*! A location is either a user-specified location or a system location. */
 class ESLocation {
   public:
@@ -55,6 +63,7 @@ class ESLocation {
 
     static ESLocation       *appDefault();      // once constructed, never goes away, even through user=>device=>user changes
     static ESLocation       *deviceLocation();  // access to device location without (explicitly) constructing an object
+    static void             flushPrefs();       // write any location state not yet recorded in UserPrefs now (e.g., at shutdown)
     
     bool                    isNorthernHemisphere() { return _latitudeDegrees >= 0; }  // equator is north
     double                  latitudeDegrees() { return _latitudeDegrees; }
@@ -85,18 +94,37 @@ class ESLocation {
                                              double longitude1Radians,
                                              double latitude2Radians,
                                              double longitude2Radians);
-                                             
+    // Batch versions, over separate latitude and longitude arrays in degrees (as ESGeoNames stores them).  These work in float
+    // with polynomial trig so the compiler can vectorize them; see ESLocation.cpp for the error bounds.
+    static void             kmFromLatLongDegrees(float                  latitudeDegrees,
+                                                 float                  longitudeDegrees,
+                                                 const float            *latitudesDegrees,
+                                                 const float            *longitudesDegrees,
+                                                 int                    count,
+                                                 float                  *kmReturn,  // count results
+                                                 ESLocationDistanceMode mode = ESLocationDistanceGreatCircle);
+    static void             kmBetweenLatLongDegrees(const float            *latitudes1Degrees,
+                                                    const float            *longitudes1Degrees,
+                                                    int                    count1,
+                                                    const float            *latitudes2Degrees,
+                                                    const float            *longitudes2Degrees,
+                                                    int                    count2,
+                                                    float                  *kmReturn,  // count1 x count2 results, row i for point i of the first set
+                                                    ESLocationDistanceMode mode = ESLocationDistanceGreatCircle);
+
     static const char       * const locationPrefixForDeviceOnly;
 
   protected:
     void                    setNotDevice(bool skipWritingPrefs = false);
     void                    newLocationAvailable();
-    void                    recordStateInPrefs();
+    void                    recordStateInPrefs();  // marks state dirty; written by flushPrefs shortly afterwards
 
     static void             newDeviceLocationAvailable();
     static void             initDeviceLocation();
     static void             initAppDefault();
-    static void             recalculateDeviceLocationUpdateParameters();
+    static void             recalculateDeviceLocationUpdateParameters();  // apply the current aggregate parameters to the device
+    static void             addObserverToDeviceAggregates(ESLocationObserver *observer);
+    static void             removeObserverFromDeviceAggregates(ESLocationObserver *observer);
 
     bool                    _isDeviceLocation;
     double                  _latitudeDegrees;
@@ -109,16 +137,22 @@ class ESLocation {
 
   private:
     void                    setToDevice(bool skipZeroOverride);
+    void                    notifyObservers(bool onlyIfObserverWantsIt);
+    void                    writeStateToPrefs();
+    bool                    readStateFromPrefs();
     static void             stopUpdating(bool userSaidNo);
 
     std::string             _prefsName;
-    std::list<ESLocationObserver *> *_observers;
+    std::vector<ESLocationObserver *> *_observers;
+    std::vector<ESLocationDelivery> *_deliveries;  // What we last sent to each observer, parallel to _observers
 
     static ESLocation       *_appDefault;
     static ESLocation       *_deviceLocation;
 
 friend class ESDeviceLocationManager;
 friend class ESDeviceLocationTimerFireObserver;
+friend class ESLocationPrefsFlushTimerObserver;
+friend class ESLocationPrefsSleepWakeObserver;
 };
 
 inline /*static*/ ESLocation *
@@ -13,6 +13,7 @@
 #include "ESTime.hpp"
 #include "ESErrorReporter.hpp"
 #include "ESUtil.hpp"
+#include "ESLock.hpp"
 #undef ESTRACE
 #include "ESTrace.hpp"
 
@@ -39,9 +40,20 @@ ESLocationTimeHelperThread::main() {
     return NULL;
 }
 
+#define MIN_KM_THRESH 100  // We can move this much in lat and long without changing countries
+#define KM_FOR_DLAT(DLAT) (110 * DLAT)
+#define KM_FOR_DLONG_AT_LAT(DLONG, LAT) (110 * DLONG * cos(LAT*M_PI/180))
+
+// The accuracy asked for is MIN_KM_THRESH, since ESLocation withholds fixes that have moved less than that since the last
+// one delivered, and countryCheckNeeded wants one every MIN_KM_THRESH of movement
 ESLocationTimeHelper::ESLocationTimeHelper()
-:   ESLocationObserver(1000000/*accuracyDesiredInMeters*/, 3600/*updateInterval*/),
+:   ESLocationObserver(MIN_KM_THRESH * 1000/*accuracyDesiredInMeters*/, 3600/*updateInterval*/),
     _thread(new ESLocationTimeHelperThread),
+    _geoNames(new ESGeoNames),
+    _pendingLock(new ESLock),
+    _helpQueued(false),
+    _workerCityIndex(-1),
+    _workerStableRadiusKm(0),
     _firstNotificationDone(false)
 {
     traceEnter("ESLocationTimeHelper ctor");
@@ -58,53 +70,99 @@ ESLocationTimeHelper::ESLocationTimeHelper()
     traceExit("ESLocationTimeHelper ctor");
 }
 
+// The last thing the helper thread does before it exits:  it may still have been finishing a query when the helper was
+// destroyed, so it's the one to let go of the geoNames (releasing the shared data, so it can be cleared) and the lock
+static void releaseWorkerStateGlue(void *obj,
+                                   void *param) {
+    delete (ESGeoNames *)obj;
+    delete (ESLock *)param;
+}
+
 ESLocationTimeHelper::~ESLocationTimeHelper()
 {
     ESLocation::deviceLocation()->removeObserver(this);
+    _thread->callInThread(releaseWorkerStateGlue, _geoNames, _pendingLock);  // Handled after anything already queued
     _thread->requestExit();
+    _geoNames = NULL;
+    _pendingLock = NULL;
 }
  
 void
-ESLocationTimeHelper::notifyTime(ESGeoNames *geoNames) {
+ESLocationTimeHelper::notifyTime(const std::string &countryCode) {
     ESAssert(ESThread::inMainThread());
-    std::string cc = geoNames->selectedCityCountryCode();
-    tracePrintf2("Selected city is %s, country code %s\n", geoNames->selectedCityName().c_str(), cc.c_str());
-    delete geoNames;
-    geoNames = NULL;
     ESUserPrefs::setPref("ESLocationTimeHelperLatitudeDegrees", _lastNotifiedLatitudeDegrees);
     ESUserPrefs::setPref("ESLocationTimeHelperLongitudeDegrees", _lastNotifiedLongitudeDegrees);
-    ESUserPrefs::setPref("ESLocationTimeHelperCountryCode", cc);
+    ESUserPrefs::setPref("ESLocationTimeHelperCountryCode", countryCode);
     ESUserPrefs::setPref("ESLocationTimeHelperValid", true);
-    ESUtil::noteTimeAtPhase(ESUtil::stringWithFormat("ESLocationTimeHelper::notifyTime with country code '%s'", cc.c_str()));
-    ESTime::setDeviceCountryCode(cc.c_str());
+    ESUtil::noteTimeAtPhase(ESUtil::stringWithFormat("ESLocationTimeHelper::notifyTime with country code '%s'", countryCode.c_str()));
+    ESTime::setDeviceCountryCode(countryCode.c_str());
 }
 
-static void notifyTimeGlue(void *obj,
-                           void *param) {
+void
+ESLocationTimeHelper::notifyTimeForCity(int cityIndex) {
+    ESAssert(ESThread::inMainThread());
+    // Look up the country here rather than in the helper thread, since the region tables can be trimmed from the main
+    // thread (see ESGeoNames::trimToBudget).  _geoNames retains the shared data, so this doesn't cause a reload.
+    ESGeoNames geoNames;
+    geoNames.selectCityWithIndex(cityIndex);
+    std::string cc = geoNames.selectedCityCountryCode();
+    tracePrintf2("Selected city is %s, country code %s\n", geoNames.selectedCityName().c_str(), cc.c_str());
+    notifyTime(cc);
+}
+
+static void notifyTimeForCityGlue(void *obj,
+                                  void *param) {
     ESAssert(ESThread::inMainThread());
     ESLocationTimeHelper *timeHelper = (ESLocationTimeHelper*)obj;
-    ESGeoNames *geoNames = (ESGeoNames *)param;
-    timeHelper->notifyTime(geoNames);
+    timeHelper->notifyTimeForCity((int)(long)param);
 }
 
+static void notifyTimeWithCountryCodeGlue(void *obj,
+                                          void *param) {
+    ESAssert(ESThread::inMainThread());
+    ESLocationTimeHelper *timeHelper = (ESLocationTimeHelper*)obj;
+    long packedCode = (long)param;
+    char countryCode[3] = { (char)(packedCode & 0xff), (char)((packedCode >> 8) & 0xff), '\0' };
+    timeHelper->notifyTime(countryCode);
+}
+
+// Only the most recent position posted by doHelp is processed; any posted while we were busy replace each other.
+// Away from borders the country raster has the answer, and nothing else (in particular, none of the city data) need
+// be loaded; near one, we use the closest city.
 void
-ESLocationTimeHelper::doHelpInThread(ESGeoNames *geoNames) {
-    ESLocation *devLoc = ESLocation::deviceLocation();
-    ESUtil::noteTimeAtPhase(ESUtil::stringWithFormat("ESLocationTimeHelper::doHelpInThread calling findClosestCity to %.2f, %.2f", devLoc->latitudeDegrees(), devLoc->longitudeDegrees()));
-    geoNames->findClosestCityToLatitudeDegrees(devLoc->latitudeDegrees(), devLoc->longitudeDegrees());
-    ESUtil::noteTimeAtPhase("ESLocationTimeHelper::doHelpInThread done calling findClosestCity");
-    ESThread::callInMainThread(notifyTimeGlue, this, geoNames);
+ESLocationTimeHelper::doHelpInThread() {
+    _pendingLock->lock();
+    float latitudeDegrees = _pendingLatitudeDegrees;
+    float longitudeDegrees = _pendingLongitudeDegrees;
+    _helpQueued = false;
+    _pendingLock->unlock();
+    std::string cc = _geoNames->rasterCountryCodeForLatitudeDegrees(latitudeDegrees, longitudeDegrees);
+    if (!cc.empty()) {
+        ESUtil::noteTimeAtPhase(ESUtil::stringWithFormat("ESLocationTimeHelper::doHelpInThread, country raster gives '%s'", cc.c_str()));
+        long packedCode = (unsigned char)cc[0] | ((unsigned char)cc[1] << 8);
+        ESThread::callInMainThread(notifyTimeWithCountryCodeGlue, this, (void *)packedCode);
+        return;
+    }
+    if (_workerCityIndex >= 0 &&
+        ESLocation::kmBetweenLatLong(latitudeDegrees * M_PI / 180, longitudeDegrees * M_PI / 180,
+                                     _workerLatitudeDegrees * M_PI / 180, _workerLongitudeDegrees * M_PI / 180) < _workerStableRadiusKm) {
+        ESUtil::noteTimeAtPhase("ESLocationTimeHelper::doHelpInThread, closest city can't have changed, skipping findClosestCity");
+    } else {
+        ESUtil::noteTimeAtPhase(ESUtil::stringWithFormat("ESLocationTimeHelper::doHelpInThread calling findClosestCity to %.2f, %.2f", latitudeDegrees, longitudeDegrees));
+        _geoNames->findClosestCityToLatitudeDegrees(latitudeDegrees, longitudeDegrees, &_workerStableRadiusKm);
+        ESUtil::noteTimeAtPhase("ESLocationTimeHelper::doHelpInThread done calling findClosestCity");
+        _workerCityIndex = _geoNames->selectedCityIndex();
+        _workerLatitudeDegrees = latitudeDegrees;
+        _workerLongitudeDegrees = longitudeDegrees;
+    }
+    ESThread::callInMainThread(notifyTimeForCityGlue, this, (void *)(long)_workerCityIndex);
 }
 
 static void doHelpGlue(void *obj,
                        void *param) {
-    ((ESLocationTimeHelper *)obj)->doHelpInThread((ESGeoNames *)param);
+    ((ESLocationTimeHelper *)obj)->doHelpInThread();
 }
 
-#define MIN_KM_THRESH 100  // We can move this much in lat and long without changing countries
-#define KM_FOR_DLAT(DLAT) (110 * DLAT)
-#define KM_FOR_DLONG_AT_LAT(DLONG, LAT) (110 * DLONG * cos(LAT*M_PI/180))
-
 inline bool
 ESLocationTimeHelper::countryCheckNeeded() {
     ESAssert(ESThread::inMainThread());
@@ -141,7 +199,15 @@ void
 ESLocationTimeHelper::doHelp() {
     ESAssert(ESThread::inMainThread());  // for ESGeoNames::getSharedGeoNames
     if (countryCheckNeeded()) {
-        _thread->callInThread(doHelpGlue, this, new ESGeoNames);
+        _pendingLock->lock();
+        _pendingLatitudeDegrees = _lastNotifiedLatitudeDegrees;
+        _pendingLongitudeDegrees = _lastNotifiedLongitudeDegrees;
+        bool needToQueue = !_helpQueued;
+        _helpQueued = true;
+        _pendingLock->unlock();
+        if (needToQueue) {
+            _thread->callInThread(doHelpGlue, this, NULL);
+        }
     }
 }
 
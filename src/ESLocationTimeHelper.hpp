@@ -12,6 +12,7 @@
 
 class ESChildThread;
 class ESGeoNames;
+class ESLock;
 
 /*! This class is used to assist the ESTime module in determining an
  *  appropriate NTP server to use.  There is a bit of an ordering
@@ -37,13 +38,28 @@ class ESLocationTimeHelper : ESLocationObserver {
     /*virtual*/ void        newLocationAvailable(ESLocation *location);
 
     // Methods called by internals
-    void                    notifyTime(ESGeoNames *geoNames);
-    void                    doHelpInThread(ESGeoNames *geoNames);
+    void                    notifyTime(const std::string &countryCode);
+    void                    notifyTimeForCity(int cityIndex);
+    void                    doHelpInThread();
     bool                    countryCheckNeeded();
 
   private:
     void                    doHelp();
     ESChildThread           *_thread;
+    ESGeoNames              *_geoNames;          // Used only in _thread; kept for the life of the helper so the shared data stays loaded (and deleted there)
+
+    // Position for _thread to process, posted by doHelp.  Guarded by _pendingLock.
+    ESLock                  *_pendingLock;
+    float                   _pendingLatitudeDegrees;
+    float                   _pendingLongitudeDegrees;
+    bool                    _helpQueued;         // A doHelpInThread call is queued and hasn't yet picked up the pending position
+
+    // Last answer from _thread, used only there
+    int                     _workerCityIndex;
+    float                   _workerLatitudeDegrees;
+    float                   _workerLongitudeDegrees;
+    float                   _workerStableRadiusKm;  // Positions within this of the above have the same closest city
+
     bool                    _firstNotificationDone;
     double                  _lastNotifiedLatitudeDegrees;
     double                  _lastNotifiedLongitudeDegrees;